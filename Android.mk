@@ -192,6 +192,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/api/netdata_api.cpp                                    \
     src/core/api/netdiag_api.cpp                                    \
     src/core/api/network_time_api.cpp                               \
+    src/core/api/packet_trace_api.cpp                               \
     src/core/api/ping_sender_api.cpp                                \
     src/core/api/random_crypto_api.cpp                              \
     src/core/api/random_noncrypto_api.cpp                           \
@@ -217,6 +218,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/coap/coap.cpp                                          \
     src/core/coap/coap_message.cpp                                  \
     src/core/coap/coap_secure.cpp                                   \
+    src/core/common/binary_log.cpp                                  \
     src/core/common/crc16.cpp                                       \
     src/core/common/error.cpp                                       \
     src/core/common/heap_string.cpp                                 \
@@ -268,6 +270,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/meshcop/meshcop_leader.cpp                             \
     src/core/meshcop/meshcop_tlvs.cpp                               \
     src/core/meshcop/panid_query_client.cpp                         \
+    src/core/meshcop/pskc_generator.cpp                             \
     src/core/meshcop/timestamp.cpp                                  \
     src/core/net/checksum.cpp                                       \
     src/core/net/dhcp6_client.cpp                                   \
@@ -344,6 +347,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/utils/lookup_table.cpp                                 \
     src/core/utils/otns.cpp                                         \
     src/core/utils/parse_cmdline.cpp                                \
+    src/core/utils/packet_trace.cpp                                 \
     src/core/utils/ping_sender.cpp                                  \
     src/core/utils/slaac_address.cpp                                \
     src/core/utils/srp_client_buffers.cpp                           \
@@ -355,7 +359,9 @@ LOCAL_SRC_FILES                                                  := \
     src/lib/url/url.cpp                                             \
     src/posix/platform/alarm.cpp                                    \
     src/posix/platform/backbone.cpp                                 \
+    src/posix/platform/binary_log_writer.cpp                        \
     src/posix/platform/daemon.cpp                                   \
+    src/posix/platform/ecdsa.cpp                                    \
     src/posix/platform/entropy.cpp                                  \
     src/posix/platform/hdlc_interface.cpp                           \
     src/posix/platform/infra_if.cpp                                 \
@@ -365,6 +371,8 @@ LOCAL_SRC_FILES                                                  := \
     src/posix/platform/misc.cpp                                     \
     src/posix/platform/multicast_routing.cpp                        \
     src/posix/platform/netif.cpp                                    \
+    src/posix/platform/packet_trace_writer.cpp                      \
+    src/posix/platform/pskc.cpp                                     \
     src/posix/platform/radio.cpp                                    \
     src/posix/platform/radio_url.cpp                                \
     src/posix/platform/settings.cpp                                 \
@@ -153,6 +153,7 @@
  * @{
  *
  * @defgroup plat-alarm               Alarm
+ * @defgroup plat-ecdsa               ECDSA Verification
  * @defgroup plat-entropy             Entropy
  * @defgroup plat-factory-diagnostics Factory Diagnostics
  * @defgroup plat-logging             Logging
@@ -160,6 +161,7 @@
  * @defgroup plat-messagepool         Message Pool
  * @defgroup plat-misc                Miscellaneous
  * @defgroup plat-otns                Network Simulator
+ * @defgroup plat-pskc                PSKc Generation
  * @defgroup plat-radio               Radio
  * @defgroup plat-settings            Settings
  * @defgroup plat-spi-slave           SPI Slave
@@ -199,4 +199,24 @@
 #define OPENTHREAD_CONFIG_CLI_UART_RX_BUFFER_SIZE 640
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+ *
+ * Define to 1 to enable DTLS session resumption for EC-JPAKE sessions.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+ *
+ * Define to 1 to enable large frames on TREL radio link.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+#define OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_SIMULATION_CONFIG_H_
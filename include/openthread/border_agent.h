@@ -62,6 +62,19 @@ typedef enum otBorderAgentState
     OT_BORDER_AGENT_STATE_ACTIVE  = 2, ///< Border agent is connected with external commissioner.
 } otBorderAgentState;
 
+/**
+ * This structure represents the DTLS handshake counters of the Border Agent.
+ *
+ * The counters cover the DTLS sessions of the Thread Management Framework secure transport, which is shared by the
+ * Border Agent, the Commissioner and the Joiner.
+ *
+ */
+typedef struct otBorderAgentHandshakeCounters
+{
+    uint32_t mFullHandshakes;    ///< Number of handshakes completed with a full EC-JPAKE exchange.
+    uint32_t mResumedHandshakes; ///< Number of handshakes completed by resuming a cached DTLS session.
+} otBorderAgentHandshakeCounters;
+
 /**
  * This function gets the state of Thread Border Agent role.
  *
@@ -82,6 +95,23 @@ otBorderAgentState otBorderAgentGetState(otInstance *aInstance);
  */
 uint16_t otBorderAgentGetUdpPort(otInstance *aInstance);
 
+/**
+ * This function gets the DTLS handshake counters of the Border Agent.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aCounters  A pointer to where the handshake counters are placed.
+ *
+ */
+void otBorderAgentGetHandshakeCounters(otInstance *aInstance, otBorderAgentHandshakeCounters *aCounters);
+
+/**
+ * This function resets the DTLS handshake counters of the Border Agent.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otBorderAgentResetHandshakeCounters(otInstance *aInstance);
+
 /**
  * @}
  *
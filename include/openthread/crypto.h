@@ -56,6 +56,9 @@ extern "C" {
 
 #define OT_CRYPTO_SHA256_HASH_SIZE 32 ///< Length of SHA256 hash (in bytes).
 
+#define OT_CRYPTO_ECDSA_P256_PUBLIC_KEY_SIZE 64 ///< Length of an ECDSA P-256 public key (in bytes).
+#define OT_CRYPTO_ECDSA_P256_SIGNATURE_SIZE 64  ///< Length of an ECDSA P-256 signature (in bytes).
+
 /**
  * @struct otCryptoSha256Hash
  *
@@ -145,6 +148,32 @@ otError otCryptoEcdsaSign(uint8_t *      aOutput,
                           const uint8_t *aPrivateKey,
                           uint16_t       aPrivateKeyLength);
 
+/**
+ * This method verifies an ECDSA signature using NIST P-256 curve.
+ *
+ * This function can be called from a thread other than the OpenThread processing thread only if the memory allocation
+ * used by mbedTLS is thread-safe (e.g. `OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE` with a thread-safe `otPlatCAlloc()`).
+ *
+ * @param[in]  aPublicKey          The public key as an uncompressed curve point (X followed by Y).
+ * @param[in]  aPublicKeyLength    The length of the @p aPublicKey buffer.
+ * @param[in]  aInputHash          The SHA-256 hash of the signed message.
+ * @param[in]  aInputHashLength    The length of the @p aInputHash buffer.
+ * @param[in]  aSignature          The signature (R followed by S).
+ * @param[in]  aSignatureLength    The length of the @p aSignature buffer.
+ *
+ * @retval  OT_ERROR_NONE          The signature was verified successfully.
+ * @retval  OT_ERROR_SECURITY      The signature is invalid.
+ * @retval  OT_ERROR_INVALID_ARGS  The public key, hash or signature is not valid.
+ * @retval  OT_ERROR_NO_BUFS       Failed to allocate buffer for signature verification.
+ *
+ */
+otError otCryptoEcdsaVerify(const uint8_t *aPublicKey,
+                            uint16_t       aPublicKeyLength,
+                            const uint8_t *aInputHash,
+                            uint16_t       aInputHashLength,
+                            const uint8_t *aSignature,
+                            uint16_t       aSignatureLength);
+
 /**
  * @}
  *
@@ -517,6 +517,56 @@ otError otDatasetGeneratePskc(const char *           aPassPhrase,
                               const otExtendedPanId *aExtPanId,
                               otPskc *               aPskc);
 
+/**
+ * This function pointer is called when an asynchronous PSKc generation completes.
+ *
+ * @param[in]  aError    OT_ERROR_NONE if the PSKc was generated, or the error which caused the generation to fail.
+ * @param[in]  aPskc     A pointer to the generated PSKc, or NULL if @p aError is not OT_ERROR_NONE.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+typedef void (*otDatasetGeneratePskcCallback)(otError aError, const otPskc *aPskc, void *aContext);
+
+/**
+ * This function generates PSKc asynchronously from a given pass-phrase, network name, and extended PAN ID.
+ *
+ * The PSKc derivation is computationally expensive. When the platform supports it, the derivation runs outside of the
+ * OpenThread processing, which then keeps servicing the network while the PSKc is generated. The most recently
+ * generated PSKc values are cached, so a request for a (pass-phrase, network name, extended PAN ID) tuple that was
+ * recently generated completes without a new derivation.
+ *
+ * Only one request can be outstanding at a time. @p aCallback is always invoked asynchronously, after this function
+ * returns, unless the request is canceled using `otDatasetCancelGeneratePskc()`.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aPassPhrase   The commissioning pass-phrase.
+ * @param[in]  aNetworkName  The network name for PSKc computation.
+ * @param[in]  aExtPanId     The extended PAN ID for PSKc computation.
+ * @param[in]  aCallback     A pointer to the function called when the generation completes.
+ * @param[in]  aContext      A pointer to application-specific context.
+ *
+ * @retval OT_ERROR_NONE          Successfully started the PSKc generation.
+ * @retval OT_ERROR_INVALID_ARGS  If any of the input arguments is invalid.
+ * @retval OT_ERROR_BUSY          A previous request is still outstanding.
+ *
+ */
+otError otDatasetGeneratePskcAsync(otInstance *                  aInstance,
+                                   const char *                  aPassPhrase,
+                                   const otNetworkName *         aNetworkName,
+                                   const otExtendedPanId *       aExtPanId,
+                                   otDatasetGeneratePskcCallback aCallback,
+                                   void *                        aContext);
+
+/**
+ * This function cancels an outstanding asynchronous PSKc generation request.
+ *
+ * The callback of the canceled request is not invoked. This function does nothing if no request is outstanding.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otDatasetCancelGeneratePskc(otInstance *aInstance);
+
 /**
  * This function sets an `otNetworkName` instance from a given null terminated C string.
  *
@@ -392,16 +392,6 @@ typedef struct otActiveScanResult
     bool            mIsJoinable : 1; ///< Joining Permitted flag
 } otActiveScanResult;
 
-/**
- * This structure represents an energy scan result.
- *
- */
-typedef struct otEnergyScanResult
-{
-    uint8_t mChannel; ///< IEEE 802.15.4 Channel
-    int8_t  mMaxRssi; ///< The max RSSI (dBm)
-} otEnergyScanResult;
-
 /**
  * This function pointer is called during an IEEE 802.15.4 Active Scan when an IEEE 802.15.4 Beacon is received or
  * the scan completes.
@@ -35,6 +35,8 @@
 #ifndef OPENTHREAD_LOGGING_H_
 #define OPENTHREAD_LOGGING_H_
 
+#include <stdint.h>
+
 #include <openthread/error.h>
 #include <openthread/platform/logging.h>
 
@@ -76,6 +78,33 @@ otLogLevel otLoggingGetLevel(void);
  */
 otError otLoggingSetLevel(otLogLevel aLogLevel);
 
+/**
+ * This function reads (and removes) complete records from the binary log ring buffer.
+ *
+ * Each record is encoded as described in `src/core/common/binary_log.hpp` and can be decoded offline using
+ * `tools/otlog/otlog_decode.py`. There must be a single reader, which may run in a different thread from the one
+ * generating the logs.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @param[out] aBuffer        A pointer to a buffer to output the records.
+ * @param[in]  aBufferLength  The size of @p aBuffer (number of bytes).
+ *
+ * @returns The number of bytes written to @p aBuffer, zero if there is no complete record which fits.
+ *
+ */
+uint16_t otLoggingReadBinary(uint8_t *aBuffer, uint16_t aBufferLength);
+
+/**
+ * This function returns the number of binary log records dropped because the ring buffer was full.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @returns The number of dropped binary log records.
+ *
+ */
+uint32_t otLoggingGetBinaryDroppedCount(void);
+
 /**
  * @}
  *
@@ -86,6 +86,40 @@ typedef struct otBufferInfo
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
 } otBufferInfo;
 
+#define OT_MESSAGE_POOL_STATS_NUM_PRIORITIES 4    ///< Number of priority levels (including network control).
+#define OT_MESSAGE_POOL_STATS_NUM_TYPES 5         ///< Number of message types.
+#define OT_MESSAGE_POOL_STATS_NUM_SUB_TYPES 16    ///< Number of message sub types.
+#define OT_MESSAGE_POOL_STATS_NUM_BUFFER_BINS 8   ///< Number of bins in the buffers per message histogram.
+#define OT_MESSAGE_POOL_STATS_NUM_LIFETIME_BINS 6 ///< Number of bins in the message lifetime histogram.
+
+/**
+ * This structure represents the message pool occupancy statistics.
+ *
+ * Message types and sub types are the internal OpenThread classification of messages (e.g., IPv6, 6LoWPAN, MLE
+ * Announce, Joiner Entrust).
+ *
+ * In `mBufferCountHistogram`, bin `i` counts the freed messages that were using `i + 1` buffers, the last bin also
+ * counts all larger messages. In `mLifetimeHistogram`, the bins count the freed messages whose lifetime was less than
+ * 10 ms, 100 ms, 1 s, 10 s, 100 s, and 100 s or more, respectively.
+ *
+ */
+typedef struct otMessagePoolStats
+{
+    uint16_t mBuffersInUse;                                                ///< Number of buffers currently in use.
+    uint16_t mMaxBuffersInUse;                                             ///< High-water mark of buffers in use.
+    uint16_t mMessagesInUse;                                               ///< Number of messages currently allocated.
+    uint16_t mMaxMessagesInUse;                                            ///< High-water mark of allocated messages.
+    uint16_t m6loSendQueueMaxMessages;                                     ///< High-water mark of the 6lo send queue.
+    uint16_t mIp6SendQueueMaxMessages;                                     ///< High-water mark of the IPv6 send queue.
+    uint32_t mAllocFailures[OT_MESSAGE_POOL_STATS_NUM_PRIORITIES];         ///< Allocation failures, per priority.
+    uint16_t mTypeMessages[OT_MESSAGE_POOL_STATS_NUM_TYPES];               ///< Messages allocated, per type.
+    uint16_t mMaxTypeMessages[OT_MESSAGE_POOL_STATS_NUM_TYPES];            ///< High-water mark, per type.
+    uint16_t mSubTypeMessages[OT_MESSAGE_POOL_STATS_NUM_SUB_TYPES];        ///< Messages allocated, per sub type.
+    uint16_t mMaxSubTypeMessages[OT_MESSAGE_POOL_STATS_NUM_SUB_TYPES];     ///< High-water mark, per sub type.
+    uint32_t mBufferCountHistogram[OT_MESSAGE_POOL_STATS_NUM_BUFFER_BINS]; ///< Histogram of buffers per message.
+    uint32_t mLifetimeHistogram[OT_MESSAGE_POOL_STATS_NUM_LIFETIME_BINS];  ///< Histogram of message lifetime.
+} otMessagePoolStats;
+
 /**
  * This enumeration defines the OpenThread message priority levels.
  *
@@ -269,6 +303,25 @@ otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
  */
 uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf, uint16_t aLength);
 
+/**
+ * Get a pointer to the contiguous message content starting at a given offset.
+ *
+ * The message content is stored in a chain of buffers. This function gives direct access to the part of the content
+ * at @p aOffset that is stored contiguously, so that a whole message can be read without copying it by repeatedly
+ * calling this function and moving the offset by the returned length. The returned data stays valid until the message
+ * is modified or freed.
+ *
+ * @param[in]  aMessage  A pointer to a message buffer.
+ * @param[in]  aOffset   An offset in bytes.
+ * @param[out] aData     A pointer to output the start of the contiguous data.
+ *
+ * @returns The number of contiguous bytes available at @p aData, or zero if @p aOffset is beyond the message end.
+ *
+ * @sa otMessageRead
+ *
+ */
+uint16_t otMessageGetContiguousBytes(const otMessage *aMessage, uint16_t aOffset, const uint8_t **aData);
+
 /**
  * Write bytes to a message.
  *
@@ -368,6 +421,30 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Get the message pool occupancy statistics.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE`.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ * @param[out]  aStats     A pointer where the message pool statistics are written.
+ *
+ */
+void otMessageGetPoolStats(otInstance *aInstance, otMessagePoolStats *aStats);
+
+/**
+ * Reset the message pool occupancy statistics.
+ *
+ * The high-water marks are set to the current occupancy, and the allocation failure counters and histograms are
+ * cleared.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE`.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetPoolStats(otInstance *aInstance);
+
 /**
  * @}
  *
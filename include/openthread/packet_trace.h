@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the packet trace module.
+ */
+
+#ifndef OPENTHREAD_PACKET_TRACE_H_
+#define OPENTHREAD_PACKET_TRACE_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-packet-trace
+ *
+ * @brief
+ *   This module includes functions for reading the per-packet trace of the mesh data path.
+ *
+ *   The functions in this module are available when packet trace feature
+ *   (`OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE`) is enabled.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This enumeration defines the packet trace event types.
+ *
+ */
+typedef enum otPacketTraceEventType
+{
+    OT_PACKET_TRACE_EVENT_IP6_SEND      = 0,  ///< IPv6 datagram queued by `Ip6` (queue depth: IPv6 send queue).
+    OT_PACKET_TRACE_EVENT_ENQUEUE       = 1,  ///< Message queued in `MeshForwarder` (queue depth: send queue).
+    OT_PACKET_TRACE_EVENT_ADDRESS_QUERY = 2,  ///< Message held waiting for address resolution.
+    OT_PACKET_TRACE_EVENT_ROUTE         = 3,  ///< Route (next hop) resolved for direct transmission.
+    OT_PACKET_TRACE_EVENT_INDIRECT_HOLD = 4,  ///< Message held for indirect transmission to a sleepy child.
+    OT_PACKET_TRACE_EVENT_FRAME         = 5,  ///< MAC frame prepared from the message.
+    OT_PACKET_TRACE_EVENT_FRAGMENT      = 6,  ///< MAC frame prepared carrying a 6LoWPAN fragment of the message.
+    OT_PACKET_TRACE_EVENT_CSMA_BACKOFF  = 7,  ///< CSMA backoff started.
+    OT_PACKET_TRACE_EVENT_TX_START      = 8,  ///< Frame handed to the radio for transmission.
+    OT_PACKET_TRACE_EVENT_ACK_WAIT      = 9,  ///< Frame transmitted, waiting for the ack.
+    OT_PACKET_TRACE_EVENT_RETRY         = 10, ///< Frame retransmission.
+    OT_PACKET_TRACE_EVENT_TX_DONE       = 11, ///< Frame transmission completed.
+    OT_PACKET_TRACE_EVENT_DEQUEUE       = 12, ///< Message delivered and removed from the send queue.
+    OT_PACKET_TRACE_EVENT_DROP          = 13, ///< Message dropped.
+    OT_PACKET_TRACE_EVENT_RX_FRAME      = 14, ///< MAC data frame received.
+    OT_PACKET_TRACE_EVENT_RX_DATAGRAM   = 15, ///< IPv6 datagram received and passed to `Ip6`.
+} otPacketTraceEventType;
+
+/**
+ * This structure represents a packet trace event.
+ *
+ */
+typedef struct otPacketTraceEvent
+{
+    uint64_t    mTimestamp;  ///< The time of the event (microseconds, from `otPlatTimeGet()`).
+    const void *mMessage;    ///< The message the event applies to, only used as an identifier (may be NULL).
+    uint16_t    mQueueDepth; ///< The depth of the related queue after the event (when applicable).
+    uint8_t     mEvent;      ///< The event type (`otPacketTraceEventType`).
+} otPacketTraceEvent;
+
+/**
+ * This function reads (and removes) the oldest packet trace events.
+ *
+ * @param[in]   aInstance    A pointer to an OpenThread instance.
+ * @param[out]  aEvents      A pointer to an array to output the events.
+ * @param[in]   aMaxEvents   The maximum number of events to read.
+ *
+ * @returns The number of events written to @p aEvents.
+ *
+ */
+uint16_t otPacketTraceRead(otInstance *aInstance, otPacketTraceEvent *aEvents, uint16_t aMaxEvents);
+
+/**
+ * This function returns the number of packet trace events overwritten before being read.
+ *
+ * @param[in]   aInstance    A pointer to an OpenThread instance.
+ *
+ * @returns The number of lost events.
+ *
+ */
+uint32_t otPacketTraceGetLostCount(otInstance *aInstance);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_PACKET_TRACE_H_
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the platform abstraction for ECDSA signature verification.
+ *
+ */
+
+#ifndef OPENTHREAD_PLATFORM_ECDSA_H_
+#define OPENTHREAD_PLATFORM_ECDSA_H_
+
+#include <stdint.h>
+
+#include <openthread/crypto.h>
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-ecdsa
+ *
+ * @brief
+ *   This module includes the platform abstraction for verifying ECDSA signatures outside of the OpenThread
+ *   processing.
+ *
+ *   These functions are only used when `OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE` is enabled.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This function queues an ECDSA P-256 signature verification.
+ *
+ * The platform verifies the signature (e.g. by calling `otCryptoEcdsaVerify()` from a worker thread) and reports the
+ * result by calling `otPlatEcdsaVerifyDone()` from the OpenThread processing context. The arguments are only valid
+ * for the duration of the call and MUST be copied by the platform.
+ *
+ * @param[in] aInstance    The OpenThread instance structure.
+ * @param[in] aRequestId   The request identifier to pass back in `otPlatEcdsaVerifyDone()`.
+ * @param[in] aPublicKey   The public key (`OT_CRYPTO_ECDSA_P256_PUBLIC_KEY_SIZE` bytes).
+ * @param[in] aHash        The SHA-256 hash of the signed message.
+ * @param[in] aSignature   The signature (`OT_CRYPTO_ECDSA_P256_SIGNATURE_SIZE` bytes).
+ *
+ * @retval OT_ERROR_NONE  Successfully queued the verification, `otPlatEcdsaVerifyDone()` will be called.
+ * @retval OT_ERROR_BUSY  The platform cannot queue more verifications at the moment.
+ *
+ */
+otError otPlatEcdsaVerify(otInstance *              aInstance,
+                          uint32_t                  aRequestId,
+                          const uint8_t *           aPublicKey,
+                          const otCryptoSha256Hash *aHash,
+                          const uint8_t *           aSignature);
+
+/**
+ * This function is called by the platform when a verification queued with `otPlatEcdsaVerify()` completes.
+ *
+ * @param[in] aInstance    The OpenThread instance structure.
+ * @param[in] aRequestId   The request identifier passed in `otPlatEcdsaVerify()`.
+ * @param[in] aError       OT_ERROR_NONE if the signature is valid, OT_ERROR_SECURITY if it is invalid, or the error
+ *                         which caused the verification to fail.
+ *
+ */
+extern void otPlatEcdsaVerifyDone(otInstance *aInstance, uint32_t aRequestId, otError aError);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // end of extern "C"
+#endif
+
+#endif // OPENTHREAD_PLATFORM_ECDSA_H_
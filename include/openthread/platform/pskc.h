@@ -0,0 +1,101 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the platform abstraction for PSKc generation.
+ *
+ */
+
+#ifndef OPENTHREAD_PLATFORM_PSKC_H_
+#define OPENTHREAD_PLATFORM_PSKC_H_
+
+#include <openthread/dataset.h>
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-pskc
+ *
+ * @brief
+ *   This module includes the platform abstraction for generating PSKc outside of the OpenThread processing.
+ *
+ *   These functions are only used when `OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE` is enabled.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This function starts generating a PSKc.
+ *
+ * The platform derives the PSKc (e.g. by calling `otDatasetGeneratePskc()` from a worker thread) and reports the
+ * result by calling `otPlatPskcGenerateDone()` from the OpenThread processing context. The arguments are only valid
+ * for the duration of the call and MUST be copied by the platform.
+ *
+ * OpenThread does not start a new generation before the previous one is reported done.
+ *
+ * @param[in] aInstance     The OpenThread instance structure.
+ * @param[in] aPassPhrase   The commissioning pass-phrase.
+ * @param[in] aNetworkName  The network name for PSKc computation.
+ * @param[in] aExtPanId     The extended PAN ID for PSKc computation.
+ *
+ * @retval OT_ERROR_NONE  Successfully started the PSKc generation, `otPlatPskcGenerateDone()` will be called.
+ * @retval OT_ERROR_BUSY  The platform cannot generate the PSKc at the moment.
+ *
+ */
+otError otPlatPskcGenerate(otInstance *           aInstance,
+                           const char *           aPassPhrase,
+                           const otNetworkName *  aNetworkName,
+                           const otExtendedPanId *aExtPanId);
+
+/**
+ * This function is called by the platform when a PSKc generation started with `otPlatPskcGenerate()` completes.
+ *
+ * @param[in] aInstance  The OpenThread instance structure.
+ * @param[in] aError     OT_ERROR_NONE if the PSKc was generated, or the error which caused the generation to fail.
+ * @param[in] aPskc      A pointer to the generated PSKc, or NULL if @p aError is not OT_ERROR_NONE.
+ *
+ */
+extern void otPlatPskcGenerateDone(otInstance *aInstance, otError aError, const otPskc *aPskc);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // end of extern "C"
+#endif
+
+#endif // OPENTHREAD_PLATFORM_PSKC_H_
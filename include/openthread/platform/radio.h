@@ -111,7 +111,7 @@ enum
  * The value is a bit-field indicating the capabilities supported by the radio. See `OT_RADIO_CAPS_*` definitions.
  *
  */
-typedef uint8_t otRadioCaps;
+typedef uint16_t otRadioCaps;
 
 /**
  * This enumeration defines constants that are used to indicate different radio capabilities. See `otRadioCaps`.
@@ -119,15 +119,16 @@ typedef uint8_t otRadioCaps;
  */
 enum
 {
-    OT_RADIO_CAPS_NONE             = 0,      ///< Radio supports no capability.
-    OT_RADIO_CAPS_ACK_TIMEOUT      = 1 << 0, ///< Radio supports AckTime event.
-    OT_RADIO_CAPS_ENERGY_SCAN      = 1 << 1, ///< Radio supports Energy Scans.
-    OT_RADIO_CAPS_TRANSMIT_RETRIES = 1 << 2, ///< Radio supports tx retry logic with collision avoidance (CSMA).
-    OT_RADIO_CAPS_CSMA_BACKOFF     = 1 << 3, ///< Radio supports CSMA backoff for frame transmission (but no retry).
-    OT_RADIO_CAPS_SLEEP_TO_TX      = 1 << 4, ///< Radio supports direct transition from sleep to TX with CSMA.
-    OT_RADIO_CAPS_TRANSMIT_SEC     = 1 << 5, ///< Radio supports tx security.
-    OT_RADIO_CAPS_TRANSMIT_TIMING  = 1 << 6, ///< Radio supports tx at specific time.
-    OT_RADIO_CAPS_RECEIVE_TIMING   = 1 << 7, ///< Radio supports rx at specific time.
+    OT_RADIO_CAPS_NONE              = 0,      ///< Radio supports no capability.
+    OT_RADIO_CAPS_ACK_TIMEOUT       = 1 << 0, ///< Radio supports AckTime event.
+    OT_RADIO_CAPS_ENERGY_SCAN       = 1 << 1, ///< Radio supports Energy Scans.
+    OT_RADIO_CAPS_TRANSMIT_RETRIES  = 1 << 2, ///< Radio supports tx retry logic with collision avoidance (CSMA).
+    OT_RADIO_CAPS_CSMA_BACKOFF      = 1 << 3, ///< Radio supports CSMA backoff for frame transmission (but no retry).
+    OT_RADIO_CAPS_SLEEP_TO_TX       = 1 << 4, ///< Radio supports direct transition from sleep to TX with CSMA.
+    OT_RADIO_CAPS_TRANSMIT_SEC      = 1 << 5, ///< Radio supports tx security.
+    OT_RADIO_CAPS_TRANSMIT_TIMING   = 1 << 6, ///< Radio supports tx at specific time.
+    OT_RADIO_CAPS_RECEIVE_TIMING    = 1 << 7, ///< Radio supports rx at specific time.
+    OT_RADIO_CAPS_MULTI_ENERGY_SCAN = 1 << 8, ///< Radio supports Energy Scans of multiple channels at once.
 };
 
 #define OT_PANID_BROADCAST 0xffff ///< IEEE 802.15.4 Broadcast PAN ID
@@ -357,6 +358,16 @@ typedef struct otLinkMetrics
     bool mReserved : 1;   ///< Reserved, this is for reference device.
 } otLinkMetrics;
 
+/**
+ * This structure represents an energy scan result.
+ *
+ */
+typedef struct otEnergyScanResult
+{
+    uint8_t mChannel; ///< IEEE 802.15.4 Channel
+    int8_t  mMaxRssi; ///< The max RSSI (dBm)
+} otEnergyScanResult;
+
 /**
  * @}
  *
@@ -832,6 +843,39 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
  */
 extern void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
 
+/**
+ * Begin the energy scan sequence of multiple channels on the radio.
+ *
+ * The radio may scan the channels concurrently (e.g., using multiple receivers) or one after the other as a single
+ * operation. The results for all channels are reported at once when the scan completes.
+ *
+ * This function is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability.
+ *
+ * @param[in] aInstance      The OpenThread instance structure.
+ * @param[in] aScanChannels  A bit-vector indicating the channels to perform the energy scan on.
+ * @param[in] aScanDuration  The duration, in milliseconds, for each channel to be scanned. Zero indicates a single
+ *                           RSSI sample on each channel.
+ *
+ * @retval OT_ERROR_NONE             Successfully started scanning the channels.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio doesn't support multi-channel energy scanning.
+ *
+ */
+otError otPlatRadioMultiChannelEnergyScan(otInstance *aInstance, uint32_t aScanChannels, uint16_t aScanDuration);
+
+/**
+ * The radio driver calls this method to notify OpenThread that the multi-channel energy scan is complete.
+ *
+ * This function is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aResults     A pointer to an array with the results of the scanned channels.
+ * @param[in]  aNumResults  The number of entries in @p aResults.
+ *
+ */
+extern void otPlatRadioMultiChannelEnergyScanDone(otInstance *              aInstance,
+                                                  const otEnergyScanResult *aResults,
+                                                  uint8_t                   aNumResults);
+
 /**
  * Enable/Disable source address match feature.
  *
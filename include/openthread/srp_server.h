@@ -85,6 +85,24 @@ typedef struct otSrpServerLeaseConfig
     uint32_t mMaxKeyLease; ///< The maximum KEY-LEASE interval in seconds.
 } otSrpServerLeaseConfig;
 
+/**
+ * This structure includes SRP server signature verification counters.
+ *
+ * Latency is measured from the reception of a SRP update until its signature verification completes.
+ *
+ */
+typedef struct otSrpServerVerificationCounters
+{
+    uint32_t mVerified;     ///< The number of SRP updates with a valid signature.
+    uint32_t mFailed;       ///< The number of SRP updates whose signature failed verification.
+    uint32_t mKeyCacheHits; ///< The number of verifications using a public key already prepared for the host.
+    uint32_t mOffloaded;    ///< The number of verifications performed by the platform.
+    uint32_t mTotalLatency; ///< The sum of verification latencies in milliseconds.
+    uint32_t mMaxLatency;   ///< The maximum verification latency in milliseconds.
+    uint16_t mBacklog;      ///< The number of SRP updates currently waiting for signature verification.
+    uint16_t mMaxBacklog;   ///< The maximum number of SRP updates waiting for signature verification.
+} otSrpServerVerificationCounters;
+
 /**
  * This function returns the domain authorized to the SRP server.
  *
@@ -150,6 +168,26 @@ void otSrpServerGetLeaseConfig(otInstance *aInstance, otSrpServerLeaseConfig *aL
  */
 otError otSrpServerSetLeaseConfig(otInstance *aInstance, const otSrpServerLeaseConfig *aLeaseConfig);
 
+/**
+ * This function returns the signature verification counters of the SRP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the signature verification counters.
+ *
+ */
+const otSrpServerVerificationCounters *otSrpServerGetVerificationCounters(otInstance *aInstance);
+
+/**
+ * This function resets the signature verification counters of the SRP server.
+ *
+ * The current backlog is kept and becomes the new maximum backlog.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otSrpServerResetVerificationCounters(otInstance *aInstance);
+
 /**
  * This function handles SRP service updates.
  *
@@ -179,6 +179,9 @@ typedef struct otMleCounters
      *
      */
     uint16_t mParentChanges;
+
+    uint16_t mAdvertisementsProcessed; ///< Number of MLE Advertisements whose Route TLV was fully processed.
+    uint16_t mAdvertisementsSkipped;   ///< Number of MLE Advertisements skipped due to an unchanged Route TLV.
 } otMleCounters;
 
 /**
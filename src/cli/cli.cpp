@@ -324,6 +324,14 @@ otError Interpreter::ProcessBorderAgent(uint8_t aArgsLength, Arg aArgs[])
     {
         OutputLine("%hu", otBorderAgentGetUdpPort(mInstance));
     }
+    else if (aArgs[0] == "counters")
+    {
+        otBorderAgentHandshakeCounters counters;
+
+        otBorderAgentGetHandshakeCounters(mInstance, &counters);
+        OutputLine("full handshakes: %u", counters.mFullHandshakes);
+        OutputLine("resumed handshakes: %u", counters.mResumedHandshakes);
+    }
     else if (aArgs[0] == "state")
     {
         const char *state;
@@ -656,7 +664,6 @@ exit:
 
 otError Interpreter::ProcessBufferInfo(uint8_t aArgsLength, Arg aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgsLength);
     OT_UNUSED_VARIABLE(aArgs);
 
     struct BufferInfoName
@@ -678,21 +685,61 @@ otError Interpreter::ProcessBufferInfo(uint8_t aArgsLength, Arg aArgs[])
         {&otBufferInfo::mApplicationCoapMessages, &otBufferInfo::mApplicationCoapBuffers, "application coap"},
     };
 
-    otBufferInfo bufferInfo;
+    otError error = OT_ERROR_NONE;
 
-    otMessageGetBufferInfo(mInstance, &bufferInfo);
+    if (aArgsLength == 0)
+    {
+        otBufferInfo bufferInfo;
 
-    OutputLine("total: %d", bufferInfo.mTotalBuffers);
-    OutputLine("free: %d", bufferInfo.mFreeBuffers);
+        otMessageGetBufferInfo(mInstance, &bufferInfo);
 
-    for (const BufferInfoName &info : kBufferInfoNames)
+        OutputLine("total: %d", bufferInfo.mTotalBuffers);
+        OutputLine("free: %d", bufferInfo.mFreeBuffers);
+
+        for (const BufferInfoName &info : kBufferInfoNames)
+        {
+            OutputLine("%s: %d %d", info.mName, bufferInfo.*info.mNumMessagesPtr, bufferInfo.*info.mNumBuffersPtr);
+        }
+    }
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    else if ((aArgsLength == 1) && (aArgs[0] == "stats"))
+    {
+        OutputPoolStats();
+    }
+    else if ((aArgsLength == 2) && (aArgs[0] == "stats") && (aArgs[1] == "reset"))
     {
-        OutputLine("%s: %d %d", info.mName, bufferInfo.*info.mNumMessagesPtr, bufferInfo.*info.mNumBuffersPtr);
+        otMessageResetPoolStats(mInstance);
+    }
+#endif
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
     }
 
-    return OT_ERROR_NONE;
+    return error;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+void Interpreter::OutputPoolStats(void)
+{
+    otMessagePoolStats stats;
+
+    otMessageGetPoolStats(mInstance, &stats);
+
+    OutputLine("buffers: %u (max %u)", stats.mBuffersInUse, stats.mMaxBuffersInUse);
+    OutputLine("messages: %u (max %u)", stats.mMessagesInUse, stats.mMaxMessagesInUse);
+    OutputLine("6lo send max: %u", stats.m6loSendQueueMaxMessages);
+    OutputLine("ip6 send max: %u", stats.mIp6SendQueueMaxMessages);
+    OutputPoolStatsArray("alloc failures", stats.mAllocFailures);
+    OutputPoolStatsArray("type", stats.mTypeMessages);
+    OutputPoolStatsArray("type max", stats.mMaxTypeMessages);
+    OutputPoolStatsArray("subtype", stats.mSubTypeMessages);
+    OutputPoolStatsArray("subtype max", stats.mMaxSubTypeMessages);
+    OutputPoolStatsArray("buffers per msg", stats.mBufferCountHistogram);
+    OutputPoolStatsArray("lifetime", stats.mLifetimeHistogram);
+}
+#endif
+
 otError Interpreter::ProcessCcaThreshold(uint8_t aArgsLength, Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -1235,6 +1282,8 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, Arg aArgs[])
                 {&otMleCounters::mPartitionIdChanges, "Partition Id Changes"},
                 {&otMleCounters::mBetterPartitionAttachAttempts, "Better Partition Attach Attempts"},
                 {&otMleCounters::mParentChanges, "Parent Changes"},
+                {&otMleCounters::mAdvertisementsProcessed, "Advertisements Processed"},
+                {&otMleCounters::mAdvertisementsSkipped, "Advertisements Skipped"},
             };
 
             const otMleCounters *mleCounters = otThreadGetMleCounters(mInstance);
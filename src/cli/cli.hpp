@@ -422,6 +422,22 @@ private:
     otError ProcessHelp(uint8_t aArgsLength, Arg aArgs[]);
     otError ProcessCcaThreshold(uint8_t aArgsLength, Arg aArgs[]);
     otError ProcessBufferInfo(uint8_t aArgsLength, Arg aArgs[]);
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    void OutputPoolStats(void);
+
+    template <typename UintType, uint8_t kLength>
+    void OutputPoolStatsArray(const char *aName, const UintType (&aValues)[kLength])
+    {
+        OutputFormat("%s:", aName);
+
+        for (UintType value : aValues)
+        {
+            OutputFormat(" %lu", static_cast<unsigned long>(value));
+        }
+
+        OutputLine("");
+    }
+#endif
     otError ProcessChannel(uint8_t aArgsLength, Arg aArgs[]);
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
     otError ProcessBorderAgent(uint8_t aArgsLength, Arg aArgs[]);
@@ -240,6 +240,35 @@ exit:
     return error;
 }
 
+otError SrpServer::ProcessVerification(uint8_t aArgsLength, Arg aArgs[])
+{
+    otError                                error = OT_ERROR_NONE;
+    const otSrpServerVerificationCounters *counters;
+
+    if (aArgsLength == 0)
+    {
+        counters = otSrpServerGetVerificationCounters(mInterpreter.mInstance);
+        mInterpreter.OutputLine("verified: %u", counters->mVerified);
+        mInterpreter.OutputLine("failed: %u", counters->mFailed);
+        mInterpreter.OutputLine("key cache hits: %u", counters->mKeyCacheHits);
+        mInterpreter.OutputLine("offloaded: %u", counters->mOffloaded);
+        mInterpreter.OutputLine("total latency: %u", counters->mTotalLatency);
+        mInterpreter.OutputLine("max latency: %u", counters->mMaxLatency);
+        mInterpreter.OutputLine("backlog: %u", counters->mBacklog);
+        mInterpreter.OutputLine("max backlog: %u", counters->mMaxBacklog);
+    }
+    else if ((aArgsLength == 1) && (aArgs[0] == "reset"))
+    {
+        otSrpServerResetVerificationCounters(mInterpreter.mInstance);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
 otError SrpServer::ProcessHelp(uint8_t aArgsLength, Arg aArgs[])
 {
     OT_UNUSED_VARIABLE(aArgsLength);
@@ -93,6 +93,7 @@ private:
     otError ProcessLease(uint8_t aArgsLength, Arg aArgs[]);
     otError ProcessHost(uint8_t aArgsLength, Arg aArgs[]);
     otError ProcessService(uint8_t aArgsLength, Arg aArgs[]);
+    otError ProcessVerification(uint8_t aArgsLength, Arg aArgs[]);
     otError ProcessHelp(uint8_t aArgsLength, Arg aArgs[]);
 
     void OutputHostAddresses(const otSrpServerHost *aHost);
@@ -101,7 +102,7 @@ private:
         {"disable", &SrpServer::ProcessDisable}, {"domain", &SrpServer::ProcessDomain},
         {"enable", &SrpServer::ProcessEnable},   {"help", &SrpServer::ProcessHelp},
         {"host", &SrpServer::ProcessHost},       {"lease", &SrpServer::ProcessLease},
-        {"service", &SrpServer::ProcessService},
+        {"service", &SrpServer::ProcessService}, {"verification", &SrpServer::ProcessVerification},
     };
 
     static_assert(Utils::LookupTable::IsSorted(sCommands), "Command Table is not sorted");
@@ -56,4 +56,21 @@ uint16_t otBorderAgentGetUdpPort(otInstance *aInstance)
     return instance.Get<MeshCoP::BorderAgent>().GetUdpPort();
 }
 
+void otBorderAgentGetHandshakeCounters(otInstance *aInstance, otBorderAgentHandshakeCounters *aCounters)
+{
+    Instance &                              instance = *static_cast<Instance *>(aInstance);
+    const MeshCoP::Dtls::HandshakeCounters &counters =
+        instance.Get<Coap::CoapSecure>().GetDtls().GetHandshakeCounters();
+
+    aCounters->mFullHandshakes    = counters.mFull;
+    aCounters->mResumedHandshakes = counters.mResumed;
+}
+
+void otBorderAgentResetHandshakeCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Coap::CoapSecure>().GetDtls().ResetHandshakeCounters();
+}
+
 #endif // OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
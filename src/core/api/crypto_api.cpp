@@ -103,4 +103,28 @@ otError otCryptoEcdsaSign(uint8_t *      aOutput,
     return Ecdsa::Sign(aOutput, *aOutputLength, aInputHash, aInputHashLength, aPrivateKey, aPrivateKeyLength);
 }
 
+otError otCryptoEcdsaVerify(const uint8_t *aPublicKey,
+                            uint16_t       aPublicKeyLength,
+                            const uint8_t *aInputHash,
+                            uint16_t       aInputHashLength,
+                            const uint8_t *aSignature,
+                            uint16_t       aSignatureLength)
+{
+    static_assert(OT_CRYPTO_ECDSA_P256_PUBLIC_KEY_SIZE == Ecdsa::P256::PublicKey::kSize, "public key size mismatch");
+    static_assert(OT_CRYPTO_ECDSA_P256_SIGNATURE_SIZE == Ecdsa::P256::Signature::kSize, "signature size mismatch");
+
+    otError error = OT_ERROR_INVALID_ARGS;
+
+    VerifyOrExit((aPublicKey != nullptr) && (aPublicKeyLength == Ecdsa::P256::PublicKey::kSize));
+    VerifyOrExit((aInputHash != nullptr) && (aInputHashLength == Sha256::Hash::kSize));
+    VerifyOrExit((aSignature != nullptr) && (aSignatureLength == Ecdsa::P256::Signature::kSize));
+
+    error = reinterpret_cast<const Ecdsa::P256::PublicKey *>(aPublicKey)
+                ->Verify(*reinterpret_cast<const Sha256::Hash *>(aInputHash),
+                         *reinterpret_cast<const Ecdsa::P256::Signature *>(aSignature));
+
+exit:
+    return error;
+}
+
 #endif // OPENTHREAD_CONFIG_ECDSA_ENABLE
@@ -176,6 +176,28 @@ otError otDatasetGeneratePskc(const char *           aPassPhrase,
     return MeshCoP::GeneratePskc(aPassPhrase, *static_cast<const Mac::NetworkName *>(aNetworkName),
                                  *static_cast<const Mac::ExtendedPanId *>(aExtPanId), *static_cast<Pskc *>(aPskc));
 }
+
+otError otDatasetGeneratePskcAsync(otInstance *                  aInstance,
+                                   const char *                  aPassPhrase,
+                                   const otNetworkName *         aNetworkName,
+                                   const otExtendedPanId *       aExtPanId,
+                                   otDatasetGeneratePskcCallback aCallback,
+                                   void *                        aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<MeshCoP::PskcGenerator>().Generate(aPassPhrase,
+                                                           *static_cast<const Mac::NetworkName *>(aNetworkName),
+                                                           *static_cast<const Mac::ExtendedPanId *>(aExtPanId),
+                                                           aCallback, aContext);
+}
+
+void otDatasetCancelGeneratePskc(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshCoP::PskcGenerator>().Cancel();
+}
 #endif // OPENTHREAD_FTD
 
 otError otNetworkNameFromString(otNetworkName *aNetworkName, const char *aNameString)
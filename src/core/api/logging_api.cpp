@@ -34,6 +34,8 @@
 #include "openthread-core-config.h"
 
 #include <openthread/logging.h>
+
+#include "common/binary_log.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 
@@ -65,3 +67,15 @@ otError otLoggingSetLevel(otLogLevel aLogLevel)
     return error;
 }
 #endif
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+uint16_t otLoggingReadBinary(uint8_t *aBuffer, uint16_t aBufferLength)
+{
+    return BinaryLog::Read(aBuffer, aBufferLength);
+}
+
+uint32_t otLoggingGetBinaryDroppedCount(void)
+{
+    return BinaryLog::GetDroppedCount();
+}
+#endif
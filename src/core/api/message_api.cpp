@@ -107,6 +107,12 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
     return message.ReadBytes(aOffset, aBuf, aLength);
 }
 
+uint16_t otMessageGetContiguousBytes(const otMessage *aMessage, uint16_t aOffset, const uint8_t **aData)
+{
+    const Message &message = *static_cast<const Message *>(aMessage);
+    return message.GetContiguousBytes(aOffset, *aData);
+}
+
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
     Message &message = *static_cast<Message *>(aMessage);
@@ -180,6 +186,12 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
+#if OPENTHREAD_FTD
+    instance.Get<MeshForwarder>().GetIndirectSendQueue().GetInfo(messages, buffers);
+    aBufferInfo->m6loSendMessages += messages;
+    aBufferInfo->m6loSendBuffers += buffers;
+#endif
+
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
                                                                aBufferInfo->m6loReassemblyBuffers);
 
@@ -228,4 +240,20 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+void otMessageGetPoolStats(otInstance *aInstance, otMessagePoolStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().GetStats(*aStats);
+}
+
+void otMessageResetPoolStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().ResetStats();
+}
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -77,6 +77,20 @@ otError otSrpServerSetLeaseConfig(otInstance *aInstance, const otSrpServerLeaseC
     return instance.Get<Srp::Server>().SetLeaseConfig(static_cast<const Srp::Server::LeaseConfig &>(*aLeaseConfig));
 }
 
+const otSrpServerVerificationCounters *otSrpServerGetVerificationCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Srp::Server>().GetVerificationCounters();
+}
+
+void otSrpServerResetVerificationCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Srp::Server>().ResetVerificationCounters();
+}
+
 void otSrpServerSetServiceUpdateHandler(otInstance *                    aInstance,
                                         otSrpServerServiceUpdateHandler aServiceHandler,
                                         void *                          aContext)
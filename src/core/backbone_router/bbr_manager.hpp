@@ -62,6 +62,8 @@ class Manager : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadBackboneRouterStateChanged;
+
 public:
     /**
      * This constructor initializes the Backbone Router manager.
@@ -73,6 +73,8 @@ class RoutingManager : public InstanceLocator
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadNetdataChanged;
+
 public:
     /**
      * This constructor initializes the routing manager.
@@ -0,0 +1,354 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the compact binary log ring buffer.
+ */
+
+#include "binary_log.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#include <stddef.h>
+#include <string.h>
+
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+
+using ot::Encoding::LittleEndian::WriteUint32;
+using ot::Encoding::LittleEndian::WriteUint64;
+
+/**
+ * The Format ID in a binary log record is the offset of the format string from this symbol.
+ *
+ */
+extern "C" const char otLogBinaryFormatAnchor[] = "";
+
+namespace ot {
+
+static_assert((OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE & (OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE - 1)) == 0,
+              "OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE must be a power of two");
+
+uint8_t  BinaryLog::sBuffer[kBufferSize];
+uint32_t BinaryLog::sHead         = 0;
+uint32_t BinaryLog::sTail         = 0;
+uint32_t BinaryLog::sDroppedCount = 0;
+
+void BinaryLog::Append(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+    uint8_t  record[kHeaderSize + kMaxArgsLength];
+    uint16_t length;
+    uint32_t head;
+
+    length    = EncodeArgs(&record[kHeaderSize], aFormat, aArgs);
+    record[0] = static_cast<uint8_t>(length);
+    record[1] = static_cast<uint8_t>(aLogLevel);
+    record[2] = static_cast<uint8_t>(aLogRegion);
+    WriteUint32(otPlatAlarmMilliGetNow(), &record[3]);
+    WriteUint32(static_cast<uint32_t>(aFormat - otLogBinaryFormatAnchor), &record[7]);
+    length += kHeaderSize;
+
+    head = sHead;
+
+    if (kBufferSize - (head - __atomic_load_n(&sTail, __ATOMIC_ACQUIRE)) < length)
+    {
+        sDroppedCount++;
+        ExitNow();
+    }
+
+    CopyIn(head, record, length);
+    __atomic_store_n(&sHead, head + length, __ATOMIC_RELEASE);
+
+exit:
+    return;
+}
+
+uint16_t BinaryLog::Read(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint32_t tail   = sTail;
+    uint32_t head   = __atomic_load_n(&sHead, __ATOMIC_ACQUIRE);
+    uint16_t offset = 0;
+
+    while (tail != head)
+    {
+        uint8_t  argsLength;
+        uint16_t recordLength;
+
+        CopyOut(tail, &argsLength, sizeof(argsLength));
+        recordLength = kHeaderSize + argsLength;
+
+        VerifyOrExit(recordLength <= aLength - offset);
+
+        CopyOut(tail, &aBuffer[offset], recordLength);
+        offset += recordLength;
+        tail += recordLength;
+    }
+
+exit:
+    __atomic_store_n(&sTail, tail, __ATOMIC_RELEASE);
+    return offset;
+}
+
+void BinaryLog::CopyIn(uint32_t aIndex, const uint8_t *aData, uint16_t aLength)
+{
+    uint16_t start = static_cast<uint16_t>(aIndex & (kBufferSize - 1));
+    uint16_t first = OT_MIN(aLength, static_cast<uint16_t>(kBufferSize - start));
+
+    memcpy(&sBuffer[start], aData, first);
+    memcpy(sBuffer, aData + first, aLength - first);
+}
+
+void BinaryLog::CopyOut(uint32_t aIndex, uint8_t *aData, uint16_t aLength)
+{
+    uint16_t start = static_cast<uint16_t>(aIndex & (kBufferSize - 1));
+    uint16_t first = OT_MIN(aLength, static_cast<uint16_t>(kBufferSize - start));
+
+    memcpy(aData, &sBuffer[start], first);
+    memcpy(aData + first, sBuffer, aLength - first);
+}
+
+uint16_t BinaryLog::EncodeArgs(uint8_t *aBuffer, const char *aFormat, va_list aArgs)
+{
+    enum LengthModifier : uint8_t
+    {
+        kModifierNone,
+        kModifierLong,
+        kModifierLongLong,
+        kModifierSize,
+        kModifierPtrDiff,
+    };
+
+    // Each iteration encodes at most one string (length byte plus chars) or one 8-byte value.
+    static constexpr uint16_t kMaxArgSize = OT_MAX(kMaxStringLen + 1, sizeof(uint64_t));
+
+    uint16_t    length = 0;
+    const char *cur    = aFormat;
+
+    while ((cur = strchr(cur, '%')) != nullptr)
+    {
+        LengthModifier modifier = kModifierNone;
+        size_t         maxLen   = kMaxStringLen;
+
+        cur++;
+
+        if (*cur == '%')
+        {
+            cur++;
+            continue;
+        }
+
+        while (*cur == '-' || *cur == '+' || *cur == ' ' || *cur == '#' || *cur == '0')
+        {
+            cur++;
+        }
+
+        // Width and precision may be given as `*`, in which case they consume an `int` argument.
+
+        for (uint8_t field = 0; field < 2; field++)
+        {
+            if (field == 1)
+            {
+                if (*cur != '.')
+                {
+                    break;
+                }
+
+                cur++;
+            }
+
+            if (*cur == '*')
+            {
+                int value = va_arg(aArgs, int);
+
+                VerifyOrExit(length + kMaxArgSize + sizeof(uint32_t) <= kMaxArgsLength);
+                WriteUint32(static_cast<uint32_t>(value), &aBuffer[length]);
+                length += sizeof(uint32_t);
+                cur++;
+
+                if ((field == 1) && (value >= 0))
+                {
+                    maxLen = OT_MIN(maxLen, static_cast<size_t>(value));
+                }
+            }
+            else
+            {
+                size_t value = 0;
+
+                while (*cur >= '0' && *cur <= '9')
+                {
+                    value = value * 10 + static_cast<size_t>(*cur - '0');
+                    cur++;
+                }
+
+                if (field == 1)
+                {
+                    maxLen = OT_MIN(maxLen, value);
+                }
+            }
+        }
+
+        switch (*cur)
+        {
+        case 'h':
+            cur += (cur[1] == 'h') ? 2 : 1;
+            break;
+
+        case 'l':
+            modifier = (cur[1] == 'l') ? kModifierLongLong : kModifierLong;
+            cur += (cur[1] == 'l') ? 2 : 1;
+            break;
+
+        case 'j':
+        case 'q':
+            modifier = kModifierLongLong;
+            cur++;
+            break;
+
+        case 'z':
+            modifier = kModifierSize;
+            cur++;
+            break;
+
+        case 't':
+            modifier = kModifierPtrDiff;
+            cur++;
+            break;
+
+        case 'L':
+            cur++;
+            break;
+
+        default:
+            break;
+        }
+
+        VerifyOrExit(length + kMaxArgSize <= kMaxArgsLength);
+
+        switch (*cur)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            switch (modifier)
+            {
+            case kModifierNone:
+                WriteUint32(static_cast<uint32_t>(va_arg(aArgs, unsigned int)), &aBuffer[length]);
+                length += sizeof(uint32_t);
+                break;
+
+            case kModifierLong:
+                WriteUint64(static_cast<uint64_t>(va_arg(aArgs, unsigned long)), &aBuffer[length]);
+                length += sizeof(uint64_t);
+                break;
+
+            case kModifierLongLong:
+                WriteUint64(static_cast<uint64_t>(va_arg(aArgs, unsigned long long)), &aBuffer[length]);
+                length += sizeof(uint64_t);
+                break;
+
+            case kModifierSize:
+                WriteUint64(static_cast<uint64_t>(va_arg(aArgs, size_t)), &aBuffer[length]);
+                length += sizeof(uint64_t);
+                break;
+
+            case kModifierPtrDiff:
+                WriteUint64(static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t)), &aBuffer[length]);
+                length += sizeof(uint64_t);
+                break;
+            }
+
+            break;
+
+        case 'c':
+            WriteUint32(static_cast<uint32_t>(va_arg(aArgs, int)), &aBuffer[length]);
+            length += sizeof(uint32_t);
+            break;
+
+        case 'p':
+            WriteUint64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(aArgs, void *))), &aBuffer[length]);
+            length += sizeof(uint64_t);
+            break;
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value = va_arg(aArgs, double);
+
+            memcpy(&aBuffer[length], &value, sizeof(uint64_t));
+            length += sizeof(uint64_t);
+            break;
+        }
+
+        case 's':
+        {
+            const char *string = va_arg(aArgs, const char *);
+            uint8_t     strLen = 0;
+
+            if (string == nullptr)
+            {
+                string = "(null)";
+            }
+
+            while ((strLen < maxLen) && (string[strLen] != '\0'))
+            {
+                strLen++;
+            }
+
+            aBuffer[length++] = strLen;
+            memcpy(&aBuffer[length], string, strLen);
+            length += strLen;
+            break;
+        }
+
+        default:
+            // Unsupported conversion, the remaining arguments cannot be decoded reliably.
+            ExitNow();
+        }
+
+        cur++;
+    }
+
+exit:
+    return length;
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the compact binary log ring buffer.
+ */
+
+#ifndef BINARY_LOG_HPP_
+#define BINARY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include <openthread/platform/logging.h>
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+namespace ot {
+
+/**
+ * This class implements the compact binary log.
+ *
+ * Rather than formatting a log line, `Append()` walks the format string to find the conversion specifiers and copies
+ * the raw argument values into a record. Records are kept in a single-producer/single-consumer lock-free ring buffer
+ * and are drained with `Read()`.
+ *
+ * All multi-byte fields are encoded in little-endian order. Each record is:
+ *
+ *   | Args Length (1) | Level (1) | Region (1) | Timestamp ms (4) | Format ID (4) | Args (Args Length) |
+ *
+ * The Format ID is the signed offset of the format string from `otLogBinaryFormatAnchor`. The offset is fixed at link
+ * time, so an offline decoder can resolve it from the image symbol table (even for position independent images).
+ *
+ * Arguments are encoded in format string order: integer and char conversions (and `*` width/precision) as 4 bytes,
+ * `l`/`ll`/`j`/`z`/`t` integer conversions and `%p` as 8 bytes, floating point conversions as an 8-byte double, and
+ * `%s` as a 1-byte length followed by the (possibly truncated) chars without a null terminator.
+ *
+ */
+class BinaryLog
+{
+public:
+    enum : uint8_t
+    {
+        kHeaderSize = 11, ///< Record header size (number of bytes).
+    };
+
+    /**
+     * This static method captures a log line into the ring buffer.
+     *
+     * @param[in] aLogLevel   The log level.
+     * @param[in] aLogRegion  The log region.
+     * @param[in] aFormat     The format string.
+     * @param[in] aArgs       The arguments for the format string.
+     *
+     */
+    static void Append(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs);
+
+    /**
+     * This static method reads (and removes) complete records from the ring buffer.
+     *
+     * This method is safe to call from a context other than the one generating logs, as long as there is a single
+     * reader.
+     *
+     * @param[out] aBuffer  A pointer to a buffer to output the records.
+     * @param[in]  aLength  The size of @p aBuffer (number of bytes).
+     *
+     * @returns The number of bytes written to @p aBuffer. Zero if there is no complete record which fits.
+     *
+     */
+    static uint16_t Read(uint8_t *aBuffer, uint16_t aLength);
+
+    /**
+     * This static method returns the number of records dropped since boot because the ring buffer was full.
+     *
+     * @returns The number of dropped records.
+     *
+     */
+    static uint32_t GetDroppedCount(void) { return sDroppedCount; }
+
+private:
+    enum : uint16_t
+    {
+        kBufferSize    = OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE,
+        kMaxArgsLength = 255,
+        kMaxStringLen  = OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_LENGTH,
+    };
+
+    static_assert(kMaxStringLen < kMaxArgsLength, "OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_LENGTH is too large");
+    static_assert(kBufferSize > kHeaderSize + kMaxArgsLength, "OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE is too small");
+
+    static uint16_t EncodeArgs(uint8_t *aBuffer, const char *aFormat, va_list aArgs);
+    static void     CopyIn(uint32_t aIndex, const uint8_t *aData, uint16_t aLength);
+    static void     CopyOut(uint32_t aIndex, uint8_t *aData, uint16_t aLength);
+
+    // `sHead` is only written by the producer and `sTail` only by the consumer. Both are free running indexes.
+    static uint8_t  sBuffer[kBufferSize];
+    static uint32_t sHead;
+    static uint32_t sTail;
+    static uint32_t sDroppedCount;
+};
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#endif // BINARY_LOG_HPP_
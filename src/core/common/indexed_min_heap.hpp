@@ -0,0 +1,269 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for an indexed min-heap.
+ */
+
+#ifndef INDEXED_MIN_HEAP_HPP_
+#define INDEXED_MIN_HEAP_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-indexed-min-heap
+ *
+ * @brief
+ *   This module includes definitions for an indexed min-heap.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This template class implements a min-heap of indexes (e.g., child table indexes) ordered by a key.
+ *
+ * Each index can be in the heap at most once. The heap tracks the position of every index, so the key of an index
+ * can be updated, or an index removed, in O(log n). The earliest (smallest key) index is found in O(1).
+ *
+ * @tparam KeyType   The key type. It MUST provide `operator<`.
+ * @tparam kMaxSize  The number of indexes (the indexes are in the range [0, kMaxSize)).
+ *
+ */
+template <typename KeyType, uint16_t kMaxSize> class IndexedMinHeap
+{
+public:
+    /**
+     * This constructor initializes the heap as empty.
+     *
+     */
+    IndexedMinHeap(void) { Clear(); }
+
+    /**
+     * This method removes all indexes from the heap.
+     *
+     */
+    void Clear(void)
+    {
+        mSize = 0;
+
+        for (uint16_t &position : mPositions)
+        {
+            position = kNotInHeap;
+        }
+    }
+
+    /**
+     * This method indicates whether the heap is empty.
+     *
+     * @retval TRUE   The heap is empty.
+     * @retval FALSE  The heap contains at least one index.
+     *
+     */
+    bool IsEmpty(void) const { return (mSize == 0); }
+
+    /**
+     * This method returns the number of indexes in the heap.
+     *
+     * @returns The number of indexes in the heap.
+     *
+     */
+    uint16_t GetSize(void) const { return mSize; }
+
+    /**
+     * This method indicates whether an index is in the heap.
+     *
+     * @param[in] aIndex  The index.
+     *
+     * @retval TRUE   The index is in the heap.
+     * @retval FALSE  The index is not in the heap.
+     *
+     */
+    bool Contains(uint16_t aIndex) const { return (aIndex < kMaxSize) && (mPositions[aIndex] != kNotInHeap); }
+
+    /**
+     * This method returns the index with the smallest key.
+     *
+     * This method MUST be called only when the heap is not empty.
+     *
+     * @returns The index with the smallest key.
+     *
+     */
+    uint16_t GetTop(void) const
+    {
+        OT_ASSERT(!IsEmpty());
+        return mHeap[0];
+    }
+
+    /**
+     * This method returns the key of an index.
+     *
+     * This method MUST be called only for an index in the heap.
+     *
+     * @param[in] aIndex  The index.
+     *
+     * @returns The key of @p aIndex.
+     *
+     */
+    const KeyType &GetKey(uint16_t aIndex) const
+    {
+        OT_ASSERT(Contains(aIndex));
+        return mKeys[aIndex];
+    }
+
+    /**
+     * This method adds an index to the heap, or updates its key if it is already in the heap.
+     *
+     * @param[in] aIndex  The index.
+     * @param[in] aKey    The key.
+     *
+     */
+    void Update(uint16_t aIndex, const KeyType &aKey)
+    {
+        OT_ASSERT(aIndex < kMaxSize);
+
+        mKeys[aIndex] = aKey;
+
+        if (mPositions[aIndex] == kNotInHeap)
+        {
+            Place(aIndex, mSize++);
+        }
+
+        SiftUp(mPositions[aIndex]);
+        SiftDown(mPositions[aIndex]);
+    }
+
+    /**
+     * This method removes an index from the heap. It is a no-op if the index is not in the heap.
+     *
+     * @param[in] aIndex  The index.
+     *
+     */
+    void Remove(uint16_t aIndex)
+    {
+        uint16_t position;
+        uint16_t last;
+
+        VerifyOrExit(Contains(aIndex));
+
+        position           = mPositions[aIndex];
+        mPositions[aIndex] = kNotInHeap;
+        last               = mHeap[--mSize];
+
+        VerifyOrExit(last != aIndex);
+
+        Place(last, position);
+        SiftUp(position);
+        SiftDown(mPositions[last]);
+
+    exit:
+        return;
+    }
+
+private:
+    static constexpr uint16_t kNotInHeap = 0xffff;
+
+    static_assert(kMaxSize < kNotInHeap, "kMaxSize is too large");
+
+    bool IsBefore(uint16_t aPosition1, uint16_t aPosition2) const
+    {
+        return mKeys[mHeap[aPosition1]] < mKeys[mHeap[aPosition2]];
+    }
+
+    void Place(uint16_t aIndex, uint16_t aPosition)
+    {
+        mHeap[aPosition]   = aIndex;
+        mPositions[aIndex] = aPosition;
+    }
+
+    void Swap(uint16_t aPosition1, uint16_t aPosition2)
+    {
+        uint16_t index = mHeap[aPosition1];
+
+        Place(mHeap[aPosition2], aPosition1);
+        Place(index, aPosition2);
+    }
+
+    void SiftUp(uint16_t aPosition)
+    {
+        while ((aPosition > 0) && IsBefore(aPosition, (aPosition - 1) / 2))
+        {
+            Swap(aPosition, (aPosition - 1) / 2);
+            aPosition = (aPosition - 1) / 2;
+        }
+    }
+
+    void SiftDown(uint16_t aPosition)
+    {
+        while (true)
+        {
+            uint16_t smallest = aPosition;
+            uint16_t child    = 2 * aPosition + 1;
+
+            if ((child < mSize) && IsBefore(child, smallest))
+            {
+                smallest = child;
+            }
+
+            if ((child + 1 < mSize) && IsBefore(child + 1, smallest))
+            {
+                smallest = child + 1;
+            }
+
+            if (smallest == aPosition)
+            {
+                break;
+            }
+
+            Swap(aPosition, smallest);
+            aPosition = smallest;
+        }
+    }
+
+    uint16_t mHeap[kMaxSize];      // The indexes, in heap order.
+    uint16_t mPositions[kMaxSize]; // The heap position of each index (or `kNotInHeap`).
+    KeyType  mKeys[kMaxSize];      // The key of each index.
+    uint16_t mSize;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // INDEXED_MIN_HEAP_HPP_
@@ -70,6 +70,9 @@ Instance::Instance(void)
     , mSettings(*this)
     , mSettingsDriver(*this)
     , mMessagePool(*this)
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+    , mPacketTrace(*this)
+#endif
     , mIp6(*this)
     , mThreadNetif(*this)
 #if OPENTHREAD_CONFIG_COAP_API_ENABLE
@@ -90,6 +93,9 @@ Instance::Instance(void)
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     , mDatasetUpdater(*this)
 #endif
+#if OPENTHREAD_FTD
+    , mPskcGenerator(*this)
+#endif
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
     , mAnnounceSender(*this)
 #endif
@@ -67,12 +67,16 @@
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
 #include "meshcop/dataset_updater.hpp"
 #endif
+#include "meshcop/pskc_generator.hpp"
 #include "net/ip6.hpp"
 #include "thread/announce_sender.hpp"
 #include "thread/link_quality.hpp"
 #include "thread/thread_netif.hpp"
 #include "thread/tmf.hpp"
 #include "utils/heap.hpp"
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+#include "utils/packet_trace.hpp"
+#endif
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
 #include "utils/ping_sender.hpp"
 #endif
@@ -365,6 +369,10 @@ private:
     SettingsDriver mSettingsDriver;
     MessagePool    mMessagePool;
 
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+    Utils::PacketTrace mPacketTrace;
+#endif
+
     Ip6::Ip6    mIp6;
     ThreadNetif mThreadNetif;
 
@@ -392,6 +400,10 @@ private:
     MeshCoP::DatasetUpdater mDatasetUpdater;
 #endif
 
+#if OPENTHREAD_FTD
+    MeshCoP::PskcGenerator mPskcGenerator;
+#endif
+
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
     AnnounceSender mAnnounceSender;
 #endif
@@ -828,6 +840,13 @@ template <> inline MeshCoP::DatasetUpdater &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_FTD
+template <> inline MeshCoP::PskcGenerator &Instance::Get(void)
+{
+    return mPskcGenerator;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
 template <> inline MeshCoP::BorderAgent &Instance::Get(void)
 {
@@ -847,6 +866,13 @@ template <> inline MessagePool &Instance::Get(void)
     return mMessagePool;
 }
 
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+template <> inline Utils::PacketTrace &Instance::Get(void)
+{
+    return mPacketTrace;
+}
+#endif
+
 #if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 
 template <> inline BackboneRouter::Leader &Instance::Get(void)
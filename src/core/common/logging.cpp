@@ -33,6 +33,7 @@
 
 #include "logging.hpp"
 
+#include "common/binary_log.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/string.hpp"
@@ -46,6 +47,10 @@
 #error OPENTHREAD_CONFIG_ENABLE_DEBUG_UART_LOG requires OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE && OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY
+#error OPENTHREAD_CONFIG_LOG_BINARY_ENABLE requires OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY to be disabled
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -58,12 +63,21 @@ static void Log(otLogLevel  aLogLevel,
                 const char *aFormat,
                 va_list     aArgs)
 {
+#if !OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
     ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
+#endif
 
 #if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
     VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    OT_UNUSED_VARIABLE(aRegionPrefix);
+
+    // The level and region prefixes are added back by the offline decoder.
+    ot::BinaryLog::Append(aLogLevel, aLogRegion, aFormat, aArgs);
+#else
+
 #if OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
     {
         const char *levelStr = "";
@@ -103,6 +117,7 @@ static void Log(otLogLevel  aLogLevel,
     logString.Append("%s", aRegionPrefix);
     logString.AppendVarArgs(aFormat, aArgs);
     otPlatLog(aLogLevel, aLogRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, logString.AsCString());
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
 
 #if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
 exit:
@@ -59,6 +59,9 @@ MessagePool::MessagePool(Instance &aInstance)
     , mNumFreeBuffers(kNumBuffers)
 #endif
 {
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    memset(&mStats, 0, sizeof(mStats));
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
@@ -73,6 +76,9 @@ Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message:
 
     memset(message, 0, sizeof(*message));
     message->SetMessagePool(this);
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    UpdateStatsOnNew(*message);
+#endif
     message->SetType(aType);
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(true);
@@ -106,6 +112,10 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    UpdateStatsOnFree(*aMessage);
+#endif
+
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
@@ -132,10 +142,17 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 
     buffer->SetNextBuffer(nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    IncrementCount(mStats.mBuffersInUse, mStats.mMaxBuffersInUse);
+#endif
+
 exit:
     if (buffer == nullptr)
     {
         otLogInfoMem("No available message buffer");
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+        mStats.mAllocFailures[aPriority]++;
+#endif
     }
 
     return buffer;
@@ -153,6 +170,9 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 #else
         mBufferPool.Free(*aBuffer);
         mNumFreeBuffers++;
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+        mStats.mBuffersInUse--;
 #endif
         aBuffer = next;
     }
@@ -187,6 +207,94 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 #endif
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+
+void MessagePool::GetStats(otMessagePoolStats &aStats) const
+{
+    aStats                          = mStats;
+    aStats.m6loSendQueueMaxMessages = Get<MeshForwarder>().GetSendQueue().GetMaxNumMessages();
+    aStats.mIp6SendQueueMaxMessages = Get<Ip6::Ip6>().GetSendQueue().GetMaxNumMessages();
+}
+
+void MessagePool::ResetStats(void)
+{
+    mStats.mMaxBuffersInUse  = mStats.mBuffersInUse;
+    mStats.mMaxMessagesInUse = mStats.mMessagesInUse;
+
+    for (uint8_t type = 0; type < OT_ARRAY_LENGTH(mStats.mTypeMessages); type++)
+    {
+        mStats.mMaxTypeMessages[type] = mStats.mTypeMessages[type];
+    }
+
+    for (uint8_t subType = 0; subType < OT_ARRAY_LENGTH(mStats.mSubTypeMessages); subType++)
+    {
+        mStats.mMaxSubTypeMessages[subType] = mStats.mSubTypeMessages[subType];
+    }
+
+    memset(mStats.mAllocFailures, 0, sizeof(mStats.mAllocFailures));
+    memset(mStats.mBufferCountHistogram, 0, sizeof(mStats.mBufferCountHistogram));
+    memset(mStats.mLifetimeHistogram, 0, sizeof(mStats.mLifetimeHistogram));
+
+    Get<MeshForwarder>().GetSendQueue().ResetMaxNumMessages();
+    Get<Ip6::Ip6>().GetSendQueue().ResetMaxNumMessages();
+}
+
+void MessagePool::IncrementCount(uint16_t &aCount, uint16_t &aMaxCount)
+{
+    aCount++;
+    aMaxCount = OT_MAX(aMaxCount, aCount);
+}
+
+void MessagePool::UpdateStatsOnNew(Message &aMessage)
+{
+    // The newly allocated message starts with zero type and sub type
+    // (cleared metadata), `SetType()` then moves it to its actual type.
+
+    IncrementCount(mStats.mMessagesInUse, mStats.mMaxMessagesInUse);
+    IncrementCount(mStats.mTypeMessages[0], mStats.mMaxTypeMessages[0]);
+    IncrementCount(mStats.mSubTypeMessages[0], mStats.mMaxSubTypeMessages[0]);
+
+    aMessage.SetAllocTime(TimerMilli::GetNow().GetValue());
+}
+
+void MessagePool::UpdateStatsOnFree(const Message &aMessage)
+{
+    uint32_t lifetime    = TimerMilli::GetNow().GetValue() - aMessage.GetAllocTime();
+    uint32_t binLimit    = 10;
+    uint8_t  lifetimeBin = 0;
+    uint8_t  bufferBin   = static_cast<uint8_t>(OT_MIN(aMessage.GetBufferCount(), static_cast<uint8_t>(kNumBufferBins)) - 1);
+
+    mStats.mMessagesInUse--;
+    mStats.mTypeMessages[aMessage.GetType()]--;
+    mStats.mSubTypeMessages[aMessage.GetSubType()]--;
+
+    // Lifetime bins are decades starting from 10 msec, the last bin
+    // holds all larger values.
+
+    while ((lifetimeBin < kNumLifetimeBins - 1) && (lifetime >= binLimit))
+    {
+        lifetimeBin++;
+        binLimit *= 10;
+    }
+
+    mStats.mLifetimeHistogram[lifetimeBin]++;
+    mStats.mBufferCountHistogram[bufferBin]++;
+}
+
+void MessagePool::UpdateTypeStats(uint8_t aOldType, uint8_t aNewType)
+{
+    mStats.mTypeMessages[aOldType]--;
+    IncrementCount(mStats.mTypeMessages[aNewType], mStats.mMaxTypeMessages[aNewType]);
+}
+
+void MessagePool::UpdateSubTypeStats(uint8_t aOldSubType, uint8_t aNewSubType)
+{
+    mStats.mSubTypeMessages[aOldSubType]--;
+    IncrementCount(mStats.mSubTypeMessages[aNewSubType], mStats.mMaxSubTypeMessages[aNewSubType]);
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+
 const Message::Settings Message::Settings::kDefault(Message::kWithLinkSecurity, Message::kPriorityNormal);
 
 Message::Settings::Settings(LinkSecurityMode aSecurityMode, Priority aPriority)
@@ -307,6 +415,20 @@ void Message::SetOffset(uint16_t aOffset)
     GetMetadata().mOffset = aOffset;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+void Message::SetType(Type aType)
+{
+    GetMessagePool()->UpdateTypeStats(GetMetadata().mType, aType);
+    GetMetadata().mType = aType;
+}
+
+void Message::SetSubType(SubType aSubType)
+{
+    GetMessagePool()->UpdateSubTypeStats(GetMetadata().mSubType, aSubType);
+    GetMetadata().mSubType = aSubType;
+}
+#endif
+
 bool Message::IsSubTypeMle(void) const
 {
     bool rval;
@@ -546,6 +668,18 @@ exit:
     return;
 }
 
+uint16_t Message::GetContiguousBytes(uint16_t aOffset, const uint8_t *&aData) const
+{
+    uint16_t length = GetLength();
+    Chunk    chunk;
+
+    chunk.mData = nullptr;
+    GetFirstChunk(aOffset, length, chunk);
+    aData = chunk.GetData();
+
+    return chunk.GetLength();
+}
+
 uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
@@ -814,6 +948,10 @@ void MessageQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) cons
 }
 
 PriorityQueue::PriorityQueue(void)
+    : mNumMessages(0)
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    , mMaxNumMessages(0)
+#endif
 {
     for (Message *&tail : mTails)
     {
@@ -907,6 +1045,11 @@ void PriorityQueue::Enqueue(Message &aMessage)
     }
 
     mTails[priority] = &aMessage;
+    mNumMessages++;
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    mMaxNumMessages = OT_MAX(mMaxNumMessages, mNumMessages);
+#endif
 }
 
 void PriorityQueue::Dequeue(Message &aMessage)
@@ -938,6 +1081,7 @@ void PriorityQueue::Dequeue(Message &aMessage)
     aMessage.Prev()         = nullptr;
 
     aMessage.SetMessageQueue(nullptr);
+    mNumMessages--;
 }
 
 void PriorityQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) const
@@ -69,6 +69,12 @@ class HmacSha256;
 
 } // namespace Crypto
 
+namespace Dns {
+
+class Name;
+
+} // namespace Dns
+
 /**
  * @addtogroup core-message
  *
@@ -173,6 +179,9 @@ struct MessageMetadata
 
     ChildMask mChildMask; ///< A ChildMask to indicate which sleepy children need to receive this.
     uint16_t  mMeshDest;  ///< Used for unicast non-link-local messages.
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    uint16_t mLowpanCacheId; ///< Identifies the cached compressed 6LoWPAN header of the message (zero if none).
+#endif
     uint8_t   mTimeout;   ///< Seconds remaining before dropping the message.
     union
     {
@@ -194,6 +203,9 @@ struct MessageMetadata
     int64_t mNetworkTimeOffset; ///< The time offset to the Thread network time, in microseconds.
     uint8_t mTimeSyncSeq;       ///< The time sync sequence.
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    uint32_t mAllocTime; ///< The time (in msec) when the message was allocated.
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     uint8_t mRadioType : 2;      ///< The radio link type the message was received on, or should be sent on.
     bool    mIsRadioTypeSet : 1; ///< Indicates whether the radio type is set.
@@ -312,6 +324,7 @@ class Message : public otMessage, public Buffer
     friend class Checksum;
     friend class Crypto::HmacSha256;
     friend class Crypto::Sha256;
+    friend class Dns::Name;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -527,7 +540,11 @@ public:
      * @param[in]  aType  The message type.
      *
      */
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    void SetType(Type aType);
+#else
     void SetType(Type aType) { GetMetadata().mType = aType; }
+#endif
 
     /**
      * This method returns the sub type of the message.
@@ -543,7 +560,11 @@ public:
      * @param[in]  aSubType  The message sub type.
      *
      */
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    void SetSubType(SubType aSubType);
+#else
     void SetSubType(SubType aSubType) { GetMetadata().mSubType = aSubType; }
+#endif
 
     /**
      * This method returns whether or not the message is of MLE subtype.
@@ -706,6 +727,20 @@ public:
      */
     uint16_t ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const;
 
+    /**
+     * This method gets a pointer to the contiguous message data starting at a given offset.
+     *
+     * The returned data stays valid until the message is modified or freed. Reading a whole message through this
+     * method (moving the offset by the returned length each time) gives access to its content without copying it.
+     *
+     * @param[in]  aOffset  Byte offset within the message.
+     * @param[out] aData    A reference to a pointer to output the start of the contiguous data.
+     *
+     * @returns The number of contiguous bytes available at @p aData, or zero if @p aOffset is beyond the message end.
+     *
+     */
+    uint16_t GetContiguousBytes(uint16_t aOffset, const uint8_t *&aData) const;
+
     /**
      * This method reads a given number of bytes from the message.
      *
@@ -891,6 +926,27 @@ public:
      */
     void SetDatagramTag(uint32_t aTag) { GetMetadata().mDatagramTag = aTag; }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    /**
+     * This method returns the identifier of the cached compressed 6LoWPAN header of the message.
+     *
+     * @returns The 6LoWPAN header cache identifier, or zero if the message has none.
+     *
+     */
+    uint16_t GetLowpanCacheId(void) const { return GetMetadata().mLowpanCacheId; }
+
+    /**
+     * This method sets the identifier of the cached compressed 6LoWPAN header of the message.
+     *
+     * A message is allocated (or cloned) with no identifier (zero). Setting the identifier to zero invalidates any
+     * cached header of the message.
+     *
+     * @param[in]  aId  The 6LoWPAN header cache identifier.
+     *
+     */
+    void SetLowpanCacheId(uint16_t aId) { GetMetadata().mLowpanCacheId = aId; }
+#endif
+
     /**
      * This method returns whether or not the message forwarding is scheduled for the child.
      *
@@ -1279,6 +1335,24 @@ private:
      */
     void SetMessagePool(MessagePool *aMessagePool) { GetMetadata().mMessagePool = aMessagePool; }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    /**
+     * This method returns the time (in msec) when the message was allocated.
+     *
+     * @returns The allocation time of the message.
+     *
+     */
+    uint32_t GetAllocTime(void) const { return GetMetadata().mAllocTime; }
+
+    /**
+     * This method sets the time (in msec) when the message was allocated.
+     *
+     * @param[in]  aAllocTime  The allocation time of the message.
+     *
+     */
+    void SetAllocTime(uint32_t aAllocTime) { GetMetadata().mAllocTime = aAllocTime; }
+#endif
+
     /**
      * This method returns `true` if the message is enqueued in any queue (`MessageQueue` or `PriorityQueue`).
      *
@@ -1533,6 +1607,32 @@ public:
      */
     void GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) const;
 
+    /**
+     * This method returns the number of messages enqueued.
+     *
+     * Unlike `GetInfo()`, this method does not iterate over the queue.
+     *
+     * @returns The number of messages enqueued.
+     *
+     */
+    uint16_t GetNumMessages(void) const { return mNumMessages; }
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    /**
+     * This method returns the high-water mark of the number of messages enqueued.
+     *
+     * @returns The maximum number of messages enqueued since the queue was initialized or the mark was reset.
+     *
+     */
+    uint16_t GetMaxNumMessages(void) const { return mMaxNumMessages; }
+
+    /**
+     * This method resets the high-water mark to the current number of messages enqueued.
+     *
+     */
+    void ResetMaxNumMessages(void) { mMaxNumMessages = mNumMessages; }
+#endif
+
     /**
      * This method returns the tail of the list (last message in the list)
      *
@@ -1568,6 +1668,10 @@ private:
 
 private:
     Message *mTails[Message::kNumPriorities]; ///< Tail pointers associated with different priority levels.
+    uint16_t mNumMessages;                    ///< Number of messages enqueued.
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    uint16_t mMaxNumMessages; ///< High-water mark of the number of messages enqueued.
+#endif
 };
 
 /**
@@ -1640,11 +1744,49 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    /**
+     * This method gets the message pool occupancy statistics.
+     *
+     * @param[out]  aStats  A reference to output the statistics.
+     *
+     */
+    void GetStats(otMessagePoolStats &aStats) const;
+
+    /**
+     * This method resets the message pool occupancy statistics.
+     *
+     * The high-water marks are set to the current occupancy, and the allocation failure counters and histograms are
+     * cleared.
+     *
+     */
+    void ResetStats(void);
+#endif
+
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    enum : uint8_t
+    {
+        kNumLifetimeBins = OT_MESSAGE_POOL_STATS_NUM_LIFETIME_BINS,
+        kNumBufferBins   = OT_MESSAGE_POOL_STATS_NUM_BUFFER_BINS,
+    };
+
+    static_assert(Message::kNumPriorities == OT_MESSAGE_POOL_STATS_NUM_PRIORITIES, "Number of priorities mismatch");
+
+    static void IncrementCount(uint16_t &aCount, uint16_t &aMaxCount);
+
+    void UpdateStatsOnNew(Message &aMessage);
+    void UpdateStatsOnFree(const Message &aMessage);
+    void UpdateTypeStats(uint8_t aOldType, uint8_t aNewType);
+    void UpdateSubTypeStats(uint8_t aOldSubType, uint8_t aNewSubType);
+
+    otMessagePoolStats mStats;
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     uint16_t                  mNumFreeBuffers;
     Pool<Buffer, kNumBuffers> mBufferPool;
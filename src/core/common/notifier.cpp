@@ -33,6 +33,8 @@
 
 #include "notifier.hpp"
 
+#include <openthread/platform/time.h>
+
 #include "border_router/routing_manager.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -41,15 +43,103 @@
 
 namespace ot {
 
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+#define OT_NOTIFIER_EVENT_HANDLER(aType, aName)                       \
+    {                                                                 \
+        aType::kNotifierEvents, &Notifier::HandleEvents<aType>, aName \
+    }
+#else
+#define OT_NOTIFIER_EVENT_HANDLER(aType, aName)                \
+    {                                                          \
+        aType::kNotifierEvents, &Notifier::HandleEvents<aType> \
+    }
+#endif
+
+// Core internal modules receiving events. A module's handler is only
+// invoked when an emitted event is in its `kNotifierEvents`.
+const Notifier::EventHandler Notifier::kEventHandlers[] = {
+    OT_NOTIFIER_EVENT_HANDLER(Mle::Mle, "Mle"),
+    OT_NOTIFIER_EVENT_HANDLER(EnergyScanServer, "EnergyScanServer"),
+#if OPENTHREAD_FTD
+    OT_NOTIFIER_EVENT_HANDLER(MeshCoP::JoinerRouter, "JoinerRouter"),
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(BackboneRouter::Manager, "BbrManager"),
+#endif
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Utils::ChildSupervisor, "ChildSupervisor"),
+#endif
+#if OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(MeshCoP::DatasetUpdater, "DatasetUpdater"),
+#endif
+#endif // OPENTHREAD_FTD
+#if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(NetworkData::Notifier, "NetDataNotifier"),
+#endif
+#if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(AnnounceSender, "AnnounceSender"),
+#endif
+#if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(MeshCoP::BorderAgent, "BorderAgent"),
+#endif
+#if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
+    OT_NOTIFIER_EVENT_HANDLER(MlrManager, "MlrManager"),
+#endif
+#if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
+    OT_NOTIFIER_EVENT_HANDLER(DuaManager, "DuaManager"),
+#endif
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(TimeSync, "TimeSync"),
+#endif
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Utils::Slaac, "Slaac"),
+#endif
+#if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Utils::JamDetector, "JamDetector"),
+#endif
+#if OPENTHREAD_CONFIG_OTNS_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Utils::Otns, "Otns"),
+#endif
+#if OPENTHREAD_ENABLE_VENDOR_EXTENSION
+    OT_NOTIFIER_EVENT_HANDLER(Extension::ExtensionBase, "Extension"),
+#endif
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(BorderRouter::RoutingManager, "RoutingManager"),
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Srp::Server, "SrpServer"),
+#endif
+#if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+    OT_NOTIFIER_EVENT_HANDLER(Srp::Client, "SrpClient"),
+#endif
+};
+
+#undef OT_NOTIFIER_EVENT_HANDLER
+
+template <typename Type> void Notifier::HandleEvents(Instance &aInstance, Events aEvents)
+{
+    aInstance.Get<Type>().HandleNotifierEvents(aEvents);
+}
+
 Notifier::Notifier(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTask(aInstance, Notifier::EmitEvents)
 {
+    static_assert(OT_ARRAY_LENGTH(kEventHandlers) <= kMaxEventHandlers, "kMaxEventHandlers is too small");
+
     for (ExternalCallback &callback : mExternalCallbacks)
     {
         callback.mHandler = nullptr;
         callback.mContext = nullptr;
     }
+
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+    memset(mHandlerStats, 0, sizeof(mHandlerStats));
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(kEventHandlers); index++)
+    {
+        mHandlerStats[index].mName = kEventHandlers[index].mName;
+    }
+#endif
 }
 
 Error Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContext)
@@ -115,6 +205,15 @@ void Notifier::SignalIfFirst(Event aEvent)
     }
 }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+const Notifier::HandlerStats *Notifier::GetHandlerStats(uint8_t &aNumHandlers) const
+{
+    aNumHandlers = OT_ARRAY_LENGTH(kEventHandlers);
+
+    return mHandlerStats;
+}
+#endif
+
 void Notifier::EmitEvents(Tasklet &aTasklet)
 {
     aTasklet.Get<Notifier>().EmitEvents();
@@ -134,61 +233,41 @@ void Notifier::EmitEvents(void)
 
     LogEvents(events);
 
-    // Emit events to core internal modules
+    // Emit events to core internal modules interested in them
 
-    Get<Mle::Mle>().HandleNotifierEvents(events);
-    Get<EnergyScanServer>().HandleNotifierEvents(events);
-#if OPENTHREAD_FTD
-    Get<MeshCoP::JoinerRouter>().HandleNotifierEvents(events);
-#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    Get<BackboneRouter::Manager>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
-    Get<Utils::ChildSupervisor>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE
-    Get<MeshCoP::DatasetUpdater>().HandleNotifierEvents(events);
-#endif
-#endif // OPENTHREAD_FTD
-#if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
-    Get<NetworkData::Notifier>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
-    Get<AnnounceSender>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
-    Get<MeshCoP::BorderAgent>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
-    Get<MlrManager>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
-    Get<DuaManager>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    Get<TimeSync>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
-    Get<Utils::Slaac>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
-    Get<Utils::JamDetector>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_OTNS_ENABLE
-    Get<Utils::Otns>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_ENABLE_VENDOR_EXTENSION
-    Get<Extension::ExtensionBase>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    Get<BorderRouter::RoutingManager>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-    Get<Srp::Server>().HandleNotifierEvents(events);
-#endif
-#if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
-    Get<Srp::Client>().HandleNotifierEvents(events);
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(kEventHandlers); index++)
+    {
+        const EventHandler &handler = kEventHandlers[index];
+
+        if (!events.ContainsAny(handler.mEvents))
+        {
+            continue;
+        }
+
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+        {
+            uint64_t      startTime = otPlatTimeGet();
+            uint32_t      duration;
+            HandlerStats &stats = mHandlerStats[index];
+
+            handler.mHandle(GetInstance(), events);
+
+            duration = static_cast<uint32_t>(otPlatTimeGet() - startTime);
+
+            stats.mNumCalls++;
+            stats.mTotalTime += duration;
+
+            if (duration > stats.mMaxTime)
+            {
+                stats.mMaxTime = duration;
+            }
+
+            otLogDebgCore("Notifier: %s handled 0x%08x in %u usec", handler.mName, events.GetAsFlags(), duration);
+        }
+#else
+        handler.mHandle(GetInstance(), events);
 #endif
+    }
 
     for (ExternalCallback &callback : mExternalCallbacks)
     {
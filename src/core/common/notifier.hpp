@@ -187,7 +187,8 @@ private:
  * This class implements the OpenThread Notifier.
  *
  * For core internal modules, `Notifier` class emits events directly to them by invoking method `HandleNotifierEvents()`
- * on the module instance.
+ * on the module instance. Each module declares the events it handles with a `kNotifierEvents` constant, and its handler
+ * is only invoked when at least one of these events is emitted.
  *
  * A `otStateChangedCallback` callback can be explicitly registered with the `Notifier`. This is mainly intended for use
  * by external users (i.e.provided as an OpenThread public API). Max number of such callbacks that can be registered at
@@ -296,10 +297,35 @@ public:
         return error;
     }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+    /**
+     * This structure represents the time spent in a core module event handler.
+     *
+     */
+    struct HandlerStats
+    {
+        const char *mName;      ///< The module name.
+        uint32_t    mNumCalls;  ///< Number of times the handler was invoked.
+        uint32_t    mMaxTime;   ///< Longest single invocation (in microseconds).
+        uint64_t    mTotalTime; ///< Total time spent in the handler (in microseconds).
+    };
+
+    /**
+     * This method returns the event handler statistics.
+     *
+     * @param[out] aNumHandlers  A reference to return the number of entries in the returned array.
+     *
+     * @returns A pointer to an array of `HandlerStats`, one entry per core module event handler.
+     *
+     */
+    const HandlerStats *GetHandlerStats(uint8_t &aNumHandlers) const;
+#endif
+
 private:
     enum
     {
         kMaxExternalHandlers   = OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS,
+        kMaxEventHandlers      = 24, // Max number of core module event handlers in `kEventHandlers`.
         kFlagsStringLineLimit  = 70, // Character limit to divide the log into multiple lines in `LogChangedFlags()`.
         kMaxFlagNameLength     = 25, // Max length for string representation of a flag by `FlagToString()`.
         kFlagsStringBufferSize = kFlagsStringLineLimit + kMaxFlagNameLength,
@@ -311,6 +337,19 @@ private:
         void *                 mContext;
     };
 
+    struct EventHandler
+    {
+        Events::Flags mEvents; // The events the module handles.
+        void (*mHandle)(Instance &aInstance, Events aEvents);
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+        const char *mName;
+#endif
+    };
+
+    static const EventHandler kEventHandlers[];
+
+    template <typename Type> static void HandleEvents(Instance &aInstance, Events aEvents);
+
     static void EmitEvents(Tasklet &aTasklet);
     void        EmitEvents(void);
 
@@ -321,6 +360,9 @@ private:
     Events           mSignaledEvents;
     Tasklet          mTask;
     ExternalCallback mExternalCallbacks[kMaxExternalHandlers];
+#if OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+    HandlerStats mHandlerStats[kMaxEventHandlers];
+#endif
 };
 
 /**
@@ -50,6 +50,40 @@
 #define OPENTHREAD_CONFIG_DTLS_MAX_CONTENT_LEN MBEDTLS_SSL_MAX_CONTENT_LEN
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+ *
+ * Define to 1 to enable DTLS session resumption for EC-JPAKE sessions.
+ *
+ * When enabled, a DTLS server remembers the sessions it established (by session ID) and a DTLS client remembers the
+ * last session with each peer, so that a reconnecting peer can resume the session with an abbreviated handshake
+ * instead of running a full EC-JPAKE exchange.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+ *
+ * The maximum number of DTLS sessions cached by each DTLS transport. The oldest session is evicted when full.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_LIFETIME
+ *
+ * The lifetime (in seconds) of a cached DTLS session. A session older than this is not resumed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_LIFETIME
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_LIFETIME 600
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE || OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE || \
     OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_JOINER_ENABLE
 #define OPENTHREAD_CONFIG_DTLS_ENABLE 1
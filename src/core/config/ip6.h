@@ -107,6 +107,29 @@
 #define OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT 60
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_SIZE
+ *
+ * This setting configures the number of destinations for which a Path MTU learned from ICMPv6 Packet Too Big
+ * messages is kept. Applicable only if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_SIZE
+#define OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_TIMEOUT
+ *
+ * This setting configures the time in seconds after which a learned Path MTU expires and the link MTU is used again.
+ *
+ * RFC 8201 recommends 10 minutes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_TIMEOUT
+#define OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_TIMEOUT 600
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
  *
@@ -127,6 +150,20 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE
+ *
+ * The number of slots in the hash sets used by a network interface to look up its unicast and multicast addresses
+ * (one set for each).
+ *
+ * A set can hold up to three quarters of its slots. When the interface has more addresses than that, the lookup falls
+ * back to searching the address list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE
+#define OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
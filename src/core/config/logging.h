@@ -405,4 +405,44 @@
 #define OPENTHREAD_CONFIG_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+ *
+ * Define as 1 to enable compact binary logging.
+ *
+ * When enabled, log lines are not formatted on the device. Instead the format string ID (its offset from the
+ * `otLogBinaryFormatAnchor` symbol) and the raw arguments are captured into a ring buffer, which is drained using
+ * `otLoggingReadBinary()` and decoded offline with `tools/otlog/otlog_decode.py` against the unstripped image.
+ *
+ * This feature requires `OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY` to be disabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+#define OPENTHREAD_CONFIG_LOG_BINARY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+ *
+ * The size (number of bytes) of the binary log ring buffer. Records which do not fit are dropped and counted.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE 4096
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_LENGTH
+ *
+ * The maximum number of chars copied into a binary log record for a `%s` argument (longer strings are truncated).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_LENGTH
+#define OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_LENGTH 80
+#endif
+
 #endif // CONFIG_LOGGING_H_
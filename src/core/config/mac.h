@@ -182,6 +182,22 @@
 #define OPENTHREAD_CONFIG_MAC_TX_NUM_BCAST 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_PIPELINE_DEPTH
+ *
+ * The maximum number of direct data frames which are started back-to-back from the transmit done callback of the
+ * previous frame.
+ *
+ * When the frame transmission completes and more direct frames are pending (e.g., remaining fragments of a large
+ * message), the next frame is prepared and handed to the radio right away instead of from a later tasklet, avoiding
+ * an idle radio transition between consecutive frames. Once the depth is reached, the next frame is scheduled from a
+ * tasklet so that other tasks get a chance to run. Set to zero to disable.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_PIPELINE_DEPTH
+#define OPENTHREAD_CONFIG_MAC_TX_PIPELINE_DEPTH 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS
  *
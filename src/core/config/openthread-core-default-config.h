@@ -150,6 +150,17 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+ *
+ * Define to 1 to enable message pool occupancy statistics (per type/sub type and per queue high-water marks,
+ * allocation failures per priority, and histograms of buffers per message and of message lifetime).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -202,6 +213,32 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE
+ *
+ * The number of compressed 6LoWPAN headers cached by the mesh forwarder.
+ *
+ * The compressed IPv6 (and UDP) header of a message is reused when the same message is framed again towards the same
+ * MAC (or mesh) source and destination, e.g. on data poll triggered retransmissions to a sleepy child, as long as the
+ * network data version is unchanged. Set to zero to disable the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PSKC_CACHE_SIZE
+ *
+ * The number of PSKc values cached by the asynchronous PSKc generation (`otDatasetGeneratePskcAsync()`).
+ *
+ * The entries are keyed by a SHA-256 digest of the (pass-phrase, network name, extended PAN ID) tuple.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PSKC_CACHE_SIZE
+#define OPENTHREAD_CONFIG_PSKC_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -222,6 +259,16 @@
 #define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+ *
+ * Define to 1 to measure the time `Notifier` spends in each core module event handler (using `otPlatTimeGet()`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE
+#define OPENTHREAD_CONFIG_NOTIFIER_HANDLER_STATS_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
  *
@@ -367,6 +414,22 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+ *
+ * The maximum number of records tracked by the RAM index of the flash settings driver.
+ *
+ * The index maps each valid record to its flash offset so that a settings read needs a single flash read. When the
+ * number of valid records exceeds this size, the driver falls back to scanning the flash until the next swap compacts
+ * the records. Define to 0 to disable the index.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
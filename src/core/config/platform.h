@@ -87,6 +87,31 @@
 #define OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+ *
+ * Define to 1 to let the platform generate PSKc outside of the OpenThread processing (see `otPlatPskcGenerate()`).
+ *
+ * When disabled, asynchronous PSKc generation requests are computed within the OpenThread processing.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+ *
+ * Define to 1 to let the platform verify ECDSA signatures outside of the OpenThread processing (see
+ * `otPlatEcdsaVerify()`).
+ *
+ * When disabled, the SRP server verifies signatures of SRP updates within the OpenThread processing.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
  *
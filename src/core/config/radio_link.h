@@ -55,6 +55,21 @@
 #define OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+ *
+ * Set to 1 to enable large frames on TREL radio link. Applicable only when TREL radio link is enabled.
+ *
+ * When enabled, the device advertises in every TREL packet it sends that it can receive frames up to the large TREL
+ * MTU (sized for a 1500-byte infrastructure link MTU). Unicast frames to a neighbor which advertised the same support
+ * can then carry a full IPv6 datagram without 6LoWPAN fragmentation. The TREL UDP platform must be able to receive
+ * packets of that size.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+#define OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE 0
+#endif
+
 //--------------------------------------------------------------
 
 #if !OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && !OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -104,4 +104,17 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE
+ *
+ * Define to 1 to keep the public key of each registered host prepared for signature verification.
+ *
+ * This avoids reading and validating the host KEY record on every SRP update from the same host, at the cost of
+ * holding the public key curve point in the heap for each registered host.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE 1
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
@@ -163,24 +163,72 @@ exit:
 
 Error P256::PublicKey::Verify(const Sha256::Hash &aHash, const Signature &aSignature) const
 {
-    Error                 error = kErrorNone;
-    mbedtls_ecdsa_context ecdsa;
-    mbedtls_mpi           r;
-    mbedtls_mpi           s;
-    int                   ret;
+    Error             error;
+    PreparedPublicKey preparedKey;
 
-    mbedtls_ecdsa_init(&ecdsa);
-    mbedtls_mpi_init(&r);
-    mbedtls_mpi_init(&s);
+    SuccessOrExit(error = preparedKey.Prepare(*this));
+    error = preparedKey.Verify(aHash, aSignature);
 
-    ret = mbedtls_ecp_group_load(&ecdsa.grp, MBEDTLS_ECP_DP_SECP256R1);
+exit:
+    return error;
+}
+
+P256::PreparedPublicKey::PreparedPublicKey(void)
+    : mPrepared(false)
+{
+    mbedtls_ecp_point_init(&mPoint);
+}
+
+Error P256::PreparedPublicKey::Prepare(const PublicKey &aPublicKey)
+{
+    Error             error = kErrorNone;
+    mbedtls_ecp_group group;
+    int               ret;
+
+    Clear();
+    mbedtls_ecp_group_init(&group);
+
+    ret = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256R1);
     VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
 
-    ret = mbedtls_mpi_read_binary(&ecdsa.Q.X, GetBytes(), kMpiSize);
+    ret = mbedtls_mpi_read_binary(&mPoint.X, aPublicKey.GetBytes(), kMpiSize);
+    VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
+    ret = mbedtls_mpi_read_binary(&mPoint.Y, aPublicKey.GetBytes() + kMpiSize, kMpiSize);
     VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
-    ret = mbedtls_mpi_read_binary(&ecdsa.Q.Y, GetBytes() + kMpiSize, kMpiSize);
+    ret = mbedtls_mpi_lset(&mPoint.Z, 1);
     VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
-    ret = mbedtls_mpi_lset(&ecdsa.Q.Z, 1);
+
+    VerifyOrExit(mbedtls_ecp_check_pubkey(&group, &mPoint) == 0, error = kErrorInvalidArgs);
+
+    mPublicKey = aPublicKey;
+    mPrepared  = true;
+
+exit:
+    if (error != kErrorNone)
+    {
+        Clear();
+    }
+
+    mbedtls_ecp_group_free(&group);
+
+    return error;
+}
+
+Error P256::PreparedPublicKey::Verify(const Sha256::Hash &aHash, const Signature &aSignature) const
+{
+    Error             error = kErrorNone;
+    mbedtls_ecp_group group;
+    mbedtls_mpi       r;
+    mbedtls_mpi       s;
+    int               ret;
+
+    mbedtls_ecp_group_init(&group);
+    mbedtls_mpi_init(&r);
+    mbedtls_mpi_init(&s);
+
+    VerifyOrExit(mPrepared, error = kErrorInvalidState);
+
+    ret = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256R1);
     VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
 
     ret = mbedtls_mpi_read_binary(&r, aSignature.mShared.mMpis.mR, kMpiSize);
@@ -189,17 +237,24 @@ Error P256::PublicKey::Verify(const Sha256::Hash &aHash, const Signature &aSigna
     ret = mbedtls_mpi_read_binary(&s, aSignature.mShared.mMpis.mS, kMpiSize);
     VerifyOrExit(ret == 0, error = MbedTls::MapError(ret));
 
-    ret = mbedtls_ecdsa_verify(&ecdsa.grp, aHash.GetBytes(), Sha256::Hash::kSize, &ecdsa.Q, &r, &s);
+    ret = mbedtls_ecdsa_verify(&group, aHash.GetBytes(), Sha256::Hash::kSize, &mPoint, &r, &s);
     VerifyOrExit(ret == 0, error = kErrorSecurity);
 
 exit:
     mbedtls_mpi_free(&s);
     mbedtls_mpi_free(&r);
-    mbedtls_ecdsa_free(&ecdsa);
+    mbedtls_ecp_group_free(&group);
 
     return error;
 }
 
+void P256::PreparedPublicKey::Clear(void)
+{
+    mbedtls_ecp_point_free(&mPoint);
+    mbedtls_ecp_point_init(&mPoint);
+    mPrepared = false;
+}
+
 Error Sign(uint8_t *      aOutput,
            uint16_t &     aOutputLength,
            const uint8_t *aInputHash,
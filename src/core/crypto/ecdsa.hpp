@@ -41,7 +41,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <mbedtls/ecp.h>
+
+#include "common/equatable.hpp"
 #include "common/error.hpp"
+#include "common/non_copyable.hpp"
 #include "crypto/sha256.hpp"
 
 namespace ot {
@@ -76,6 +80,7 @@ public:
 
     class PublicKey;
     class KeyPair;
+    class PreparedPublicKey;
 
     /**
      * This class represents an ECDSA signature.
@@ -89,6 +94,7 @@ public:
     {
         friend class KeyPair;
         friend class PublicKey;
+        friend class PreparedPublicKey;
 
     public:
         enum : uint8_t
@@ -232,7 +238,7 @@ public:
      *
      */
     OT_TOOL_PACKED_BEGIN
-    class PublicKey
+    class PublicKey : public Equatable<PublicKey>
     {
         friend class KeyPair;
 
@@ -267,6 +273,77 @@ public:
     private:
         uint8_t mData[kSize];
     } OT_TOOL_PACKED_END;
+
+    /**
+     * This class represents a public key prepared for repeated signature verification.
+     *
+     * Preparing reads the public key into a curve point and validates it once, so that subsequent verifications with
+     * the same key only perform the signature check itself.
+     *
+     */
+    class PreparedPublicKey : private NonCopyable
+    {
+    public:
+        /**
+         * This constructor initializes the `PreparedPublicKey` as empty (no key).
+         *
+         */
+        PreparedPublicKey(void);
+
+        /**
+         * This destructor frees the resources held by the `PreparedPublicKey`.
+         *
+         */
+        ~PreparedPublicKey(void) { Clear(); }
+
+        /**
+         * This method indicates whether the `PreparedPublicKey` is prepared for a given public key.
+         *
+         * @param[in] aPublicKey   The public key to compare with.
+         *
+         * @retval TRUE   The `PreparedPublicKey` is prepared for @p aPublicKey.
+         * @retval FALSE  The `PreparedPublicKey` is empty or prepared for a different public key.
+         *
+         */
+        bool IsPreparedFor(const PublicKey &aPublicKey) const { return mPrepared && (mPublicKey == aPublicKey); }
+
+        /**
+         * This method prepares the `PreparedPublicKey` for a given public key.
+         *
+         * @param[in] aPublicKey   The public key to prepare.
+         *
+         * @retval kErrorNone          The public key was prepared successfully.
+         * @retval kErrorInvalidArgs   The public key is not a valid P-256 curve point.
+         * @retval kErrorNoBufs        Failed to allocate buffer for the curve point.
+         *
+         */
+        Error Prepare(const PublicKey &aPublicKey);
+
+        /**
+         * This method uses the prepared public key to verify the ECDSA signature of a hashed message.
+         *
+         * @param[in] aHash                The SHA-256 hash value of a message to use for signature verification.
+         * @param[in] aSignature           The signature value to verify.
+         *
+         * @retval kErrorNone          The signature was verified successfully.
+         * @retval kErrorSecurity      The signature is invalid.
+         * @retval kErrorInvalidState  The `PreparedPublicKey` is empty.
+         * @retval kErrorNoBufs        Failed to allocate buffer for signature verification.
+         *
+         */
+        Error Verify(const Sha256::Hash &aHash, const Signature &aSignature) const;
+
+        /**
+         * This method clears the `PreparedPublicKey` and frees the resources held by it.
+         *
+         */
+        void Clear(void);
+
+    private:
+        PublicKey         mPublicKey;
+        mbedtls_ecp_point mPoint;
+        bool              mPrepared;
+    };
 };
 
 /**
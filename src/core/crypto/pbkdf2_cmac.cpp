@@ -33,10 +33,11 @@
 
 #include "pbkdf2_cmac.hpp"
 
-#include <mbedtls/cmac.h>
+#include <limits.h>
 #include <string.h>
 
 #include "common/debug.hpp"
+#include "crypto/aes_ecb.hpp"
 
 namespace ot {
 namespace Crypto {
@@ -44,6 +45,124 @@ namespace Pbkdf2 {
 
 #if OPENTHREAD_FTD
 
+/**
+ * This class implements AES-CMAC (RFC 4493) and AES-CMAC-PRF-128 (RFC 4615).
+ *
+ * The AES key schedule and the CMAC subkeys are computed once when the key is set, so computing the MAC of a single
+ * block costs one AES block encryption. The state is kept in the object (no heap allocation), so the computation can
+ * run on any thread.
+ *
+ */
+class Cmac
+{
+public:
+    enum
+    {
+        kBlockSize = AesEcb::kBlockSize,
+    };
+
+    void SetPrfKey(const uint8_t *aKey, uint16_t aKeyLength);
+    void Compute(const uint8_t *aMessage, uint16_t aLength, uint8_t aMac[kBlockSize]);
+
+private:
+    void        SetKey(const uint8_t aKey[kBlockSize]);
+    static void Double(uint8_t aBlock[kBlockSize]);
+
+    AesEcb  mAes;
+    uint8_t mSubkey1[kBlockSize];
+    uint8_t mSubkey2[kBlockSize];
+};
+
+void Cmac::SetPrfKey(const uint8_t *aKey, uint16_t aKeyLength)
+{
+    uint8_t key[kBlockSize];
+
+    // AES-CMAC-PRF-128 uses the key as is if it is 128 bits long,
+    // otherwise the AES-CMAC of the key with an all-zero key.
+
+    if (aKeyLength == kBlockSize)
+    {
+        memcpy(key, aKey, kBlockSize);
+    }
+    else
+    {
+        memset(key, 0, sizeof(key));
+        SetKey(key);
+        Compute(aKey, aKeyLength, key);
+    }
+
+    SetKey(key);
+}
+
+void Cmac::SetKey(const uint8_t aKey[kBlockSize])
+{
+    uint8_t zero[kBlockSize];
+
+    memset(zero, 0, sizeof(zero));
+
+    mAes.SetKey(aKey, kBlockSize * CHAR_BIT);
+    mAes.Encrypt(zero, mSubkey1);
+
+    Double(mSubkey1);
+    memcpy(mSubkey2, mSubkey1, kBlockSize);
+    Double(mSubkey2);
+}
+
+void Cmac::Double(uint8_t aBlock[kBlockSize])
+{
+    uint8_t carry = 0;
+
+    for (uint8_t i = kBlockSize; i > 0; i--)
+    {
+        uint8_t msb = aBlock[i - 1] >> 7;
+
+        aBlock[i - 1] = static_cast<uint8_t>((aBlock[i - 1] << 1) | carry);
+        carry         = msb;
+    }
+
+    if (carry)
+    {
+        aBlock[kBlockSize - 1] ^= 0x87;
+    }
+}
+
+void Cmac::Compute(const uint8_t *aMessage, uint16_t aLength, uint8_t aMac[kBlockSize])
+{
+    uint8_t state[kBlockSize];
+
+    memset(state, 0, sizeof(state));
+
+    while (aLength > kBlockSize)
+    {
+        for (uint8_t i = 0; i < kBlockSize; i++)
+        {
+            state[i] ^= aMessage[i];
+        }
+
+        mAes.Encrypt(state, state);
+        aMessage += kBlockSize;
+        aLength -= kBlockSize;
+    }
+
+    // The last block is XORed with the first subkey if it is a
+    // complete block, otherwise it is padded and XORed with the
+    // second subkey.
+
+    for (uint8_t i = 0; i < kBlockSize; i++)
+    {
+        if (aLength == kBlockSize)
+        {
+            state[i] ^= aMessage[i] ^ mSubkey1[i];
+        }
+        else
+        {
+            state[i] ^= ((i < aLength) ? aMessage[i] : ((i == aLength) ? 0x80 : 0)) ^ mSubkey2[i];
+        }
+    }
+
+    mAes.Encrypt(state, aMac);
+}
+
 void GenerateKey(const uint8_t *aPassword,
                  uint16_t       aPasswordLen,
                  const uint8_t *aSalt,
@@ -52,25 +171,25 @@ void GenerateKey(const uint8_t *aPassword,
                  uint16_t       aKeyLen,
                  uint8_t *      aKey)
 {
-    const size_t kBlockSize = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t      prfInput[kMaxSaltLength + 4]; // Salt || INT(), for U1 calculation
-    long         prfOne[kBlockSize / sizeof(long)];
-    long         prfTwo[kBlockSize / sizeof(long)];
-    long         keyBlock[kBlockSize / sizeof(long)];
-    uint32_t     blockCounter = 0;
-    uint8_t *    key          = aKey;
-    uint16_t     keyLen       = aKeyLen;
-    uint16_t     useLen       = 0;
-
+    Cmac     cmac;
+    uint8_t  prfInput[kMaxSaltLength + 4]; // Salt || INT(), for U1 calculation
+    uint8_t  prfOutput[Cmac::kBlockSize];
+    uint8_t  keyBlock[Cmac::kBlockSize];
+    uint32_t blockCounter = 0;
+    uint8_t *key          = aKey;
+    uint16_t keyLen       = aKeyLen;
+    uint16_t useLen       = 0;
+
+    OT_ASSERT(aSaltLen <= kMaxSaltLength);
     memcpy(prfInput, aSalt, aSaltLen);
-    OT_ASSERT(aIterationCounter % 2 == 0);
-    aIterationCounter /= 2;
 
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     // limit iterations to avoid OSS-Fuzz timeouts
-    aIterationCounter = 2;
+    aIterationCounter = 4;
 #endif
 
+    cmac.SetPrfKey(aPassword, aPasswordLen);
+
     while (keyLen)
     {
         ++blockCounter;
@@ -80,34 +199,21 @@ void GenerateKey(const uint8_t *aPassword,
         prfInput[aSaltLen + 3] = static_cast<uint8_t>(blockCounter);
 
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, prfInput, aSaltLen + 4,
-                                 reinterpret_cast<uint8_t *>(keyBlock));
-
-        // Calculate U_2
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(keyBlock), kBlockSize,
-                                 reinterpret_cast<uint8_t *>(prfOne));
-
-        for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
-        {
-            keyBlock[j] ^= prfOne[j];
-        }
+        cmac.Compute(prfInput, aSaltLen + 4, prfOutput);
+        memcpy(keyBlock, prfOutput, sizeof(keyBlock));
 
         for (uint32_t i = 1; i < aIterationCounter; ++i)
         {
-            // Calculate U_{2 * i - 1}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfOne), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfTwo));
-            // Calculate U_{2 * i}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfTwo), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfOne));
-
-            for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
+            // Calculate U_{i + 1}
+            cmac.Compute(prfOutput, sizeof(prfOutput), prfOutput);
+
+            for (uint8_t j = 0; j < Cmac::kBlockSize; ++j)
             {
-                keyBlock[j] ^= prfOne[j] ^ prfTwo[j];
+                keyBlock[j] ^= prfOutput[j];
             }
         }
 
-        useLen = (keyLen < kBlockSize) ? keyLen : kBlockSize;
+        useLen = (keyLen < Cmac::kBlockSize) ? keyLen : static_cast<uint16_t>(Cmac::kBlockSize);
         memcpy(key, keyBlock, useLen);
         key += useLen;
         keyLen -= useLen;
@@ -74,6 +74,8 @@ DataPollHandler::DataPollHandler(Instance &aInstance)
     , mIndirectTxChild(nullptr)
     , mFrameContext()
     , mCallbacks(aInstance)
+    , mPendingPollsHead(0)
+    , mNumPendingPolls(0)
 {
 }
 
@@ -87,7 +89,9 @@ void DataPollHandler::Clear(void)
         child.ResetIndirectTxAttempts();
     }
 
-    mIndirectTxChild = nullptr;
+    mIndirectTxChild  = nullptr;
+    mPendingPollsHead = 0;
+    mNumPendingPolls  = 0;
 }
 
 void DataPollHandler::HandleNewFrame(Child &aChild)
@@ -164,7 +168,7 @@ void DataPollHandler::HandleDataPoll(Mac::RxFrame &aFrame)
     }
     else
     {
-        child->SetDataPollPending(true);
+        EnqueuePendingPoll(*child);
     }
 
 exit:
@@ -304,26 +308,88 @@ exit:
 
 void DataPollHandler::ProcessPendingPolls(void)
 {
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    // The children are served in the order their data polls were
+    // received.
+
+    if (mIndirectTxChild == nullptr)
     {
-        if (!child.IsDataPollPending())
-        {
-            continue;
-        }
+        mIndirectTxChild = DequeuePendingPoll();
+    }
+
+    if (mIndirectTxChild != nullptr)
+    {
+        Get<Mac::Mac>().RequestIndirectFrameTransmission();
+    }
+}
+
+void DataPollHandler::EnqueuePendingPoll(Child &aChild)
+{
+    VerifyOrExit(!aChild.IsDataPollPending());
+
+    aChild.SetDataPollPending(true);
+
+    // The queue can only be full if it contains ignored entries, since
+    // a child is added only once while its poll is pending.
+
+    if (mNumPendingPolls == kMaxChildren)
+    {
+        CompactPendingPolls();
+    }
+
+    OT_ASSERT(mNumPendingPolls < kMaxChildren);
+
+    mPendingPolls[(mPendingPollsHead + mNumPendingPolls) % kMaxChildren] = Get<ChildTable>().GetChildIndex(aChild);
+    mNumPendingPolls++;
 
-        // Find the child with earliest poll receive time.
+exit:
+    return;
+}
 
-        if ((mIndirectTxChild == nullptr) || (child.GetLastHeard() < mIndirectTxChild->GetLastHeard()))
+Child *DataPollHandler::DequeuePendingPoll(void)
+{
+    Child *child = nullptr;
+
+    while (mNumPendingPolls > 0)
+    {
+        Child *candidate = Get<ChildTable>().GetChildAtIndex(mPendingPolls[mPendingPollsHead]);
+
+        mPendingPollsHead = (mPendingPollsHead + 1) % kMaxChildren;
+        mNumPendingPolls--;
+
+        if (candidate->IsStateValidOrRestoring() && candidate->IsDataPollPending())
         {
-            mIndirectTxChild = &child;
+            candidate->SetDataPollPending(false);
+            child = candidate;
+            break;
         }
     }
 
-    if (mIndirectTxChild != nullptr)
+    return child;
+}
+
+void DataPollHandler::CompactPendingPolls(void)
+{
+    ChildMask queued;
+    uint16_t  numPendingPolls = 0;
+
+    queued.Clear();
+
+    for (uint16_t i = 0; i < mNumPendingPolls; i++)
     {
-        mIndirectTxChild->SetDataPollPending(false);
-        Get<Mac::Mac>().RequestIndirectFrameTransmission();
+        uint16_t childIndex = mPendingPolls[(mPendingPollsHead + i) % kMaxChildren];
+        Child &  child      = *Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if (!child.IsStateValidOrRestoring() || !child.IsDataPollPending() || queued.Get(childIndex))
+        {
+            continue;
+        }
+
+        queued.Set(childIndex, true);
+        mPendingPolls[(mPendingPollsHead + numPendingPolls) % kMaxChildren] = childIndex;
+        numPendingPolls++;
     }
+
+    mNumPendingPolls = numPendingPolls;
 }
 
 } // namespace ot
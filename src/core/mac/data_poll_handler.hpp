@@ -44,6 +44,7 @@
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
+#include "thread/child_mask.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
 
 namespace ot {
@@ -271,13 +272,21 @@ public:
     void RequestFrameChange(FrameChange aChange, Child &aChild);
 
 private:
+    enum : uint16_t
+    {
+        kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    };
+
     // Callbacks from MAC
     void          HandleDataPoll(Mac::RxFrame &aFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     void          HandleSentFrame(const Mac::TxFrame &aFrame, Error aError);
 
-    void HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, Child &aChild);
-    void ProcessPendingPolls(void);
+    void   HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, Child &aChild);
+    void   ProcessPendingPolls(void);
+    void   EnqueuePendingPoll(Child &aChild);
+    Child *DequeuePendingPoll(void);
+    void   CompactPendingPolls(void);
 
     // In the current implementation of `DataPollHandler`, we can have a
     // single indirect tx operation active at MAC layer at each point of
@@ -288,6 +297,16 @@ private:
     Child *                 mIndirectTxChild;
     Callbacks::FrameContext mFrameContext;
     Callbacks               mCallbacks;
+
+    // The children with a data poll received while an indirect tx
+    // was active, in the order the polls were received. This is a
+    // circular buffer of child table indexes. An entry is ignored if
+    // the child is no longer valid or its poll is no longer pending
+    // (e.g., the child was removed).
+
+    uint16_t mPendingPolls[kMaxChildren];
+    uint16_t mPendingPollsHead;
+    uint16_t mNumPendingPolls;
 };
 
 /**
@@ -212,10 +212,15 @@ exit:
 
 void LinkRaw::InvokeEnergyScanDone(int8_t aEnergyScanMaxRssi)
 {
-    if (IsEnabled() && mEnergyScanDoneCallback != nullptr)
+    otLinkRawEnergyScanDone callback = mEnergyScanDoneCallback;
+
+    // Clear the callback before invoking it, so that the callback can
+    // start the energy scan of the next channel.
+    mEnergyScanDoneCallback = nullptr;
+
+    if (IsEnabled() && callback != nullptr)
     {
-        mEnergyScanDoneCallback(&GetInstance(), aEnergyScanMaxRssi);
-        mEnergyScanDoneCallback = nullptr;
+        callback(&GetInstance(), aEnergyScanMaxRssi);
     }
 }
 
@@ -330,6 +330,20 @@ void Mac::PerformEnergyScan(void)
 {
     Error error = kErrorNone;
 
+    if ((mScanChannel == ChannelMask::kChannelIteratorFirst) && mLinks.SupportsMultiChannelEnergyScan())
+    {
+        VerifyOrExit(IsEnabled(), error = kErrorAbort);
+        VerifyOrExit(!mScanChannelMask.IsEmpty(), error = kErrorNotFound);
+
+        // Scan all channels as a single radio operation, fall back to
+        // scanning them one at a time if the radio rejects the request.
+
+        if (mLinks.MultiChannelEnergyScan(mScanChannelMask.GetMask(), mScanDuration) == kErrorNone)
+        {
+            ExitNow();
+        }
+    }
+
     SuccessOrExit(error = UpdateScanChannel());
 
     if (mScanDuration == 0)
@@ -382,6 +396,29 @@ void Mac::EnergyScanDone(int8_t aEnergyScanMaxRssi)
     PerformEnergyScan();
 }
 
+void Mac::MultiChannelEnergyScanDone(const EnergyScanResult *aResults, uint8_t aNumResults)
+{
+    VerifyOrExit(mOperation == kOperationEnergyScan);
+
+    for (uint8_t index = 0; index < aNumResults; index++)
+    {
+        if (mScanChannelMask.ContainsChannel(aResults[index].mChannel))
+        {
+            mScanChannel = aResults[index].mChannel;
+            ReportEnergyScanResult(aResults[index].mMaxRssi);
+        }
+    }
+
+    // All channels were scanned, move the iterator past the last
+    // channel so that `PerformEnergyScan()` finishes the operation.
+
+    mScanChannel = Radio::kChannelMax;
+    PerformEnergyScan();
+
+exit:
+    return;
+}
+
 void Mac::SetRxOnWhenIdle(bool aRxOnWhenIdle)
 {
     VerifyOrExit(mRxOnWhenIdle != aRxOnWhenIdle);
@@ -2471,7 +2508,7 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
                  static_cast<uint32_t>(aFrame.GetTimestamp()), aFrame.GetSequence(), csl->GetPeriod(), csl->GetPhase(),
                  child->GetCslPhase());
 
-    Get<CslTxScheduler>().Update();
+    Get<CslTxScheduler>().Update(*child);
 
 exit:
     return;
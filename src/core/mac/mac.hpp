@@ -176,6 +176,24 @@ public:
      */
     void EnergyScanDone(int8_t aEnergyScanMaxRssi);
 
+    /**
+     * This method indicates the energy scan of multiple channels as a single radio operation is complete.
+     *
+     * @param[in]  aResults     A pointer to an array with the results of the scanned channels.
+     * @param[in]  aNumResults  The number of entries in @p aResults.
+     *
+     */
+    void MultiChannelEnergyScanDone(const EnergyScanResult *aResults, uint8_t aNumResults);
+
+    /**
+     * This method indicates whether the radio supports energy scan of multiple channels as a single operation.
+     *
+     * @retval TRUE   Multi-channel energy scan is supported.
+     * @retval FALSE  Multi-channel energy scan is not supported.
+     *
+     */
+    bool IsMultiChannelEnergyScanSupported(void) const { return mLinks.SupportsMultiChannelEnergyScan(); }
+
     /**
      * This method indicates whether or not IEEE 802.15.4 Beacon transmissions are enabled.
      *
@@ -594,6 +594,47 @@ public:
 #endif
     }
 
+    /**
+     * This method begins energy scan of multiple channels as a single radio operation.
+     *
+     * @param[in] aScanChannels  A bit-vector indicating the channels to perform the energy scan on.
+     * @param[in] aScanDuration  The duration, in milliseconds, for each channel to be scanned.
+     *
+     * @retval kErrorNone            Successfully started scanning the channels.
+     * @retval kErrorInvalidState    The radio was disabled or transmitting.
+     * @retval kErrorNotImplemented  Multi-channel energy scan is not supported by radio link.
+     *
+     */
+    Error MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration)
+    {
+        OT_UNUSED_VARIABLE(aScanChannels);
+        OT_UNUSED_VARIABLE(aScanDuration);
+
+        return
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+            mSubMac.MultiChannelEnergyScan(aScanChannels, aScanDuration);
+#else
+            kErrorNotImplemented;
+#endif
+    }
+
+    /**
+     * This method indicates whether the radio link supports energy scan of multiple channels as a single operation.
+     *
+     * @retval TRUE   Multi-channel energy scan is supported.
+     * @retval FALSE  Multi-channel energy scan is not supported.
+     *
+     */
+    bool SupportsMultiChannelEnergyScan(void) const
+    {
+        return
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+            mSubMac.RadioSupportsMultiChannelEnergyScan();
+#else
+            false;
+#endif
+    }
+
     /**
      * This method returns the noise floor value (currently use the radio receive sensitivity value).
      *
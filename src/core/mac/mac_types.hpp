@@ -398,6 +398,28 @@ public:
      */
     bool IsShortAddrInvalid(void) const { return ((mType == kTypeShort) && (GetShort() == kShortAddrInvalid)); }
 
+    /**
+     * This method overloads operator `==` to evaluate whether or not two `Address` instances are equal.
+     *
+     * @param[in]  aOther  The other `Address` instance to compare with.
+     *
+     * @retval TRUE   If the two `Address` instances have the same type and value.
+     * @retval FALSE  If the two `Address` instances are not equal.
+     *
+     */
+    bool operator==(const Address &aOther) const;
+
+    /**
+     * This method overloads operator `!=` to evaluate whether or not two `Address` instances are unequal.
+     *
+     * @param[in]  aOther  The other `Address` instance to compare with.
+     *
+     * @retval TRUE   If the two `Address` instances are not equal.
+     * @retval FALSE  If the two `Address` instances are equal.
+     *
+     */
+    bool operator!=(const Address &aOther) const { return !(*this == aOther); }
+
     /**
      * This method converts an address to a null-terminated string
      *
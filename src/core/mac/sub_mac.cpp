@@ -45,6 +45,7 @@
 #include "common/logging.hpp"
 #include "common/random.hpp"
 #include "common/time.hpp"
+#include "utils/packet_trace.hpp"
 
 namespace ot {
 namespace Mac {
@@ -397,6 +398,7 @@ void SubMac::StartCsmaBackoff(void)
     }
 #endif // !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     SetState(kStateCsmaBackoff);
+    OT_PACKET_TRACE(kCsmaBackoff, nullptr, 0);
 
     VerifyOrExit(ShouldHandleCsmaBackOff(), BeginTransmit());
 
@@ -446,6 +448,7 @@ void SubMac::BeginTransmit(void)
     }
 
     SetState(kStateTransmit);
+    OT_PACKET_TRACE(kTxStart, nullptr, 0);
 
     if (mPcapCallback)
     {
@@ -468,6 +471,11 @@ exit:
 
 void SubMac::HandleTransmitStarted(TxFrame &aFrame)
 {
+    if (aFrame.GetAckRequest())
+    {
+        OT_PACKET_TRACE(kAckWait, nullptr, 0);
+    }
+
     if (ShouldHandleAckTimeout() && aFrame.GetAckRequest())
     {
 #if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
@@ -544,6 +552,7 @@ void SubMac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aErro
     if (shouldRetx)
     {
         mTransmitRetries++;
+        OT_PACKET_TRACE(kRetry, nullptr, 0);
         aFrame.SetIsARetransmission(true);
         StartCsmaBackoff();
         ExitNow();
@@ -600,9 +609,9 @@ int8_t SubMac::GetNoiseFloor(void)
     return Get<Radio>().GetReceiveSensitivity();
 }
 
-Error SubMac::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
+bool SubMac::CanStartEnergyScan(void) const
 {
-    Error error = kErrorNone;
+    bool canStart = false;
 
     switch (mState)
     {
@@ -613,16 +622,26 @@ Error SubMac::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
     case kStateCslTransmit:
 #endif
     case kStateEnergyScan:
-        ExitNow(error = kErrorInvalidState);
+        break;
 
     case kStateReceive:
     case kStateSleep:
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     case kStateCslSample:
 #endif
+        canStart = true;
         break;
     }
 
+    return canStart;
+}
+
+Error SubMac::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(CanStartEnergyScan(), error = kErrorInvalidState);
+
     if (RadioSupportsEnergyScan())
     {
         IgnoreError(Get<Radio>().EnergyScan(aScanChannel, aScanDuration));
@@ -647,6 +666,20 @@ exit:
     return error;
 }
 
+Error SubMac::MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(RadioSupportsMultiChannelEnergyScan(), error = kErrorNotImplemented);
+    VerifyOrExit(CanStartEnergyScan(), error = kErrorInvalidState);
+
+    SuccessOrExit(error = Get<Radio>().MultiChannelEnergyScan(aScanChannels, aScanDuration));
+    SetState(kStateEnergyScan);
+
+exit:
+    return error;
+}
+
 void SubMac::SampleRssi(void)
 {
     OT_ASSERT(!RadioSupportsEnergyScan());
@@ -681,6 +714,12 @@ void SubMac::HandleEnergyScanDone(int8_t aMaxRssi)
     mCallbacks.EnergyScanDone(aMaxRssi);
 }
 
+void SubMac::HandleMultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults)
+{
+    SetState(kStateReceive);
+    mCallbacks.MultiChannelEnergyScanDone(aResults, aNumResults);
+}
+
 void SubMac::HandleTimer(Timer &aTimer)
 {
     aTimer.Get<SubMac>().HandleTimer();
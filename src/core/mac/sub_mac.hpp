@@ -181,6 +181,15 @@ public:
          */
         void EnergyScanDone(int8_t aMaxRssi);
 
+        /**
+         * This method notifies user of `SubMac` that a multi-channel energy scan is complete.
+         *
+         * @param[in]  aResults     A pointer to an array with the results of the scanned channels.
+         * @param[in]  aNumResults  The number of entries in @p aResults.
+         *
+         */
+        void MultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults);
+
         /**
          * This method notifies user of `SubMac` that MAC frame counter is updated.
          *
@@ -369,6 +378,33 @@ public:
      */
     Error EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration);
 
+    /**
+     * This method begins energy scan of multiple channels as a single radio operation.
+     *
+     * The results are reported through `Callbacks::MultiChannelEnergyScanDone()`.
+     *
+     * @param[in] aScanChannels  A bit-vector indicating the channels to perform the energy scan on.
+     * @param[in] aScanDuration  The duration, in milliseconds, for each channel to be scanned.
+     *
+     * @retval kErrorNone            Successfully started scanning the channels.
+     * @retval kErrorInvalidState    The radio was disabled or transmitting.
+     * @retval kErrorNotImplemented  The radio does not support multi-channel energy scan.
+     *
+     */
+    Error MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration);
+
+    /**
+     * This method indicates whether the radio supports energy scan of multiple channels as a single operation.
+     *
+     * @retval TRUE   The radio supports multi-channel energy scan.
+     * @retval FALSE  The radio does not support multi-channel energy scan.
+     *
+     */
+    bool RadioSupportsMultiChannelEnergyScan(void) const
+    {
+        return ((mRadioCaps & OT_RADIO_CAPS_MULTI_ENERGY_SCAN) != 0);
+    }
+
     /**
      * This method returns the noise floor value (currently use the radio receive sensitivity value).
      *
@@ -579,6 +615,7 @@ private:
     bool ShouldHandleAckTimeout(void) const;
     bool ShouldHandleRetries(void) const;
     bool ShouldHandleEnergyScan(void) const;
+    bool CanStartEnergyScan(void) const;
     bool ShouldHandleTransmitTargetTime(void) const;
 
     void ProcessTransmitSecurity(void);
@@ -592,6 +629,7 @@ private:
     void HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aError);
     void UpdateFrameCounterOnTxDone(const TxFrame &aFrame);
     void HandleEnergyScanDone(int8_t aMaxRssi);
+    void HandleMultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
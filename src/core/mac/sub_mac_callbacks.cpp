@@ -107,6 +107,11 @@ void SubMac::Callbacks::EnergyScanDone(int8_t aMaxRssi)
     }
 }
 
+void SubMac::Callbacks::MultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults)
+{
+    Get<Mac>().MultiChannelEnergyScanDone(aResults, aNumResults);
+}
+
 void SubMac::Callbacks::FrameCounterUpdated(uint32_t aFrameCounter)
 {
     Get<KeyManager>().MacFrameCounterUpdated(aFrameCounter);
@@ -142,6 +147,10 @@ void SubMac::Callbacks::EnergyScanDone(int8_t aMaxRssi)
     Get<LinkRaw>().InvokeEnergyScanDone(aMaxRssi);
 }
 
+void SubMac::Callbacks::MultiChannelEnergyScanDone(const otEnergyScanResult *, uint8_t)
+{
+}
+
 void SubMac::Callbacks::FrameCounterUpdated(uint32_t aFrameCounter)
 {
     OT_UNUSED_VARIABLE(aFrameCounter);
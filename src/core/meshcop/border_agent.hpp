@@ -54,6 +54,8 @@ class BorderAgent : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventCommissionerStateChanged;
+
 public:
     /**
      * This enumeration defines the Border Agent state.
@@ -59,6 +59,8 @@ class DatasetUpdater : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventActiveDatasetChanged | kEventPendingDatasetChanged;
+
 public:
     /**
      * This constructor initializes a `DatasetUpdater` object.
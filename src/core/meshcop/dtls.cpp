@@ -108,6 +108,13 @@ Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
 #ifdef MBEDTLS_SSL_COOKIE_C
     memset(&mCookieCtx, 0, sizeof(mCookieCtx));
 #endif
+
+    mHandshakeCounters.Clear();
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    ClearSessionCache();
+    mSessionResumed = false;
+#endif
 }
 
 void Dtls::FreeMbedtls(void)
@@ -297,6 +304,17 @@ Error Dtls::Setup(bool aClient)
     mbedtls_ssl_conf_handshake_timeout(&mConf, 8000, 60000);
     mbedtls_ssl_conf_dbg(&mConf, HandleMbedtlsDebug, this);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    mSessionResumed = false;
+
+#ifdef MBEDTLS_SSL_SRV_C
+    if (!aClient && (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8))
+    {
+        mbedtls_ssl_conf_session_cache(&mConf, this, HandleMbedtlsGetCache, HandleMbedtlsSetCache);
+    }
+#endif
+#endif
+
 #if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
     if (!aClient)
     {
@@ -316,6 +334,13 @@ Error Dtls::Setup(bool aClient)
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
         rval = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+        if ((rval == 0) && aClient)
+        {
+            rval = RestoreClientSession();
+        }
+#endif
     }
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     else
@@ -798,6 +823,7 @@ void Dtls::Process(void)
             if (mSsl.state == MBEDTLS_SSL_HANDSHAKE_OVER)
             {
                 mState = kStateConnected;
+                HandleHandshakeComplete();
 
                 if (mConnectedHandler != nullptr)
                 {
@@ -864,6 +890,9 @@ void Dtls::Process(void)
             {
                 mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
             }
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+            mSessionResumed = false;
+#endif
             break;
         }
     }
@@ -876,6 +905,205 @@ exit:
     }
 }
 
+void Dtls::HandleHandshakeComplete(void)
+{
+    bool resumed = false;
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    if ((mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8) && (mConf.endpoint == MBEDTLS_SSL_IS_CLIENT))
+    {
+        CachedSession *cachedSession = FindClientSession();
+
+        // A server resuming the offered session echoes its session ID,
+        // otherwise it assigns a new one.
+        mSessionResumed = (cachedSession != nullptr) && (cachedSession->mIdLength == mSsl.session->id_len) &&
+                          (memcmp(cachedSession->mId, mSsl.session->id, cachedSession->mIdLength) == 0);
+
+        if (mSsl.session->id_len != 0)
+        {
+            SaveSession((cachedSession != nullptr) ? *cachedSession : AllocateCachedSession(), *mSsl.session,
+                        /* aIsClient */ true);
+        }
+    }
+
+    resumed = mSessionResumed;
+#endif
+
+    if (resumed)
+    {
+        mHandshakeCounters.mResumed++;
+        otLogInfoMeshCoP("DTLS session resumed");
+    }
+    else
+    {
+        mHandshakeCounters.mFull++;
+    }
+}
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+
+void Dtls::ClearSessionCache(void)
+{
+    for (CachedSession &cachedSession : mSessionCache)
+    {
+        cachedSession.Clear();
+    }
+}
+
+int Dtls::HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsGetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsGetCache(mbedtls_ssl_session &aSession)
+{
+    int rval = 1;
+
+    for (const CachedSession &cachedSession : mSessionCache)
+    {
+        if (cachedSession.mIsClient || !IsCachedSessionUsable(cachedSession) ||
+            (cachedSession.mCipherSuite != aSession.ciphersuite) || (cachedSession.mIdLength != aSession.id_len) ||
+            (memcmp(cachedSession.mId, aSession.id, cachedSession.mIdLength) != 0))
+        {
+            continue;
+        }
+
+        memcpy(aSession.master, cachedSession.mMasterSecret, sizeof(aSession.master));
+#ifdef MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+        aSession.mfl_code = cachedSession.mMaxFragmentLengthCode;
+#endif
+        mSessionResumed = true;
+        ExitNow(rval = 0);
+    }
+
+exit:
+    return rval;
+}
+
+int Dtls::HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsSetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession)
+{
+    int            rval          = 1;
+    CachedSession *cachedSession = nullptr;
+
+    VerifyOrExit((aSession.ciphersuite == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8) && (aSession.id_len != 0));
+
+    for (CachedSession &entry : mSessionCache)
+    {
+        if (!entry.mIsClient && (entry.mIdLength == aSession.id_len) &&
+            (memcmp(entry.mId, aSession.id, entry.mIdLength) == 0))
+        {
+            cachedSession = &entry;
+            break;
+        }
+    }
+
+    SaveSession((cachedSession != nullptr) ? *cachedSession : AllocateCachedSession(), aSession,
+                /* aIsClient */ false);
+    rval = 0;
+
+exit:
+    return rval;
+}
+
+bool Dtls::IsCachedSessionUsable(const CachedSession &aSession) const
+{
+    // A session is only resumed with the PSK it was established with.
+    return aSession.IsInUse() && (TimerMilli::GetNow() < aSession.mExpireTime) &&
+           (aSession.mPskLength == mPskLength) && (memcmp(aSession.mPsk, mPsk, mPskLength) == 0);
+}
+
+Dtls::CachedSession *Dtls::FindClientSession(void)
+{
+    Ip6::SockAddr  peerSockAddr(mMessageInfo.GetPeerAddr(), mMessageInfo.GetPeerPort());
+    CachedSession *cachedSession = nullptr;
+
+    for (CachedSession &entry : mSessionCache)
+    {
+        if (entry.mIsClient && entry.IsInUse() && (entry.mPeerSockAddr == peerSockAddr))
+        {
+            cachedSession = &entry;
+            break;
+        }
+    }
+
+    return cachedSession;
+}
+
+Dtls::CachedSession &Dtls::AllocateCachedSession(void)
+{
+    CachedSession *oldest = &mSessionCache[0];
+
+    // Prefer an unused or unusable entry, otherwise evict the oldest one.
+
+    for (CachedSession &entry : mSessionCache)
+    {
+        if (!IsCachedSessionUsable(entry))
+        {
+            ExitNow(oldest = &entry);
+        }
+
+        if (entry.mExpireTime < oldest->mExpireTime)
+        {
+            oldest = &entry;
+        }
+    }
+
+exit:
+    return *oldest;
+}
+
+void Dtls::SaveSession(CachedSession &aCachedSession, const mbedtls_ssl_session &aSession, bool aIsClient)
+{
+    static_assert(sizeof(aCachedSession.mId) == sizeof(aSession.id), "Session ID length does not match mbedtls");
+    static_assert(sizeof(aCachedSession.mMasterSecret) == sizeof(aSession.master),
+                  "Master secret length does not match mbedtls");
+
+    aCachedSession.mExpireTime = TimerMilli::GetNow() + kSessionCacheLifetime;
+    aCachedSession.mPeerSockAddr.SetAddress(mMessageInfo.GetPeerAddr());
+    aCachedSession.mPeerSockAddr.SetPort(mMessageInfo.GetPeerPort());
+    aCachedSession.mCipherSuite = aSession.ciphersuite;
+    aCachedSession.mIdLength    = static_cast<uint8_t>(aSession.id_len);
+    memcpy(aCachedSession.mId, aSession.id, aSession.id_len);
+    memcpy(aCachedSession.mMasterSecret, aSession.master, sizeof(aCachedSession.mMasterSecret));
+#ifdef MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+    aCachedSession.mMaxFragmentLengthCode = aSession.mfl_code;
+#endif
+    memcpy(aCachedSession.mPsk, mPsk, mPskLength);
+    aCachedSession.mPskLength = mPskLength;
+    aCachedSession.mIsClient  = aIsClient;
+}
+
+int Dtls::RestoreClientSession(void)
+{
+    int                 rval          = 0;
+    CachedSession *     cachedSession = FindClientSession();
+    mbedtls_ssl_session session;
+
+    VerifyOrExit((cachedSession != nullptr) && IsCachedSessionUsable(*cachedSession));
+
+    mbedtls_ssl_session_init(&session);
+    session.ciphersuite = cachedSession->mCipherSuite;
+    session.id_len      = cachedSession->mIdLength;
+    memcpy(session.id, cachedSession->mId, cachedSession->mIdLength);
+    memcpy(session.master, cachedSession->mMasterSecret, sizeof(session.master));
+#ifdef MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+    session.mfl_code = cachedSession->mMaxFragmentLengthCode;
+#endif
+
+    rval = mbedtls_ssl_set_session(&mSsl, &session);
+    mbedtls_ssl_session_free(&session);
+
+exit:
+    return rval;
+}
+
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+
 void Dtls::HandleMbedtlsDebug(void *aContext, int aLevel, const char *aFile, int aLine, const char *aStr)
 {
     static_cast<Dtls *>(aContext)->HandleMbedtlsDebug(aLevel, aFile, aLine, aStr);
@@ -51,6 +51,7 @@
 #endif
 #endif
 
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
@@ -72,6 +73,16 @@ public:
         kPskMaxLength = 32, ///< Maximum PSK length.
     };
 
+    /**
+     * This structure represents the DTLS handshake counters.
+     *
+     */
+    struct HandshakeCounters : public Clearable<HandshakeCounters>
+    {
+        uint32_t mFull;    ///< Number of handshakes completed with a full key exchange.
+        uint32_t mResumed; ///< Number of handshakes completed by resuming a cached session.
+    };
+
     /**
      * This constructor initializes the DTLS object.
      *
@@ -342,6 +353,28 @@ public:
      */
     const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
 
+    /**
+     * This method returns the DTLS handshake counters.
+     *
+     * @returns A reference to the DTLS handshake counters.
+     *
+     */
+    const HandshakeCounters &GetHandshakeCounters(void) const { return mHandshakeCounters; }
+
+    /**
+     * This method resets the DTLS handshake counters.
+     *
+     */
+    void ResetHandshakeCounters(void) { mHandshakeCounters.Clear(); }
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    /**
+     * This method removes all the cached DTLS sessions, so that the next handshake with any peer is a full one.
+     *
+     */
+    void ClearSessionCache(void);
+#endif
+
     void HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
@@ -365,8 +398,35 @@ private:
 #endif
     };
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    enum
+    {
+        kSessionCacheSize     = OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE,
+        kSessionIdMaxLength   = 32,
+        kMasterSecretLength   = 48,
+        kSessionCacheLifetime = OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_LIFETIME * 1000u, // in msec
+    };
+
+    struct CachedSession : public Clearable<CachedSession>
+    {
+        bool IsInUse(void) const { return mIdLength != 0; }
+
+        TimeMilli     mExpireTime;
+        Ip6::SockAddr mPeerSockAddr; // Used by a client to find the session of a server.
+        int           mCipherSuite;
+        uint8_t       mId[kSessionIdMaxLength];
+        uint8_t       mIdLength;
+        uint8_t       mMasterSecret[kMasterSecretLength];
+        uint8_t       mMaxFragmentLengthCode;
+        uint8_t       mPsk[kPskMaxLength];
+        uint8_t       mPskLength;
+        bool          mIsClient;
+    };
+#endif
+
     void  FreeMbedtls(void);
     Error Setup(bool aClient);
+    void  HandleHandshakeComplete(void);
 
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     /**
@@ -405,6 +465,20 @@ private:
                                        size_t               aKeyLength,
                                        size_t               aIvLength);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    static int HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsGetCache(mbedtls_ssl_session &aSession);
+
+    static int HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession);
+
+    bool           IsCachedSessionUsable(const CachedSession &aSession) const;
+    CachedSession *FindClientSession(void);
+    CachedSession &AllocateCachedSession(void);
+    void           SaveSession(CachedSession &aCachedSession, const mbedtls_ssl_session &aSession, bool aIsClient);
+    int            RestoreClientSession(void);
+#endif
+
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
@@ -448,6 +522,13 @@ private:
 
     bool mVerifyPeerCertificate;
 
+    HandshakeCounters mHandshakeCounters;
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+    CachedSession mSessionCache[kSessionCacheSize];
+    bool          mSessionResumed;
+#endif
+
     mbedtls_ssl_context mSsl;
     mbedtls_ssl_config  mConf;
 
@@ -58,6 +58,8 @@ class JoinerRouter : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
 public:
     /**
      * This constructor initializes the Joiner Router object.
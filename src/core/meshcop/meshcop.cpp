@@ -314,6 +314,26 @@ exit:
 }
 
 #if OPENTHREAD_FTD
+Error ValidatePskcInputs(const char *aPassPhrase, const Mac::NetworkName &aNetworkName)
+{
+    Error    error = kErrorNone;
+    uint16_t passphraseLen;
+    uint8_t  networkNameLen;
+
+    VerifyOrExit(IsValidUtf8String(aPassPhrase), error = kErrorInvalidArgs);
+
+    passphraseLen  = static_cast<uint16_t>(StringLength(aPassPhrase, OT_COMMISSIONING_PASSPHRASE_MAX_SIZE + 1));
+    networkNameLen = static_cast<uint8_t>(StringLength(aNetworkName.GetAsCString(), OT_NETWORK_NAME_MAX_SIZE + 1));
+
+    VerifyOrExit((passphraseLen >= OT_COMMISSIONING_PASSPHRASE_MIN_SIZE) &&
+                     (passphraseLen <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE) &&
+                     (networkNameLen <= OT_NETWORK_NAME_MAX_SIZE),
+                 error = kErrorInvalidArgs);
+
+exit:
+    return error;
+}
+
 Error GeneratePskc(const char *              aPassPhrase,
                    const Mac::NetworkName &  aNetworkName,
                    const Mac::ExtendedPanId &aExtPanId,
@@ -326,16 +346,11 @@ Error GeneratePskc(const char *              aPassPhrase,
     uint16_t   passphraseLen;
     uint8_t    networkNameLen;
 
-    VerifyOrExit(IsValidUtf8String(aPassPhrase), error = kErrorInvalidArgs);
+    SuccessOrExit(error = ValidatePskcInputs(aPassPhrase, aNetworkName));
 
     passphraseLen  = static_cast<uint16_t>(StringLength(aPassPhrase, OT_COMMISSIONING_PASSPHRASE_MAX_SIZE + 1));
     networkNameLen = static_cast<uint8_t>(StringLength(aNetworkName.GetAsCString(), OT_NETWORK_NAME_MAX_SIZE + 1));
 
-    VerifyOrExit((passphraseLen >= OT_COMMISSIONING_PASSPHRASE_MIN_SIZE) &&
-                     (passphraseLen <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE) &&
-                     (networkNameLen <= OT_NETWORK_NAME_MAX_SIZE),
-                 error = kErrorInvalidArgs);
-
     memset(salt, 0, sizeof(salt));
     memcpy(salt, saltPrefix, sizeof(saltPrefix) - 1);
     saltLen += static_cast<uint16_t>(sizeof(saltPrefix) - 1);
@@ -427,6 +427,19 @@ inline Coap::Message *NewMeshCoPMessage(Coap::CoapBase &aCoap)
     return aCoap.NewMessage(Message::Settings(Message::kWithLinkSecurity, Message::kPriorityNet));
 }
 
+/**
+ * This function validates the inputs of a PSKc generation.
+ *
+ * @param[in]  aPassPhrase   The commissioning passphrase.
+ * @param[in]  aNetworkName  The network name for PSKc computation.
+ *
+ * @retval kErrorNone          The inputs are valid.
+ * @retval kErrorInvalidArgs   If the passphrase is not valid UTF-8 or its length is out of range, or if the network
+ *                             name is too long.
+ *
+ */
+Error ValidatePskcInputs(const char *aPassPhrase, const Mac::NetworkName &aNetworkName);
+
 /**
  * This function generates PSKc.
  *
@@ -0,0 +1,330 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the asynchronous PSKc generator.
+ */
+
+#include "pskc_generator.hpp"
+
+#if OPENTHREAD_FTD
+
+#include <openthread/platform/pskc.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#include "common/logging.hpp"
+#include "common/string.hpp"
+#include "meshcop/meshcop.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+PskcGenerator::PskcGenerator(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mCallback(nullptr)
+    , mCallbackContext(nullptr)
+    , mResultError(kErrorNone)
+    , mResultPending(false)
+    , mTasklet(aInstance, PskcGenerator::HandleTasklet)
+    , mCacheNext(0)
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    , mPlatformBusy(false)
+#endif
+{
+    memset(mCache, 0, sizeof(mCache));
+}
+
+Error PskcGenerator::Generate(const char *              aPassPhrase,
+                              const Mac::NetworkName &  aNetworkName,
+                              const Mac::ExtendedPanId &aExtPanId,
+                              Callback                  aCallback,
+                              void *                    aContext)
+{
+    Error       error = kErrorNone;
+    const Pskc *pskc;
+
+    VerifyOrExit(mCallback == nullptr, error = kErrorBusy);
+    VerifyOrExit(aCallback != nullptr, error = kErrorInvalidArgs);
+    SuccessOrExit(error = ValidatePskcInputs(aPassPhrase, aNetworkName));
+
+    mCallback        = aCallback;
+    mCallbackContext = aContext;
+    ComputeKey(aPassPhrase, aNetworkName, aExtPanId, mRequestKey);
+
+    pskc = FindInCache(mRequestKey);
+
+    if (pskc != nullptr)
+    {
+        ReportLater(kErrorNone, pskc);
+        ExitNow();
+    }
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    {
+        uint16_t length = StringLength(aPassPhrase, OT_COMMISSIONING_PASSPHRASE_MAX_SIZE);
+
+        memcpy(mPassPhrase, aPassPhrase, length);
+        mPassPhrase[length] = '\0';
+    }
+
+    mNetworkName = aNetworkName;
+    mExtPanId    = aExtPanId;
+
+    StartPlatformGeneration();
+#else
+    GenerateLocally(aPassPhrase, aNetworkName, aExtPanId);
+#endif
+
+exit:
+    return error;
+}
+
+void PskcGenerator::Cancel(void)
+{
+    mCallback      = nullptr;
+    mResultPending = false;
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    ClearRequestInputs();
+#endif
+}
+
+void PskcGenerator::ComputeKey(const char *              aPassPhrase,
+                               const Mac::NetworkName &  aNetworkName,
+                               const Mac::ExtendedPanId &aExtPanId,
+                               Crypto::Sha256::Hash &    aKey)
+{
+    Crypto::Sha256 sha256;
+
+    // The strings are hashed with their null terminators, so that
+    // the tuple boundaries are unambiguous.
+
+    sha256.Start();
+    sha256.Update(aPassPhrase, StringLength(aPassPhrase, OT_COMMISSIONING_PASSPHRASE_MAX_SIZE) + 1);
+    sha256.Update(aNetworkName.GetAsCString(), StringLength(aNetworkName.GetAsCString(), OT_NETWORK_NAME_MAX_SIZE) + 1);
+    sha256.Update(aExtPanId);
+    sha256.Finish(aKey);
+}
+
+const Pskc *PskcGenerator::FindInCache(const Crypto::Sha256::Hash &aKey) const
+{
+    const Pskc *pskc = nullptr;
+
+    for (const CacheEntry &entry : mCache)
+    {
+        if (entry.mValid && (entry.mKey == aKey))
+        {
+            pskc = &entry.mPskc;
+            break;
+        }
+    }
+
+    return pskc;
+}
+
+void PskcGenerator::AddToCache(const Crypto::Sha256::Hash &aKey, const Pskc &aPskc)
+{
+    CacheEntry &entry = mCache[mCacheNext];
+
+    VerifyOrExit(FindInCache(aKey) == nullptr);
+
+    entry.mKey   = aKey;
+    entry.mPskc  = aPskc;
+    entry.mValid = true;
+
+    mCacheNext = (mCacheNext + 1) % OT_ARRAY_LENGTH(mCache);
+
+exit:
+    return;
+}
+
+void PskcGenerator::GenerateLocally(const char *              aPassPhrase,
+                                    const Mac::NetworkName &  aNetworkName,
+                                    const Mac::ExtendedPanId &aExtPanId)
+{
+    Error error;
+    Pskc  pskc;
+
+    error = GeneratePskc(aPassPhrase, aNetworkName, aExtPanId, pskc);
+
+    if (error == kErrorNone)
+    {
+        AddToCache(mRequestKey, pskc);
+    }
+
+    ReportLater(error, (error == kErrorNone) ? &pskc : nullptr);
+}
+
+void PskcGenerator::ReportLater(Error aError, const Pskc *aPskc)
+{
+    // The callback is invoked from a tasklet, so that it is never
+    // called from within `Generate()`.
+
+    mResultError   = aError;
+    mResultPending = true;
+
+    if (aPskc != nullptr)
+    {
+        mResultPskc = *aPskc;
+    }
+
+    mTasklet.Post();
+}
+
+void PskcGenerator::HandleTasklet(Tasklet &aTasklet)
+{
+    aTasklet.Get<PskcGenerator>().HandleTasklet();
+}
+
+void PskcGenerator::HandleTasklet(void)
+{
+    VerifyOrExit(mResultPending);
+
+    Report(mResultError, (mResultError == kErrorNone) ? &mResultPskc : nullptr);
+
+exit:
+    return;
+}
+
+void PskcGenerator::Report(Error aError, const Pskc *aPskc)
+{
+    Callback callback = mCallback;
+
+    VerifyOrExit(callback != nullptr);
+
+    otLogInfoMeshCoP("PSKc generation done: %s", ErrorToString(aError));
+
+    // The request is cleared before invoking the callback, so that a
+    // new request can be started from the callback.
+
+    mCallback      = nullptr;
+    mResultPending = false;
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    ClearRequestInputs();
+#endif
+
+    callback(aError, aPskc, mCallbackContext);
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+
+void PskcGenerator::StartPlatformGeneration(void)
+{
+    // A single generation runs on the platform at a time. If one is
+    // still running (for a canceled request), the new request is
+    // started once it completes.
+
+    VerifyOrExit(!mPlatformBusy);
+
+    if (otPlatPskcGenerate(&GetInstance(), mPassPhrase, &mNetworkName, &mExtPanId) == kErrorNone)
+    {
+        mPlatformBusy = true;
+        mPlatformKey  = mRequestKey;
+    }
+    else
+    {
+        GenerateLocally(mPassPhrase, mNetworkName, mExtPanId);
+    }
+
+exit:
+    return;
+}
+
+void PskcGenerator::HandlePlatformDone(Error aError, const Pskc *aPskc)
+{
+    const Pskc *pskc;
+
+    VerifyOrExit(mPlatformBusy);
+    mPlatformBusy = false;
+
+    if (aError == kErrorNone)
+    {
+        AddToCache(mPlatformKey, *aPskc);
+    }
+
+    VerifyOrExit(mCallback != nullptr);
+
+    if (mPlatformKey == mRequestKey)
+    {
+        Report(aError, aPskc);
+        ExitNow();
+    }
+
+    // The completed generation was for a canceled request.
+
+    pskc = FindInCache(mRequestKey);
+
+    if (pskc != nullptr)
+    {
+        Report(kErrorNone, pskc);
+    }
+    else if (!mResultPending)
+    {
+        StartPlatformGeneration();
+    }
+
+exit:
+    return;
+}
+
+void PskcGenerator::ClearRequestInputs(void)
+{
+    // The passphrase is not kept longer than needed.
+
+    memset(mPassPhrase, 0, sizeof(mPassPhrase));
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+
+} // namespace MeshCoP
+} // namespace ot
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+
+extern "C" void otPlatPskcGenerateDone(otInstance *aInstance, otError aError, const otPskc *aPskc)
+{
+    ot::Instance &instance = *static_cast<ot::Instance *>(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+
+    instance.Get<ot::MeshCoP::PskcGenerator>().HandlePlatformDone(aError, static_cast<const ot::Pskc *>(aPskc));
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+
+#endif // OPENTHREAD_FTD
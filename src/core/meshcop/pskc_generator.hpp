@@ -0,0 +1,170 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the asynchronous PSKc generator.
+ */
+
+#ifndef PSKC_GENERATOR_HPP_
+#define PSKC_GENERATOR_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_FTD
+
+#include <openthread/commissioner.h>
+#include <openthread/dataset.h>
+
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
+#include "crypto/sha256.hpp"
+#include "mac/mac_types.hpp"
+#include "thread/key_manager.hpp"
+
+namespace ot {
+namespace MeshCoP {
+
+/**
+ * This class implements the asynchronous PSKc generator.
+ *
+ * The PSKc derivation is delegated to the platform (`otPlatPskcGenerate()`) when
+ * `OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE` is enabled, otherwise it is computed within the OpenThread
+ * processing. The most recently generated PSKc values are cached.
+ *
+ */
+class PskcGenerator : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * This type represents the callback function pointer which is called when a PSKc generation completes.
+     *
+     */
+    typedef otDatasetGeneratePskcCallback Callback;
+
+    /**
+     * This constructor initializes the PSKc generator.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit PskcGenerator(Instance &aInstance);
+
+    /**
+     * This method starts generating a PSKc.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended PAN ID for PSKc computation.
+     * @param[in]  aCallback     A pointer to the function called when the generation completes.
+     * @param[in]  aContext      A pointer to application-specific context.
+     *
+     * @retval kErrorNone         Successfully started the PSKc generation, @p aCallback will be called.
+     * @retval kErrorInvalidArgs  If any of the input arguments is invalid.
+     * @retval kErrorBusy         A previous request is still outstanding.
+     *
+     */
+    Error Generate(const char *              aPassPhrase,
+                   const Mac::NetworkName &  aNetworkName,
+                   const Mac::ExtendedPanId &aExtPanId,
+                   Callback                  aCallback,
+                   void *                    aContext);
+
+    /**
+     * This method cancels the outstanding PSKc generation request (if any).
+     *
+     */
+    void Cancel(void);
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    /**
+     * This method handles the completion of a PSKc generation by the platform.
+     *
+     * @param[in]  aError  The error status of the generation.
+     * @param[in]  aPskc   A pointer to the generated PSKc, or `nullptr` if @p aError is not `kErrorNone`.
+     *
+     */
+    void HandlePlatformDone(Error aError, const Pskc *aPskc);
+#endif
+
+private:
+    struct CacheEntry
+    {
+        Crypto::Sha256::Hash mKey;
+        Pskc                 mPskc;
+        bool                 mValid;
+    };
+
+    static void ComputeKey(const char *              aPassPhrase,
+                           const Mac::NetworkName &  aNetworkName,
+                           const Mac::ExtendedPanId &aExtPanId,
+                           Crypto::Sha256::Hash &    aKey);
+
+    const Pskc *FindInCache(const Crypto::Sha256::Hash &aKey) const;
+    void        AddToCache(const Crypto::Sha256::Hash &aKey, const Pskc &aPskc);
+    void        GenerateLocally(const char *              aPassPhrase,
+                                const Mac::NetworkName &  aNetworkName,
+                                const Mac::ExtendedPanId &aExtPanId);
+    void        ReportLater(Error aError, const Pskc *aPskc);
+    void        Report(Error aError, const Pskc *aPskc);
+    static void HandleTasklet(Tasklet &aTasklet);
+    void        HandleTasklet(void);
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    void StartPlatformGeneration(void);
+    void ClearRequestInputs(void);
+#endif
+
+    Callback             mCallback;
+    void *               mCallbackContext;
+    Crypto::Sha256::Hash mRequestKey;
+    Error                mResultError;
+    Pskc                 mResultPskc;
+    bool                 mResultPending;
+    Tasklet              mTasklet;
+    CacheEntry           mCache[OPENTHREAD_CONFIG_PSKC_CACHE_SIZE];
+    uint8_t              mCacheNext;
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+    // The inputs of the outstanding request are kept until the
+    // platform is ready to start generating its PSKc.
+    char                 mPassPhrase[OT_COMMISSIONING_PASSPHRASE_MAX_SIZE + 1];
+    Mac::NetworkName     mNetworkName;
+    Mac::ExtendedPanId   mExtPanId;
+    bool                 mPlatformBusy;
+    Crypto::Sha256::Hash mPlatformKey;
+#endif
+};
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_FTD
+
+#endif // PSKC_GENERATOR_HPP_
@@ -491,7 +491,7 @@ Error Name::LabelIterator::GetNextLabel(void)
         uint8_t labelLength;
         uint8_t labelType;
 
-        SuccessOrExit(error = mMessage.Read(mNextLabelOffset, labelLength));
+        SuccessOrExit(error = Read(mNextLabelOffset, &labelLength, sizeof(labelLength)));
 
         labelType = labelLength & kLabelTypeMask;
 
@@ -509,9 +509,14 @@ Error Name::LabelIterator::GetNextLabel(void)
                 ExitNow(error = kErrorNotFound);
             }
 
+            // The label text is read once here while the cursor is on
+            // it, so that reading, comparing or appending the label
+            // later does not need to access the message again.
+
             mLabelStartOffset = mNextLabelOffset + sizeof(uint8_t);
             mLabelLength      = labelLength;
-            mNextLabelOffset  = mLabelStartOffset + labelLength;
+            SuccessOrExit(error = Read(mLabelStartOffset, mLabel, mLabelLength));
+            mNextLabelOffset = mLabelStartOffset + labelLength;
             ExitNow();
         }
         else if (labelType == kPointerLabelType)
@@ -521,8 +526,9 @@ Error Name::LabelIterator::GetNextLabel(void)
             // specify an offset value from the start of the DNS header.
 
             uint16_t pointerValue;
+            uint16_t nextLabelOffset;
 
-            SuccessOrExit(error = mMessage.Read(mNextLabelOffset, pointerValue));
+            SuccessOrExit(error = Read(mNextLabelOffset, &pointerValue, sizeof(pointerValue)));
 
             if (!IsEndOffsetSet())
             {
@@ -530,8 +536,13 @@ Error Name::LabelIterator::GetNextLabel(void)
             }
 
             // `mMessage.GetOffset()` must point to the start of the
-            // DNS header.
-            mNextLabelOffset = mMessage.GetOffset() + (HostSwap16(pointerValue) & kPointerLabelOffsetMask);
+            // DNS header. A pointer must refer to a prior occurrence
+            // of a name, which also guarantees that following the
+            // pointers terminates.
+
+            nextLabelOffset = mMessage.GetOffset() + (HostSwap16(pointerValue) & kPointerLabelOffsetMask);
+            VerifyOrExit(nextLabelOffset < mNextLabelOffset, error = kErrorParse);
+            mNextLabelOffset = nextLabelOffset;
 
             // Go back through the `while(true)` loop to get the next label.
         }
@@ -545,13 +556,66 @@ exit:
     return error;
 }
 
+Error Name::LabelIterator::Read(uint16_t aOffset, void *aBuffer, uint8_t aLength)
+{
+    // This method reads bytes from `mMessage` through a cursor which
+    // tracks the current message chunk. Labels of a name are mostly
+    // read in increasing offset order, so the buffer chain is walked
+    // once per name instead of once per read. Moving backward (when
+    // following a pointer label) seeks the cursor to the new offset.
+
+    Error    error  = kErrorNone;
+    uint8_t *buffer = static_cast<uint8_t *>(aBuffer);
+
+    while (aLength > 0)
+    {
+        uint16_t chunkIndex;
+        uint8_t  length;
+
+        if (aOffset < mChunkOffset)
+        {
+            Seek(aOffset);
+        }
+
+        while ((mChunk.GetLength() > 0) && (aOffset >= mChunkOffset + mChunk.GetLength()))
+        {
+            mChunkOffset += mChunk.GetLength();
+            mMessage.GetNextChunk(mRemainingLength, mChunk);
+        }
+
+        if (mChunk.GetLength() == 0)
+        {
+            Seek(aOffset);
+            VerifyOrExit(mChunk.GetLength() > 0, error = kErrorParse);
+        }
+
+        chunkIndex = aOffset - mChunkOffset;
+        length     = static_cast<uint8_t>(OT_MIN(static_cast<uint16_t>(aLength), mChunk.GetLength() - chunkIndex));
+
+        memcpy(buffer, mChunk.GetData() + chunkIndex, length);
+        buffer += length;
+        aOffset += length;
+        aLength -= length;
+    }
+
+exit:
+    return error;
+}
+
+void Name::LabelIterator::Seek(uint16_t aOffset)
+{
+    mChunkOffset     = aOffset;
+    mRemainingLength = mMessage.GetLength();
+    mMessage.GetFirstChunk(aOffset, mRemainingLength, mChunk);
+}
+
 Error Name::LabelIterator::ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const
 {
-    Error error;
+    Error error = kErrorNone;
 
     VerifyOrExit(mLabelLength < aLabelLength, error = kErrorNoBufs);
 
-    SuccessOrExit(error = mMessage.Read(mLabelStartOffset, aLabelBuffer, mLabelLength));
+    memcpy(aLabelBuffer, mLabel, mLabelLength);
     aLabelBuffer[mLabelLength] = kNullChar;
     aLabelLength               = mLabelLength;
 
@@ -577,7 +641,7 @@ bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel)
     bool matches = false;
 
     VerifyOrExit(StringLength(aName, mLabelLength) == mLabelLength);
-    matches = mMessage.CompareBytes(mLabelStartOffset, aName, mLabelLength);
+    matches = (memcmp(mLabel, aName, mLabelLength) == 0);
 
     VerifyOrExit(matches);
 
@@ -605,20 +669,19 @@ bool Name::LabelIterator::CompareLabel(const LabelIterator &aOtherIterator) cons
     // label from another iterator.
 
     return (mLabelLength == aOtherIterator.mLabelLength) &&
-           mMessage.CompareBytes(mLabelStartOffset, aOtherIterator.mMessage, aOtherIterator.mLabelStartOffset,
-                                 mLabelLength);
+           (memcmp(mLabel, aOtherIterator.mLabel, mLabelLength) == 0);
 }
 
 Error Name::LabelIterator::AppendLabel(Message &aMessage) const
 {
-    // This method reads and appends the current label in the iterator
-    // to `aMessage`.
+    // This method appends the current label in the iterator to
+    // `aMessage`.
 
     Error error;
 
     VerifyOrExit((0 < mLabelLength) && (mLabelLength <= kMaxLabelLength), error = kErrorInvalidArgs);
     SuccessOrExit(error = aMessage.Append(mLabelLength));
-    error = aMessage.AppendBytesFromMessage(mMessage, mLabelStartOffset, mLabelLength);
+    error = aMessage.AppendBytes(mLabel, mLabelLength);
 
 exit:
     return error;
@@ -655,6 +718,231 @@ exit:
     return match;
 }
 
+Error Name::CompressionDictionary::AppendName(const char *aName, uint8_t aFirstLabelLength, Message &aMessage)
+{
+    Error    error       = kErrorNone;
+    uint16_t length      = 0;
+    uint16_t prefixEnd   = 0;
+    uint16_t baseOffset  = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t matchOffset = 0;
+    bool     matched     = false;
+    bool     searching   = true;
+    uint16_t labelEnd;
+
+    if (aName != nullptr)
+    {
+        length = StringLength(aName, kMaxNameSize);
+
+        if ((length > 0) && (aName[length - 1] == kLabelSeperatorChar))
+        {
+            length--;
+        }
+    }
+
+    VerifyOrExit(length < kMaxEncodedLength, error = kErrorInvalidArgs);
+    VerifyOrExit((aFirstLabelLength == 0) || (aFirstLabelLength == length) ||
+                     ((aFirstLabelLength < length) && (aName[aFirstLabelLength] == kLabelSeperatorChar)),
+                 error = kErrorInvalidArgs);
+
+    // Walk over the suffixes of the name from the shortest to the
+    // longest. While suffixes are found in the dictionary, the
+    // longest match so far is remembered. The suffixes after that
+    // will be written as text labels, so they are added to the
+    // dictionary with their future offsets in the message.
+
+    prefixEnd = length;
+    labelEnd  = length;
+
+    while (labelEnd > 0)
+    {
+        uint16_t labelStart = labelEnd;
+        uint16_t hash;
+
+        if (labelEnd <= aFirstLabelLength)
+        {
+            labelStart = 0;
+        }
+        else
+        {
+            while ((labelStart > 0) && (aName[labelStart - 1] != kLabelSeperatorChar))
+            {
+                labelStart--;
+            }
+        }
+
+        VerifyOrExit(labelStart < labelEnd, error = kErrorInvalidArgs);
+
+        hash = HashName(&aName[labelStart], length - labelStart, (labelStart == 0) ? aFirstLabelLength : 0);
+
+        if (searching)
+        {
+            searching = false;
+
+            for (uint8_t i = 0; i < mNumEntries; i++)
+            {
+                const Entry &entry = mEntries[i];
+
+                if ((entry.mHash == hash) && Matches(aMessage, entry.mOffset, &aName[labelStart], length - labelStart,
+                                                     (labelStart == 0) ? aFirstLabelLength : 0))
+                {
+                    matchOffset = entry.mOffset;
+                    matched     = true;
+                    searching   = true;
+                    prefixEnd   = (labelStart == 0) ? 0 : labelStart - 1;
+                    break;
+                }
+            }
+        }
+
+        if (!searching)
+        {
+            Add(hash, baseOffset + labelStart);
+        }
+
+        labelEnd = (labelStart == 0) ? 0 : labelStart - 1;
+    }
+
+    if (prefixEnd > 0)
+    {
+        if (aFirstLabelLength > 0)
+        {
+            SuccessOrExit(error = Name::AppendLabel(aName, aFirstLabelLength, aMessage));
+
+            if (prefixEnd > aFirstLabelLength)
+            {
+                SuccessOrExit(error = AppendMultipleLabels(&aName[aFirstLabelLength + 1],
+                                                           static_cast<uint8_t>(prefixEnd - aFirstLabelLength - 1),
+                                                           aMessage));
+            }
+        }
+        else
+        {
+            SuccessOrExit(error = AppendMultipleLabels(aName, static_cast<uint8_t>(prefixEnd), aMessage));
+        }
+    }
+
+    error = matched ? AppendPointerLabel(matchOffset, aMessage) : AppendTerminator(aMessage);
+
+exit:
+    return error;
+}
+
+void Name::CompressionDictionary::AddName(const Message &aMessage, uint16_t aOffset)
+{
+    LabelIterator iterator(aMessage, aOffset);
+
+    // Once a pointer label is followed the end offset is set, and
+    // the remaining suffixes are stored elsewhere in the message.
+
+    while ((iterator.GetNextLabel() == kErrorNone) && !iterator.IsEndOffsetSet())
+    {
+        uint16_t      labelOffset = iterator.mLabelStartOffset - sizeof(uint8_t);
+        LabelIterator suffixIterator(aMessage, labelOffset);
+        uint16_t      hash = kHashSeed;
+
+        while (suffixIterator.GetNextLabel() == kErrorNone)
+        {
+            hash = HashLabel(hash, suffixIterator.mLabel, suffixIterator.mLabelLength);
+        }
+
+        Add(hash, labelOffset - aMessage.GetOffset());
+    }
+}
+
+void Name::CompressionDictionary::Add(uint16_t aHash, uint16_t aOffset)
+{
+    // A pointer label can only refer to the first 16K of a message.
+    // When the dictionary is full, new suffixes are not recorded and
+    // names using them are appended without compression.
+
+    VerifyOrExit((aOffset <= kPointerLabelOffsetMask) && (mNumEntries < kMaxEntries));
+
+    mEntries[mNumEntries].mHash   = aHash;
+    mEntries[mNumEntries].mOffset = aOffset;
+    mNumEntries++;
+
+exit:
+    return;
+}
+
+uint16_t Name::CompressionDictionary::FindLabelEnd(const char *aName,
+                                                   uint16_t    aIndex,
+                                                   uint16_t    aLength,
+                                                   uint8_t     aFirstLabelLength)
+{
+    uint16_t end = aIndex;
+
+    if ((aIndex == 0) && (aFirstLabelLength > 0))
+    {
+        ExitNow(end = aFirstLabelLength);
+    }
+
+    while ((end < aLength) && (aName[end] != kLabelSeperatorChar))
+    {
+        end++;
+    }
+
+exit:
+    return end;
+}
+
+uint16_t Name::CompressionDictionary::HashLabel(uint16_t aHash, const uint8_t *aLabel, uint8_t aLength)
+{
+    // The hash covers the encoded form of the label (length followed
+    // by label characters) so that it can be calculated the same way
+    // from a name string and from a name encoded in a message.
+
+    aHash = static_cast<uint16_t>(aHash * 33 + aLength);
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        aHash = static_cast<uint16_t>(aHash * 33 + aLabel[i]);
+    }
+
+    return aHash;
+}
+
+uint16_t Name::CompressionDictionary::HashName(const char *aName, uint16_t aLength, uint8_t aFirstLabelLength)
+{
+    uint16_t hash = kHashSeed;
+
+    for (uint16_t index = 0; index < aLength;)
+    {
+        uint16_t end = FindLabelEnd(aName, index, aLength, aFirstLabelLength);
+
+        hash  = HashLabel(hash, reinterpret_cast<const uint8_t *>(&aName[index]), static_cast<uint8_t>(end - index));
+        index = end + sizeof(char);
+    }
+
+    return hash;
+}
+
+bool Name::CompressionDictionary::Matches(const Message &aMessage,
+                                          uint16_t       aOffset,
+                                          const char *   aName,
+                                          uint16_t       aLength,
+                                          uint8_t        aFirstLabelLength)
+{
+    LabelIterator iterator(aMessage, aMessage.GetOffset() + aOffset);
+    bool          matches = false;
+
+    for (uint16_t index = 0; index < aLength;)
+    {
+        uint16_t end = FindLabelEnd(aName, index, aLength, aFirstLabelLength);
+
+        VerifyOrExit(iterator.GetNextLabel() == kErrorNone);
+        VerifyOrExit((iterator.mLabelLength == end - index) &&
+                     (memcmp(iterator.mLabel, &aName[index], iterator.mLabelLength) == 0));
+
+        index = end + sizeof(char);
+    }
+
+    matches = (iterator.GetNextLabel() == kErrorNotFound);
+
+exit:
+    return matches;
+}
+
 Error ResourceRecord::ParseRecords(const Message &aMessage, uint16_t &aOffset, uint16_t aNumRecords)
 {
     Error error = kErrorNone;
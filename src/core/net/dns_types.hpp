@@ -994,6 +994,101 @@ public:
      */
     static bool IsSubDomainOf(const char *aName, const char *aDomain);
 
+    /**
+     * This class implements a name compression dictionary for a DNS message.
+     *
+     * The dictionary records the offset of every name suffix written in the message through it. When a new name is
+     * appended, its longest suffix already present in the message is replaced by a pointer label, so any previously
+     * written suffix (not just a fixed set of well-known names) is used for compression.
+     *
+     */
+    class CompressionDictionary : public Clearable<CompressionDictionary>
+    {
+    public:
+        /**
+         * This constructor initializes the dictionary as empty.
+         *
+         */
+        CompressionDictionary(void) { Clear(); }
+
+        /**
+         * This method encodes and appends a full name to a message, compressing it against the suffixes recorded in
+         * the dictionary.
+         *
+         * The @p aName must follow "<label1>.<label2>.<label3>", i.e., a sequence of labels separated by dot '.' char.
+         * All suffixes of @p aName which are written in @p aMessage as text labels are added to the dictionary.
+         *
+         * @param[in] aName      A name string. Can be nullptr (then treated as "." or root).
+         * @param[in] aMessage   The message to append to.
+         *
+         * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+         * @retval kErrorInvalidArgs  Name @p aName is not valid.
+         * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+         *
+         */
+        Error AppendName(const char *aName, Message &aMessage) { return AppendName(aName, 0, aMessage); }
+
+        /**
+         * This method encodes and appends a full name whose first label can contain dot '.' characters to a message,
+         * compressing it against the suffixes recorded in the dictionary.
+         *
+         * This is intended for "Service Instance Name" where first label (`<Instance>` portion) can be a user-friendly
+         * string and contain dot characters.
+         *
+         * @param[in] aName              A name string. MUST NOT be nullptr.
+         * @param[in] aFirstLabelLength  The length of the first label of @p aName, or zero to parse @p aName as a
+         *                               sequence of dot-separated labels.
+         * @param[in] aMessage           The message to append to.
+         *
+         * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+         * @retval kErrorInvalidArgs  Name @p aName is not valid.
+         * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+         *
+         */
+        Error AppendName(const char *aName, uint8_t aFirstLabelLength, Message &aMessage);
+
+        /**
+         * This method adds the suffixes of a name already encoded in a message to the dictionary.
+         *
+         * Only the labels which are present in @p aMessage as text labels (i.e., before any pointer label) are added.
+         *
+         * @param[in] aMessage   The message containing the encoded name.
+         * @param[in] aOffset    The offset in @p aMessage to the start of the name.
+         *
+         */
+        void AddName(const Message &aMessage, uint16_t aOffset);
+
+    private:
+        enum : uint8_t
+        {
+            kMaxEntries = 32,
+        };
+
+        enum : uint16_t
+        {
+            kHashSeed = 5381,
+        };
+
+        struct Entry
+        {
+            uint16_t mHash;   // Hash of the encoded suffix labels.
+            uint16_t mOffset; // Offset of the suffix relative to the start of DNS header.
+        };
+
+        void            Add(uint16_t aHash, uint16_t aOffset);
+        static uint16_t FindLabelEnd(const char *aName, uint16_t aIndex, uint16_t aLength, uint8_t aFirstLabelLength);
+        static uint16_t HashLabel(uint16_t aHash, const uint8_t *aLabel, uint8_t aLength);
+        static uint16_t HashName(const char *aName, uint16_t aLength, uint8_t aFirstLabelLength);
+        static bool     Matches(const Message &aMessage,
+                                uint16_t       aOffset,
+                                const char *   aName,
+                                uint16_t       aLength,
+                                uint8_t        aFirstLabelLength);
+
+        Entry   mEntries[kMaxEntries];
+        uint8_t mNumEntries;
+    };
+
 private:
     enum : char
     {
@@ -1032,7 +1127,10 @@ private:
             : mMessage(aMessage)
             , mNextLabelOffset(aLabelOffset)
             , mNameEndOffset(kUnsetNameEndOffset)
+            , mChunkOffset(0)
+            , mRemainingLength(0)
         {
+            mChunk.mLength = 0;
         }
 
         bool  IsEndOffsetSet(void) const { return (mNameEndOffset != kUnsetNameEndOffset); }
@@ -1041,12 +1139,18 @@ private:
         bool  CompareLabel(const char *&aName, bool aIsSingleLabel) const;
         bool  CompareLabel(const LabelIterator &aOtherIterator) const;
         Error AppendLabel(Message &aMessage) const;
-
-        const Message &mMessage;          // Message to read labels from.
-        uint16_t       mLabelStartOffset; // Offset in `mMessage` to the first char of current label text.
-        uint8_t        mLabelLength;      // Length of current label (number of chars).
-        uint16_t       mNextLabelOffset;  // Offset in `mMessage` to the start of the next label.
-        uint16_t       mNameEndOffset;    // Offset in `mMessage` to the byte after the end of domain name field.
+        Error Read(uint16_t aOffset, void *aBuffer, uint8_t aLength);
+        void  Seek(uint16_t aOffset);
+
+        const Message &mMessage;                // Message to read labels from.
+        uint16_t       mLabelStartOffset;       // Offset in `mMessage` to the first char of current label text.
+        uint8_t        mLabelLength;            // Length of current label (number of chars).
+        uint8_t        mLabel[kMaxLabelLength]; // The current label text (read once from `mMessage`).
+        uint16_t       mNextLabelOffset;        // Offset in `mMessage` to the start of the next label.
+        uint16_t       mNameEndOffset;          // Offset in `mMessage` to the byte after the end of domain name field.
+        Message::Chunk mChunk;                  // The message chunk the read cursor is on.
+        uint16_t       mChunkOffset;            // Offset in `mMessage` to the start of `mChunk`.
+        uint16_t       mRemainingLength;        // Remaining message length after `mChunk`.
     };
 
     Name(const char *aString, const Message *aMessage, uint16_t aOffset)
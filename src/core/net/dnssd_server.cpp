@@ -117,12 +117,12 @@ exit:
 
 void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    Error            error           = kErrorNone;
-    Message *        responseMessage = nullptr;
-    Header           responseHeader;
-    NameCompressInfo compressInfo(kDefaultDomainName);
-    Header::Response response                = Header::kResponseSuccess;
-    bool             resolveByQueryCallbacks = false;
+    Error                       error           = kErrorNone;
+    Message *                   responseMessage = nullptr;
+    Header                      responseHeader;
+    Name::CompressionDictionary dictionary;
+    Header::Response            response                = Header::kResponseSuccess;
+    bool                        resolveByQueryCallbacks = false;
 
     responseMessage = mSocket.NewMessage(0);
     VerifyOrExit(responseMessage != nullptr, error = kErrorNoBufs);
@@ -141,17 +141,17 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     VerifyOrExit(!aRequestHeader.IsTruncationFlagSet(), response = Header::kResponseFormatError);
     VerifyOrExit(aRequestHeader.GetQuestionCount() > 0, response = Header::kResponseFormatError);
 
-    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, compressInfo);
+    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, dictionary);
     VerifyOrExit(response == Header::kResponseSuccess);
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
     // Answer the questions
-    response = ResolveBySrp(responseHeader, *responseMessage, compressInfo);
+    response = ResolveBySrp(responseHeader, *responseMessage, dictionary);
 #endif
 
     // Resolve the question using query callbacks if SRP server failed to resolve the questions.
     if (responseHeader.GetAnswerCount() == 0 &&
-        kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, compressInfo, aMessageInfo))
+        kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, aMessageInfo))
     {
         resolveByQueryCallbacks = true;
     }
@@ -199,11 +199,11 @@ void Server::SendResponse(Header                  aHeader,
     }
 }
 
-Header::Response Server::AddQuestions(const Header &    aRequestHeader,
-                                      const Message &   aRequestMessage,
-                                      Header &          aResponseHeader,
-                                      Message &         aResponseMessage,
-                                      NameCompressInfo &aCompressInfo)
+Header::Response Server::AddQuestions(const Header &               aRequestHeader,
+                                      const Message &              aRequestMessage,
+                                      Header &                     aResponseHeader,
+                                      Message &                    aResponseMessage,
+                                      Name::CompressionDictionary &aDictionary)
 {
     Question         question;
     uint16_t         readOffset;
@@ -228,7 +228,7 @@ Header::Response Server::AddQuestions(const Header &    aRequestHeader,
                          qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAaaa,
                      response = Header::kResponseNotImplemented);
 
-        VerifyOrExit(kErrorNone == FindNameComponents(name, aCompressInfo.GetDomainName(), nameComponentsOffsetInfo),
+        VerifyOrExit(kErrorNone == FindNameComponents(name, kDefaultDomainName, nameComponentsOffsetInfo),
                      response = Header::kResponseNameError);
 
         switch (question.GetType())
@@ -249,7 +249,7 @@ Header::Response Server::AddQuestions(const Header &    aRequestHeader,
             ExitNow(response = Header::kResponseNotImplemented);
         }
 
-        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aCompressInfo) == kErrorNone,
+        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aDictionary) == kErrorNone,
                      response = Header::kResponseServerFailure);
     }
 
@@ -259,24 +259,22 @@ exit:
     return response;
 }
 
-Error Server::AppendQuestion(const char *      aName,
-                             const Question &  aQuestion,
-                             Message &         aMessage,
-                             NameCompressInfo &aCompressInfo)
+Error Server::AppendQuestion(const char *                 aName,
+                             const Question &             aQuestion,
+                             Message &                    aMessage,
+                             Name::CompressionDictionary &aDictionary)
 {
     Error error = kErrorNone;
 
     switch (aQuestion.GetType())
     {
     case ResourceRecord::kTypePtr:
-        SuccessOrExit(error = AppendServiceName(aMessage, aName, aCompressInfo));
+    case ResourceRecord::kTypeAaaa:
+        SuccessOrExit(error = aDictionary.AppendName(aName, aMessage));
         break;
     case ResourceRecord::kTypeSrv:
     case ResourceRecord::kTypeTxt:
-        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aCompressInfo));
-        break;
-    case ResourceRecord::kTypeAaaa:
-        SuccessOrExit(error = AppendHostName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aDictionary));
         break;
     default:
         OT_ASSERT(false);
@@ -288,11 +286,11 @@ exit:
     return error;
 }
 
-Error Server::AppendPtrRecord(Message &         aMessage,
-                              const char *      aServiceName,
-                              const char *      aInstanceName,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendPtrRecord(Message &                    aMessage,
+                              const char *                 aServiceName,
+                              const char *                 aInstanceName,
+                              uint32_t                     aTtl,
+                              Name::CompressionDictionary &aDictionary)
 {
     Error     error;
     PtrRecord ptrRecord;
@@ -301,12 +299,12 @@ Error Server::AppendPtrRecord(Message &         aMessage,
     ptrRecord.Init();
     ptrRecord.SetTtl(aTtl);
 
-    SuccessOrExit(error = AppendServiceName(aMessage, aServiceName, aCompressInfo));
+    SuccessOrExit(error = aDictionary.AppendName(aServiceName, aMessage));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(ptrRecord)));
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aDictionary));
 
     ptrRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, ptrRecord);
@@ -315,14 +313,14 @@ exit:
     return error;
 }
 
-Error Server::AppendSrvRecord(Message &         aMessage,
-                              const char *      aInstanceName,
-                              const char *      aHostName,
-                              uint32_t          aTtl,
-                              uint16_t          aPriority,
-                              uint16_t          aWeight,
-                              uint16_t          aPort,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendSrvRecord(Message &                    aMessage,
+                              const char *                 aInstanceName,
+                              const char *                 aHostName,
+                              uint32_t                     aTtl,
+                              uint16_t                     aPriority,
+                              uint16_t                     aWeight,
+                              uint16_t                     aPort,
+                              Name::CompressionDictionary &aDictionary)
 {
     SrvRecord srvRecord;
     Error     error = kErrorNone;
@@ -334,12 +332,12 @@ Error Server::AppendSrvRecord(Message &         aMessage,
     srvRecord.SetWeight(aWeight);
     srvRecord.SetPort(aPort);
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aDictionary));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(srvRecord)));
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = aDictionary.AppendName(aHostName, aMessage));
 
     srvRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, srvRecord);
@@ -348,11 +346,11 @@ exit:
     return error;
 }
 
-Error Server::AppendAaaaRecord(Message &           aMessage,
-                               const char *        aHostName,
-                               const Ip6::Address &aAddress,
-                               uint32_t            aTtl,
-                               NameCompressInfo &  aCompressInfo)
+Error Server::AppendAaaaRecord(Message &                    aMessage,
+                               const char *                 aHostName,
+                               const Ip6::Address &         aAddress,
+                               uint32_t                     aTtl,
+                               Name::CompressionDictionary &aDictionary)
 {
     AaaaRecord aaaaRecord;
     Error      error;
@@ -361,100 +359,37 @@ Error Server::AppendAaaaRecord(Message &           aMessage,
     aaaaRecord.SetTtl(aTtl);
     aaaaRecord.SetAddress(aAddress);
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = aDictionary.AppendName(aHostName, aMessage));
     error = aMessage.Append(aaaaRecord);
 
 exit:
     return error;
 }
 
-Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendInstanceName(Message &aMessage, const char *aName, Name::CompressionDictionary &aDictionary)
 {
-    Error    error;
-    uint16_t serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, aName);
-
-    if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
-}
-
-Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
-{
-    Error error;
-
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aMessage, aName);
-
-    if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(instanceCompressOffset, aMessage);
-    }
-    else
-    {
-        NameComponentsOffsetInfo nameComponentsInfo;
-
-        IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
-        OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
+    NameComponentsOffsetInfo nameComponentsInfo;
 
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength());
+    IgnoreError(FindNameComponents(aName, kDefaultDomainName, nameComponentsInfo));
+    OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
 
-        // Append the instance name as one label
-        SuccessOrExit(error = Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
-
-        {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, serviceName);
-
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
-            {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength());
-                error = Name::AppendName(serviceName, aMessage);
-            }
-        }
-    }
+    // The instance portion is appended as one label since it can
+    // contain dot characters.
 
-exit:
-    return error;
+    return aDictionary.AppendName(aName, nameComponentsInfo.mServiceOffset - 1, aMessage);
 }
 
-Error Server::AppendTxtRecord(Message &         aMessage,
-                              const char *      aInstanceName,
-                              const void *      aTxtData,
-                              uint16_t          aTxtLength,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendTxtRecord(Message &                    aMessage,
+                              const char *                 aInstanceName,
+                              const void *                 aTxtData,
+                              uint16_t                     aTxtLength,
+                              uint32_t                     aTtl,
+                              Name::CompressionDictionary &aDictionary)
 {
     Error     error = kErrorNone;
     TxtRecord txtRecord;
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aDictionary));
 
     txtRecord.Init();
     txtRecord.SetTtl(aTtl);
@@ -467,38 +402,22 @@ exit:
     return error;
 }
 
-Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+void Server::AddQuestionNames(const Header &aHeader, const Message &aMessage, Name::CompressionDictionary &aDictionary)
 {
-    Error    error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aMessage, aName);
+    // This method rebuilds the compression dictionary of a response
+    // message from its question section.
 
-    if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(hostCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset);
+    uint16_t readOffset = sizeof(Header);
 
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
+    for (uint16_t i = 0; i < aHeader.GetQuestionCount(); i++)
+    {
+        aDictionary.AddName(aMessage, readOffset);
+        SuccessOrExit(Name::ParseName(aMessage, readOffset));
+        readOffset += sizeof(Question);
     }
 
 exit:
-    return error;
+    return;
 }
 
 void Server::IncResourceRecordCount(Header &aHeader, bool aAdditional)
@@ -586,9 +505,9 @@ exit:
 }
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
-                                      Message &                 aResponseMessage,
-                                      Server::NameCompressInfo &aCompressInfo)
+Header::Response Server::ResolveBySrp(Header &                     aResponseHeader,
+                                      Message &                    aResponseMessage,
+                                      Name::CompressionDictionary &aDictionary)
 {
     Question         question;
     uint16_t         readOffset = sizeof(Header);
@@ -601,7 +520,7 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
         IgnoreError(aResponseMessage.Read(readOffset, question));
         readOffset += sizeof(question);
 
-        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressInfo,
+        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aDictionary,
                                         /* aAdditional */ false);
 
         otLogInfoDns("[server] ANSWER: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d",
@@ -619,7 +538,7 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
             readOffset += sizeof(question);
 
             VerifyOrExit(Header::kResponseServerFailure != ResolveQuestionBySrp(name, question, aResponseHeader,
-                                                                                aResponseMessage, aCompressInfo,
+                                                                                aResponseMessage, aDictionary,
                                                                                 /* aAdditional */ true),
                          response = Header::kResponseServerFailure);
 
@@ -631,12 +550,12 @@ exit:
     return response;
 }
 
-Header::Response Server::ResolveQuestionBySrp(const char *      aName,
-                                              const Question &  aQuestion,
-                                              Header &          aResponseHeader,
-                                              Message &         aResponseMessage,
-                                              NameCompressInfo &aCompressInfo,
-                                              bool              aAdditional)
+Header::Response Server::ResolveQuestionBySrp(const char *                 aName,
+                                              const Question &             aQuestion,
+                                              Header &                     aResponseHeader,
+                                              Message &                    aResponseMessage,
+                                              Name::CompressionDictionary &aDictionary,
+                                              bool                         aAdditional)
 {
     Error                    error    = kErrorNone;
     const Srp::Server::Host *host     = nullptr;
@@ -672,7 +591,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                 if (!aAdditional && ptrQueryMatched)
                 {
                     SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aDictionary));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -683,7 +602,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                 {
                     SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
                                                           service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
+                                                          service->GetPort(), aDictionary));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -693,7 +612,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                      !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
                 {
                     SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+                                                          service->GetTxtDataLength(), instanceTtl, aDictionary));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -711,7 +630,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
 
             for (uint8_t i = 0; i < addrNum; i++)
             {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aDictionary));
                 IncResourceRecordCount(aResponseHeader, aAdditional);
             }
 
@@ -751,7 +670,6 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &
 
 Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
                                       Message &               aResponseMessage,
-                                      NameCompressInfo &      aCompressInfo,
                                       const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *query = nullptr;
@@ -765,7 +683,7 @@ Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
     queryType = GetQueryTypeAndName(aResponseHeader, aResponseMessage, name);
     VerifyOrExit(queryType != kDnsQueryNone, error = kErrorNotImplemented);
 
-    query = NewQuery(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo);
+    query = NewQuery(aResponseHeader, aResponseMessage, aMessageInfo);
     VerifyOrExit(query != nullptr, error = kErrorNoBufs);
 
     mQuerySubscribe(mQueryCallbackContext, name);
@@ -776,7 +694,6 @@ exit:
 
 Server::QueryTransaction *Server::NewQuery(const Header &          aResponseHeader,
                                            Message &               aResponseMessage,
-                                           const NameCompressInfo &aCompressInfo,
                                            const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *newQuery = nullptr;
@@ -788,7 +705,7 @@ Server::QueryTransaction *Server::NewQuery(const Header &          aResponseHead
             continue;
         }
 
-        query.Init(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo);
+        query.Init(aResponseHeader, aResponseMessage, aMessageInfo);
         ExitNow(newQuery = &query);
     }
 
@@ -839,16 +756,18 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                          const char *                      aServiceFullName,
                          const otDnssdServiceInstanceInfo &aInstanceInfo)
 {
-    Header &          responseHeader  = aQuery.GetResponseHeader();
-    Message &         responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header &                    responseHeader  = aQuery.GetResponseHeader();
+    Message &                   responseMessage = aQuery.GetResponseMessage();
+    Error                       error           = kErrorNone;
+    Name::CompressionDictionary dictionary;
+
+    AddQuestionNames(responseHeader, responseMessage, dictionary);
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aServiceFullName,
                     ResourceRecord::kTypePtr))
     {
         SuccessOrExit(error = AppendPtrRecord(responseMessage, aServiceFullName, aInstanceInfo.mFullName,
-                                              aInstanceInfo.mTtl, compressInfo));
+                                              aInstanceInfo.mTtl, dictionary));
         IncResourceRecordCount(responseHeader, false);
     }
 
@@ -859,7 +778,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
         {
             SuccessOrExit(error = AppendSrvRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mHostName,
                                                   aInstanceInfo.mTtl, aInstanceInfo.mPriority, aInstanceInfo.mWeight,
-                                                  aInstanceInfo.mPort, compressInfo));
+                                                  aInstanceInfo.mPort, dictionary));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -867,7 +786,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                         ResourceRecord::kTypeTxt) == !additional)
         {
             SuccessOrExit(error = AppendTxtRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mTxtData,
-                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, compressInfo));
+                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, dictionary));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -882,7 +801,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                           !address.IsLoopback());
 
                 SuccessOrExit(error = AppendAaaaRecord(responseMessage, aInstanceInfo.mHostName, address,
-                                                       aInstanceInfo.mTtl, compressInfo));
+                                                       aInstanceInfo.mTtl, dictionary));
                 IncResourceRecordCount(responseHeader, additional);
             }
         }
@@ -895,10 +814,12 @@ exit:
 
 void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, const otDnssdHostInfo &aHostInfo)
 {
-    Header &          responseHeader  = aQuery.GetResponseHeader();
-    Message &         responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header &                    responseHeader  = aQuery.GetResponseHeader();
+    Message &                   responseMessage = aQuery.GetResponseMessage();
+    Error                       error           = kErrorNone;
+    Name::CompressionDictionary dictionary;
+
+    AddQuestionNames(responseHeader, responseMessage, dictionary);
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aHostFullName, ResourceRecord::kTypeAaaa))
     {
@@ -910,7 +831,7 @@ void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, co
                       !address.IsLoopback());
 
             SuccessOrExit(error =
-                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, compressInfo));
+                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, dictionary));
             IncResourceRecordCount(responseHeader, /* aAdditional */ false);
         }
     }
@@ -1137,14 +1058,12 @@ void Server::FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseC
 
 void Server::QueryTransaction::Init(const Header &          aResponseHeader,
                                     Message &               aResponseMessage,
-                                    const NameCompressInfo &aCompressInfo,
                                     const Ip6::MessageInfo &aMessageInfo)
 {
     OT_ASSERT(mResponseMessage == nullptr);
 
     mResponseHeader  = aResponseHeader;
     mResponseMessage = &aResponseMessage;
-    mCompressInfo    = aCompressInfo;
     mMessageInfo     = aMessageInfo;
     mStartTime       = TimerMilli::GetNow();
 }
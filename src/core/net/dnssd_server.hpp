@@ -146,87 +146,6 @@ public:
     static DnsQueryType GetQueryTypeAndName(const otDnssdQuery *aQuery, char (&aName)[Name::kMaxNameSize]);
 
 private:
-    class NameCompressInfo : public Clearable<NameCompressInfo>
-    {
-    public:
-        explicit NameCompressInfo(void) = default;
-
-        explicit NameCompressInfo(const char *aDomainName)
-            : mDomainName(aDomainName)
-            , mDomainNameOffset(kUnknownOffset)
-            , mServiceNameOffset(kUnknownOffset)
-            , mInstanceNameOffset(kUnknownOffset)
-            , mHostNameOffset(kUnknownOffset)
-        {
-        }
-
-        enum : uint16_t
-        {
-            kUnknownOffset = 0, // Unknown offset value (used when offset is not yet set).
-        };
-
-        uint16_t GetDomainNameOffset(void) const { return mDomainNameOffset; }
-
-        void SetDomainNameOffset(uint16_t aOffset) { mDomainNameOffset = aOffset; }
-
-        const char *GetDomainName(void) const { return mDomainName; }
-
-        uint16_t GetServiceNameOffset(const Message &aMessage, const char *aServiceName) const
-        {
-            return MatchCompressedName(aMessage, mServiceNameOffset, aServiceName)
-                       ? mServiceNameOffset
-                       : static_cast<uint16_t>(kUnknownOffset);
-        };
-
-        void SetServiceNameOffset(uint16_t aOffset)
-        {
-            if (mServiceNameOffset == kUnknownOffset)
-            {
-                mServiceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetInstanceNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mInstanceNameOffset, aName) ? mInstanceNameOffset
-                                                                             : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetInstanceNameOffset(uint16_t aOffset)
-        {
-            if (mInstanceNameOffset == kUnknownOffset)
-            {
-                mInstanceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetHostNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mHostNameOffset, aName) ? mHostNameOffset
-                                                                         : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetHostNameOffset(uint16_t aOffset)
-        {
-            if (mHostNameOffset == kUnknownOffset)
-            {
-                mHostNameOffset = aOffset;
-            }
-        }
-
-    private:
-        static bool MatchCompressedName(const Message &aMessage, uint16_t aOffset, const char *aName)
-        {
-            return aOffset != kUnknownOffset && Name::CompareName(aMessage, aOffset, aName) == kErrorNone;
-        }
-
-        const char *mDomainName;         // The serialized domain name.
-        uint16_t    mDomainNameOffset;   // Offset of domain name serialization into the response message.
-        uint16_t    mServiceNameOffset;  // Offset of service name serialization into the response message.
-        uint16_t    mInstanceNameOffset; // Offset of instance name serialization into the response message.
-        uint16_t    mHostNameOffset;     // Offset of host name serialization into the response message.
-    };
-
     enum
     {
         kPort                 = OPENTHREAD_CONFIG_DNSSD_SERVER_PORT,
@@ -266,7 +185,10 @@ private:
     };
 
     /**
-     * This class contains the compress information for a dns packet.
+     * This class contains the pending response for a dns packet.
+     *
+     * The name compression dictionary of the response is not kept, it is rebuilt from the question section of the
+     * response message when the query is answered.
      *
      */
     class QueryTransaction
@@ -279,7 +201,6 @@ private:
 
         void                    Init(const Header &          aResponseHeader,
                                      Message &               aResponseMessage,
-                                     const NameCompressInfo &aCompressInfo,
                                      const Ip6::MessageInfo &aMessageInfo);
         bool                    IsValid(void) const { return mResponseMessage != nullptr; }
         const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
@@ -288,12 +209,10 @@ private:
         const Message &         GetResponseMessage(void) const { return *mResponseMessage; }
         Message &               GetResponseMessage(void) { return *mResponseMessage; }
         TimeMilli               GetStartTime(void) const { return mStartTime; }
-        NameCompressInfo &      GetNameCompressInfo(void) { return mCompressInfo; };
         void                    Finalize(Header::Response aResponseMessage, Ip6::Udp::Socket &aSocket);
 
         Header           mResponseHeader;
         Message *        mResponseMessage;
-        NameCompressInfo mCompressInfo;
         Ip6::MessageInfo mMessageInfo;
         TimeMilli        mStartTime;
     };
@@ -307,42 +226,45 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage, const Ip6::MessageInfo &aMessageInfo);
-    static Header::Response AddQuestions(const Header &    aRequestHeader,
-                                         const Message &   aRequestMessage,
-                                         Header &          aResponseHeader,
-                                         Message &         aResponseMessage,
-                                         NameCompressInfo &aCompressInfo);
-    static Error            AppendQuestion(const char *      aName,
-                                           const Question &  aQuestion,
-                                           Message &         aMessage,
-                                           NameCompressInfo &aCompressInfo);
-    static Error            AppendPtrRecord(Message &         aMessage,
-                                            const char *      aServiceName,
-                                            const char *      aInstanceName,
-                                            uint32_t          aTtl,
-                                            NameCompressInfo &aCompressInfo);
-    static Error            AppendSrvRecord(Message &         aMessage,
-                                            const char *      aInstanceName,
-                                            const char *      aHostName,
-                                            uint32_t          aTtl,
-                                            uint16_t          aPriority,
-                                            uint16_t          aWeight,
-                                            uint16_t          aPort,
-                                            NameCompressInfo &aCompressInfo);
-    static Error            AppendTxtRecord(Message &         aMessage,
-                                            const char *      aInstanceName,
-                                            const void *      aTxtData,
-                                            uint16_t          aTxtLength,
-                                            uint32_t          aTtl,
-                                            NameCompressInfo &aCompressInfo);
-    static Error            AppendAaaaRecord(Message &           aMessage,
-                                             const char *        aHostName,
-                                             const Ip6::Address &aAddress,
-                                             uint32_t            aTtl,
-                                             NameCompressInfo &  aCompressInfo);
-    static Error            AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
-    static Error            AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
-    static Error            AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
+    static Header::Response AddQuestions(const Header &               aRequestHeader,
+                                         const Message &              aRequestMessage,
+                                         Header &                     aResponseHeader,
+                                         Message &                    aResponseMessage,
+                                         Name::CompressionDictionary &aDictionary);
+    static Error            AppendQuestion(const char *                 aName,
+                                           const Question &             aQuestion,
+                                           Message &                    aMessage,
+                                           Name::CompressionDictionary &aDictionary);
+    static Error            AppendPtrRecord(Message &                    aMessage,
+                                            const char *                 aServiceName,
+                                            const char *                 aInstanceName,
+                                            uint32_t                     aTtl,
+                                            Name::CompressionDictionary &aDictionary);
+    static Error            AppendSrvRecord(Message &                    aMessage,
+                                            const char *                 aInstanceName,
+                                            const char *                 aHostName,
+                                            uint32_t                     aTtl,
+                                            uint16_t                     aPriority,
+                                            uint16_t                     aWeight,
+                                            uint16_t                     aPort,
+                                            Name::CompressionDictionary &aDictionary);
+    static Error            AppendTxtRecord(Message &                    aMessage,
+                                            const char *                 aInstanceName,
+                                            const void *                 aTxtData,
+                                            uint16_t                     aTxtLength,
+                                            uint32_t                     aTtl,
+                                            Name::CompressionDictionary &aDictionary);
+    static Error            AppendAaaaRecord(Message &                    aMessage,
+                                             const char *                 aHostName,
+                                             const Ip6::Address &         aAddress,
+                                             uint32_t                     aTtl,
+                                             Name::CompressionDictionary &aDictionary);
+    static Error            AppendInstanceName(Message &                    aMessage,
+                                               const char *                 aName,
+                                               Name::CompressionDictionary &aDictionary);
+    static void             AddQuestionNames(const Header &               aHeader,
+                                             const Message &              aMessage,
+                                             Name::CompressionDictionary &aDictionary);
     static void             IncResourceRecordCount(Header &aHeader, bool aAdditional);
     static Error            FindNameComponents(const char *aName, const char *aDomain, NameComponentsOffsetInfo &aInfo);
     static Error            FindPreviousLabel(const char *aName, uint8_t &aStart, uint8_t &aStop);
@@ -352,15 +274,15 @@ private:
                                          const Ip6::MessageInfo &aMessageInfo,
                                          Ip6::Udp::Socket &      aSocket);
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-    Header::Response                   ResolveBySrp(Header &                  aResponseHeader,
-                                                    Message &                 aResponseMessage,
-                                                    Server::NameCompressInfo &aCompressInfo);
-    Header::Response                   ResolveQuestionBySrp(const char *      aName,
-                                                            const Question &  aQuestion,
-                                                            Header &          aResponseHeader,
-                                                            Message &         aResponseMessage,
-                                                            NameCompressInfo &aCompressInfo,
-                                                            bool              aAdditional);
+    Header::Response                   ResolveBySrp(Header &                     aResponseHeader,
+                                                    Message &                    aResponseMessage,
+                                                    Name::CompressionDictionary &aDictionary);
+    Header::Response                   ResolveQuestionBySrp(const char *                 aName,
+                                                            const Question &             aQuestion,
+                                                            Header &                     aResponseHeader,
+                                                            Message &                    aResponseMessage,
+                                                            Name::CompressionDictionary &aDictionary,
+                                                            bool                         aAdditional);
     const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
                                                          const Srp::Server::Service *aService);
@@ -368,11 +290,9 @@ private:
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
                                               Message &               aResponseMessage,
-                                              NameCompressInfo &      aCompressInfo,
                                               const Ip6::MessageInfo &aMessageInfo);
     QueryTransaction *NewQuery(const Header &          aResponseHeader,
                                Message &               aResponseMessage,
-                               const NameCompressInfo &aCompressInfo,
                                const Ip6::MessageInfo &aMessageInfo);
     static bool       CanAnswerQuery(const QueryTransaction &          aQuery,
                                      const char *                      aServiceFullName,
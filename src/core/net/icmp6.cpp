@@ -137,6 +137,13 @@ Error Icmp::HandleMessage(Message &aMessage, MessageInfo &aMessageInfo)
         SuccessOrExit(error = HandleEchoRequest(aMessage, aMessageInfo));
     }
 
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    if (icmp6Header.GetType() == Header::kTypePacketToBig)
+    {
+        HandlePacketTooBig(aMessage, icmp6Header);
+    }
+#endif
+
     aMessage.MoveOffset(sizeof(icmp6Header));
 
     for (Handler *handler = mHandlers.GetHead(); handler; handler = handler->GetNext())
@@ -148,6 +155,24 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+void Icmp::HandlePacketTooBig(const Message &aMessage, const Header &aIcmpHeader)
+{
+    ot::Ip6::Header header;
+
+    // The Packet Too Big message carries the start of the invoking
+    // packet. Only packets originated by this device are accepted.
+
+    SuccessOrExit(aMessage.Read(aMessage.GetOffset() + sizeof(aIcmpHeader), header));
+    VerifyOrExit(Get<ThreadNetif>().HasUnicastAddress(header.GetSource()));
+
+    Get<Ip6>().UpdatePathMtu(header.GetDestination(), aIcmpHeader.GetMtu());
+
+exit:
+    return;
+}
+#endif
+
 bool Icmp::ShouldHandleEchoRequest(const MessageInfo &aMessageInfo)
 {
     bool rval = false;
@@ -49,6 +49,7 @@ namespace ot {
 namespace Ip6 {
 
 using ot::Encoding::BigEndian::HostSwap16;
+using ot::Encoding::BigEndian::HostSwap32;
 
 /**
  * @addtogroup core-ip6-icmp6
@@ -197,6 +198,22 @@ public:
          *
          */
         void SetSequence(uint16_t aSequence) { mData.m16[1] = HostSwap16(aSequence); }
+
+        /**
+         * This method returns the MTU field of an ICMPv6 Packet Too Big message.
+         *
+         * @returns The MTU (in bytes).
+         *
+         */
+        uint32_t GetMtu(void) const { return HostSwap32(mData.m32[0]); }
+
+        /**
+         * This method sets the MTU field of an ICMPv6 Packet Too Big message.
+         *
+         * @param[in]  aMtu  The MTU (in bytes).
+         *
+         */
+        void SetMtu(uint32_t aMtu) { mData.m32[0] = HostSwap32(aMtu); }
     } OT_TOOL_PACKED_END;
 
     /**
@@ -335,6 +352,9 @@ public:
 
 private:
     Error HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    void HandlePacketTooBig(const Message &aMessage, const Header &aIcmpHeader);
+#endif
 
     LinkedList<Handler> mHandlers;
 
@@ -51,6 +51,7 @@
 #include "net/udp6.hpp"
 #include "openthread/ip6.h"
 #include "thread/mle.hpp"
+#include "utils/packet_trace.hpp"
 
 using IcmpType = ot::Ip6::Icmp::Header::Type;
 
@@ -76,6 +77,12 @@ Ip6::Ip6(Instance &aInstance)
     , mTcp(aInstance)
 #endif
 {
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    for (PathMtuEntry &entry : mPathMtuCache)
+    {
+        entry.Clear();
+    }
+#endif
 }
 
 Message *Ip6::NewMessage(uint16_t aReserved, const Message::Settings &aSettings)
@@ -443,6 +450,7 @@ exit:
 void Ip6::EnqueueDatagram(Message &aMessage)
 {
     mSendQueue.Enqueue(aMessage);
+    OT_PACKET_TRACE(kIp6Send, &aMessage, mSendQueue.GetNumMessages());
     mSendQueueTask.Post();
 }
 
@@ -513,7 +521,7 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     aMessage.SetMulticastLoop(aMessageInfo.GetMulticastLoop());
 
-    if (aMessage.GetLength() > kMaxDatagramLength)
+    if (aMessage.GetLength() > GetPathMtu(header.GetDestination()))
     {
         error = FragmentDatagram(aMessage, aIpProto);
     }
@@ -605,71 +613,167 @@ exit:
 }
 
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+uint16_t Ip6::GetPathMtu(const Address &aDestination) const
+{
+    uint16_t  mtu = kMaxDatagramLength;
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (const PathMtuEntry &entry : mPathMtuCache)
+    {
+        if (entry.IsValid(now) && (entry.mDestination == aDestination))
+        {
+            mtu = entry.mMtu;
+            break;
+        }
+    }
+
+    return mtu;
+}
+
+void Ip6::UpdatePathMtu(const Address &aDestination, uint32_t aMtu)
+{
+    TimeMilli     now   = TimerMilli::GetNow();
+    PathMtuEntry *entry = nullptr;
+
+    if (aMtu < kMinimalMtu)
+    {
+        aMtu = kMinimalMtu;
+    }
+
+    VerifyOrExit(aMtu < kMaxDatagramLength);
+
+    // Use the entry of the destination if there is one, otherwise an
+    // expired entry or the entry which is closest to expiring.
+
+    for (PathMtuEntry &cacheEntry : mPathMtuCache)
+    {
+        if (cacheEntry.IsValid(now) && (cacheEntry.mDestination == aDestination))
+        {
+            VerifyOrExit(aMtu < cacheEntry.mMtu);
+            entry = &cacheEntry;
+            break;
+        }
+
+        if ((entry == nullptr) || !cacheEntry.IsValid(now) ||
+            (entry->IsValid(now) && (cacheEntry.mExpireTime < entry->mExpireTime)))
+        {
+            entry = &cacheEntry;
+        }
+    }
+
+    entry->mDestination = aDestination;
+    entry->mMtu         = static_cast<uint16_t>(aMtu);
+    entry->mExpireTime  = now + Time::SecToMsec(kPathMtuCacheTimeout);
+
+    otLogNoteIp6("Path MTU to %s is %d", aDestination.ToString().AsCString(), entry->mMtu);
+
+exit:
+    return;
+}
+
 Error Ip6::FragmentDatagram(Message &aMessage, uint8_t aIpProto)
 {
     Error          error = kErrorNone;
     Header         header;
     FragmentHeader fragmentHeader;
-    Message *      fragment        = nullptr;
-    uint16_t       fragmentCnt     = 0;
-    uint16_t       payloadFragment = 0;
-    uint16_t       offset          = 0;
-
-    uint16_t maxPayloadFragment =
-        FragmentHeader::MakeDivisibleByEight(kMinimalMtu - aMessage.GetOffset() - sizeof(fragmentHeader));
-    uint16_t payloadLeft = aMessage.GetLength() - aMessage.GetOffset();
+    MessageQueue   fragments;
+    Message *      fragment     = nullptr;
+    uint16_t       headerLength = aMessage.GetOffset();
+    uint16_t       pathMtu;
+    uint16_t       maxPayloadFragment;
+    uint16_t       offset;
 
     SuccessOrExit(error = aMessage.Read(0, header));
+
+    pathMtu = GetPathMtu(header.GetDestination());
+    VerifyOrExit(headerLength + sizeof(fragmentHeader) + 8 <= pathMtu, error = kErrorInvalidArgs);
+
+    maxPayloadFragment = FragmentHeader::MakeDivisibleByEight(pathMtu - headerLength - sizeof(fragmentHeader));
     header.SetNextHeader(kProtoFragment);
 
     fragmentHeader.Init();
     fragmentHeader.SetIdentification(Random::NonCrypto::GetUint32());
     fragmentHeader.SetNextHeader(aIpProto);
-    fragmentHeader.SetMoreFlag();
 
-    while (payloadLeft != 0)
+    // Fragments are created starting from the last one. Once the
+    // payload of a fragment is copied, it is removed from the end of
+    // `aMessage` which frees its buffers, so at most one fragment
+    // worth of extra buffers is needed. What is left of `aMessage`
+    // then becomes the first fragment by inserting the Fragment
+    // header in place, without copying its payload.
+
+    offset = (aMessage.GetLength() - headerLength - 1) / maxPayloadFragment * maxPayloadFragment;
+
+    while (offset > 0)
     {
-        if (payloadLeft < maxPayloadFragment)
+        uint16_t payloadFragment = aMessage.GetLength() - headerLength - offset;
+
+        if (fragments.GetHead() == nullptr)
         {
             fragmentHeader.ClearMoreFlag();
-
-            payloadFragment = payloadLeft;
-            payloadLeft     = 0;
-
-            otLogDebgIp6("Last Fragment");
         }
         else
         {
-            payloadLeft -= maxPayloadFragment;
-            payloadFragment = maxPayloadFragment;
+            fragmentHeader.SetMoreFlag();
         }
 
-        offset = fragmentCnt * FragmentHeader::BytesToFragmentOffset(maxPayloadFragment);
-        fragmentHeader.SetOffset(offset);
+        fragmentHeader.SetOffset(FragmentHeader::BytesToFragmentOffset(offset));
 
-        VerifyOrExit((fragment = NewMessage(0)) != nullptr, error = kErrorNoBufs);
-        SuccessOrExit(error = fragment->SetLength(aMessage.GetOffset() + sizeof(fragmentHeader) + payloadFragment));
+        VerifyOrExit((fragment = NewMessage(0, Message::Settings(aMessage.IsLinkSecurityEnabled()
+                                                                     ? Message::kWithLinkSecurity
+                                                                     : Message::kNoLinkSecurity,
+                                                                 aMessage.GetPriority()))) != nullptr,
+                     error = kErrorNoBufs);
+        SuccessOrExit(error = fragment->SetLength(headerLength + sizeof(fragmentHeader) + payloadFragment));
 
-        header.SetPayloadLength(payloadFragment + sizeof(fragmentHeader));
+        aMessage.CopyTo(0, 0, headerLength, *fragment);
+        header.SetPayloadLength(fragment->GetLength() - sizeof(header));
         fragment->Write(0, header);
 
-        fragment->SetOffset(aMessage.GetOffset());
-        fragment->Write(aMessage.GetOffset(), fragmentHeader);
+        fragment->SetOffset(headerLength);
+        fragment->Write(headerLength, fragmentHeader);
 
-        VerifyOrExit(aMessage.CopyTo(aMessage.GetOffset() + FragmentHeader::FragmentOffsetToBytes(offset),
-                                     aMessage.GetOffset() + sizeof(fragmentHeader), payloadFragment,
+        VerifyOrExit(aMessage.CopyTo(headerLength + offset, headerLength + sizeof(fragmentHeader), payloadFragment,
                                      *fragment) == static_cast<int>(payloadFragment),
                      error = kErrorNoBufs);
 
-        EnqueueDatagram(*fragment);
+        IgnoreError(aMessage.SetLength(headerLength + offset));
 
-        fragmentCnt++;
+        fragments.Enqueue(*fragment, MessageQueue::kQueuePositionHead);
         fragment = nullptr;
 
-        otLogInfoIp6("Fragment %d with %d bytes sent", fragmentCnt, payloadFragment);
+        offset -= maxPayloadFragment;
+    }
+
+    if (fragments.GetHead() == nullptr)
+    {
+        fragmentHeader.ClearMoreFlag();
+    }
+    else
+    {
+        fragmentHeader.SetMoreFlag();
     }
 
-    aMessage.Free();
+    fragmentHeader.SetOffset(0);
+
+    SuccessOrExit(error = aMessage.PrependBytes(nullptr, sizeof(fragmentHeader)));
+    aMessage.CopyTo(sizeof(fragmentHeader), 0, headerLength, aMessage);
+    aMessage.SetOffset(headerLength);
+
+    header.SetPayloadLength(aMessage.GetLength() - sizeof(header));
+    aMessage.Write(0, header);
+    aMessage.Write(headerLength, fragmentHeader);
+
+    EnqueueDatagram(aMessage);
+
+    while ((fragment = fragments.GetHead()) != nullptr)
+    {
+        fragments.Dequeue(*fragment);
+        EnqueueDatagram(*fragment);
+    }
+
+    otLogInfoIp6("Datagram fragmented with id %d, max fragment payload %d", fragmentHeader.GetIdentification(),
+                 maxPayloadFragment);
 
 exit:
 
@@ -679,13 +783,42 @@ exit:
     }
 
     FreeMessageOnError(fragment, error);
+
+    while ((fragment = fragments.GetHead()) != nullptr)
+    {
+        fragments.Dequeue(*fragment);
+        fragment->Free();
+    }
+
     return error;
 }
 
+Message *Ip6::FindReassemblyMessage(const Header &aHeader, uint32_t aIdentification)
+{
+    Message *message;
+
+    // The identification is kept in the message metadata, so the IPv6
+    // header of a message under reassembly is only read when the
+    // identification matches.
+
+    for (message = mReassemblyList.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        Header header;
+
+        if ((message->GetDatagramTag() == aIdentification) && (message->Read(0, header) == kErrorNone) &&
+            (header.GetSource() == aHeader.GetSource()) && (header.GetDestination() == aHeader.GetDestination()))
+        {
+            break;
+        }
+    }
+
+    return message;
+}
+
 Error Ip6::HandleFragment(Message &aMessage, Netif *aNetif, MessageInfo &aMessageInfo, bool aFromNcpHost)
 {
     Error          error = kErrorNone;
-    Header         header, headerBuffer;
+    Header         header;
     FragmentHeader fragmentHeader;
     Message *      message         = nullptr;
     uint16_t       offset          = 0;
@@ -705,16 +838,7 @@ Error Ip6::HandleFragment(Message &aMessage, Netif *aNetif, MessageInfo &aMessag
         ExitNow();
     }
 
-    for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
-    {
-        SuccessOrExit(error = message->Read(0, headerBuffer));
-
-        if (message->GetDatagramTag() == fragmentHeader.GetIdentification() &&
-            headerBuffer.GetSource() == header.GetSource() && headerBuffer.GetDestination() == header.GetDestination())
-        {
-            break;
-        }
-    }
+    message = FindReassemblyMessage(header, fragmentHeader.GetIdentification());
 
     offset          = FragmentHeader::FragmentOffsetToBytes(fragmentHeader.GetOffset());
     payloadFragment = aMessage.GetLength() - aMessage.GetOffset() - sizeof(fragmentHeader);
@@ -864,6 +988,13 @@ exit:
 }
 
 #else
+uint16_t Ip6::GetPathMtu(const Address &aDestination) const
+{
+    OT_UNUSED_VARIABLE(aDestination);
+
+    return kMaxDatagramLength;
+}
+
 Error Ip6::FragmentDatagram(Message &aMessage, uint8_t aIpProto)
 {
     OT_UNUSED_VARIABLE(aIpProto);
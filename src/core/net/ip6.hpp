@@ -300,6 +300,40 @@ public:
      */
     const PriorityQueue &GetSendQueue(void) const { return mSendQueue; }
 
+    /**
+     * This method returns a reference to the send queue.
+     *
+     * @returns A reference to the send queue.
+     *
+     */
+    PriorityQueue &GetSendQueue(void) { return mSendQueue; }
+
+    /**
+     * This method returns the Path MTU towards a given destination.
+     *
+     * The Path MTU is `kMaxDatagramLength` unless a smaller value was learned from an ICMPv6 Packet Too Big message.
+     *
+     * @param[in]  aDestination  The destination address.
+     *
+     * @returns The Path MTU (in bytes) towards @p aDestination.
+     *
+     */
+    uint16_t GetPathMtu(const Address &aDestination) const;
+
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    /**
+     * This method updates the Path MTU towards a given destination (RFC 8201).
+     *
+     * An @p aMtu smaller than the IPv6 minimum link MTU (1280 bytes) is raised to the minimum. An @p aMtu which is not
+     * smaller than the current Path MTU is ignored.
+     *
+     * @param[in]  aDestination  The destination address.
+     * @param[in]  aMtu          The MTU reported in the ICMPv6 Packet Too Big message.
+     *
+     */
+    void UpdatePathMtu(const Address &aDestination, uint32_t aMtu);
+#endif
+
     /**
      * This static method converts an `IpProto` enumeration to a string.
      *
@@ -325,6 +359,27 @@ private:
         kStateUpdatePeriod = 1000,
     };
 
+#if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
+    enum : uint8_t
+    {
+        kPathMtuCacheSize = OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_SIZE,
+    };
+
+    enum : uint32_t
+    {
+        kPathMtuCacheTimeout = OPENTHREAD_CONFIG_IP6_PATH_MTU_CACHE_TIMEOUT, // in seconds
+    };
+
+    struct PathMtuEntry : public Clearable<PathMtuEntry>
+    {
+        bool IsValid(TimeMilli aNow) const { return (mMtu != 0) && (aNow < mExpireTime); }
+
+        Address   mDestination;
+        TimeMilli mExpireTime;
+        uint16_t  mMtu;
+    };
+#endif
+
     static void HandleSendQueue(Tasklet &aTasklet);
     void        HandleSendQueue(void);
 
@@ -348,10 +403,11 @@ private:
     Error FragmentDatagram(Message &aMessage, uint8_t aIpProto);
     Error HandleFragment(Message &aMessage, Netif *aNetif, MessageInfo &aMessageInfo, bool aFromNcpHost);
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
-    void CleanupFragmentationBuffer(void);
-    void HandleTimeTick(void);
-    void UpdateReassemblyList(void);
-    void SendIcmpError(Message &aMessage, Icmp::Header::Type aIcmpType, Icmp::Header::Code aIcmpCode);
+    Message *FindReassemblyMessage(const Header &aHeader, uint32_t aIdentification);
+    void     CleanupFragmentationBuffer(void);
+    void     HandleTimeTick(void);
+    void     UpdateReassemblyList(void);
+    void     SendIcmpError(Message &aMessage, Icmp::Header::Type aIcmpType, Icmp::Header::Code aIcmpCode);
 #endif
     Error AddMplOption(Message &aMessage, Header &aHeader);
     Error AddTunneledMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMessageInfo);
@@ -383,6 +439,7 @@ private:
 
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
     MessageQueue mReassemblyList;
+    PathMtuEntry mPathMtuCache[kPathMtuCacheSize];
 #endif
 };
 
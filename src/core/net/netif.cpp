@@ -113,7 +113,8 @@ Netif::Netif(Instance &aInstance)
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
-    return mMulticastAddresses.ContainsMatching(aAddress);
+    return mMulticastAddressSet.IsOverflowed() ? mMulticastAddresses.ContainsMatching(aAddress)
+                                               : mMulticastAddressSet.Contains(aAddress);
 }
 
 void Netif::SubscribeAllNodesMulticast(void)
@@ -140,6 +141,7 @@ void Netif::SubscribeAllNodesMulticast(void)
         tail->SetNext(&linkLocalAllNodesAddress);
     }
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -190,6 +192,7 @@ void Netif::UnsubscribeAllNodesMulticast(void)
         prev->SetNext(nullptr);
     }
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -250,6 +253,7 @@ void Netif::SubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllRoutersAddress);
     }
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -296,6 +300,7 @@ void Netif::UnsubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllNodesAddress);
     }
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -322,6 +327,7 @@ void Netif::SubscribeMulticast(NetifMulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Add(aAddress));
 
+    mMulticastAddressSet.Add(aAddress.GetAddress());
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -341,6 +347,7 @@ void Netif::UnsubscribeMulticast(const NetifMulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Remove(aAddress));
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -382,6 +389,7 @@ Error Netif::SubscribeExternalMulticast(const Address &aAddress)
     entry->mMlrState = kMlrStateToRegister;
 #endif
     mMulticastAddresses.Push(*entry);
+    mMulticastAddressSet.Add(entry->GetAddress());
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
 exit:
@@ -403,6 +411,7 @@ Error Netif::UnsubscribeExternalMulticast(const Address &aAddress)
 
     mExtMulticastAddressPool.Free(static_cast<ExternalNetifMulticastAddress &>(*entry));
 
+    UpdateMulticastAddressSet();
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
 exit:
@@ -434,6 +443,7 @@ void Netif::AddUnicastAddress(NetifUnicastAddress &aAddress)
 {
     SuccessOrExit(mUnicastAddresses.Add(aAddress));
 
+    mUnicastAddressSet.Add(aAddress.GetAddress());
     Get<Notifier>().Signal(aAddress.mRloc ? kEventThreadRlocAdded : kEventIp6AddressAdded);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -453,6 +463,7 @@ void Netif::RemoveUnicastAddress(const NetifUnicastAddress &aAddress)
 {
     SuccessOrExit(mUnicastAddresses.Remove(aAddress));
 
+    UpdateUnicastAddressSet();
     Get<Notifier>().Signal(aAddress.mRloc ? kEventThreadRlocRemoved : kEventIp6AddressRemoved);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -493,6 +504,7 @@ Error Netif::AddExternalUnicastAddress(const NetifUnicastAddress &aAddress)
 
     *entry = aAddress;
     mUnicastAddresses.Push(*entry);
+    mUnicastAddressSet.Add(entry->GetAddress());
     Get<Notifier>().Signal(kEventIp6AddressAdded);
 
 exit:
@@ -512,6 +524,7 @@ Error Netif::RemoveExternalUnicastAddress(const Address &aAddress)
 
     mUnicastAddresses.PopAfter(prev);
     mExtUnicastAddressPool.Free(*entry);
+    UpdateUnicastAddressSet();
     Get<Notifier>().Signal(kEventIp6AddressRemoved);
 
 exit:
@@ -535,7 +548,8 @@ void Netif::RemoveAllExternalUnicastAddresses(void)
 
 bool Netif::HasUnicastAddress(const Address &aAddress) const
 {
-    return mUnicastAddresses.ContainsMatching(aAddress);
+    return mUnicastAddressSet.IsOverflowed() ? mUnicastAddresses.ContainsMatching(aAddress)
+                                             : mUnicastAddressSet.Contains(aAddress);
 }
 
 bool Netif::IsUnicastAddressExternal(const NetifUnicastAddress &aAddress) const
@@ -543,6 +557,95 @@ bool Netif::IsUnicastAddressExternal(const NetifUnicastAddress &aAddress) const
     return mExtUnicastAddressPool.IsPoolEntry(aAddress);
 }
 
+void Netif::UpdateUnicastAddressSet(void)
+{
+    mUnicastAddressSet.Clear();
+
+    for (const NetifUnicastAddress *entry = mUnicastAddresses.GetHead(); entry != nullptr; entry = entry->GetNext())
+    {
+        mUnicastAddressSet.Add(entry->GetAddress());
+    }
+}
+
+void Netif::UpdateMulticastAddressSet(void)
+{
+    mMulticastAddressSet.Clear();
+
+    for (const NetifMulticastAddress *entry = mMulticastAddresses.GetHead(); entry != nullptr;
+         entry                              = entry->GetNext())
+    {
+        mMulticastAddressSet.Add(entry->GetAddress());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Netif::AddressSet
+
+void Netif::AddressSet::Clear(void)
+{
+    memset(mSlots, 0, sizeof(mSlots));
+    mNumAddresses = 0;
+    mOverflowed   = false;
+}
+
+void Netif::AddressSet::Add(const Address &aAddress)
+{
+    uint16_t slot;
+
+    VerifyOrExit(!mOverflowed);
+
+    // Once more addresses are added than the set can hold, it is
+    // flagged as overflowed (and stays so until it is rebuilt) so
+    // that the caller falls back to searching the address list.
+
+    if (mNumAddresses == kMaxAddresses)
+    {
+        mOverflowed = true;
+        ExitNow();
+    }
+
+    for (slot = GetSlot(aAddress); mSlots[slot] != nullptr; slot = (slot + 1) % kNumSlots)
+    {
+        VerifyOrExit(*mSlots[slot] != aAddress);
+    }
+
+    mSlots[slot] = &aAddress;
+    mNumAddresses++;
+
+exit:
+    return;
+}
+
+bool Netif::AddressSet::Contains(const Address &aAddress) const
+{
+    bool contains = false;
+
+    // The set is never full, so the probing ends on an empty slot.
+
+    for (uint16_t slot = GetSlot(aAddress); mSlots[slot] != nullptr; slot = (slot + 1) % kNumSlots)
+    {
+        if (*mSlots[slot] == aAddress)
+        {
+            contains = true;
+            break;
+        }
+    }
+
+    return contains;
+}
+
+uint16_t Netif::AddressSet::GetSlot(const Address &aAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint32_t word : aAddress.mFields.m32)
+    {
+        hash = (hash ^ word) * 0x9e3779b1;
+    }
+
+    return static_cast<uint16_t>((hash >> 16) % kNumSlots);
+}
+
 void NetifUnicastAddress::InitAsThreadOrigin(bool aPreferred)
 {
     Clear();
@@ -613,6 +613,40 @@ protected:
     void UnsubscribeAllNodesMulticast(void);
 
 private:
+    /**
+     * This class implements a set of IPv6 addresses as an open addressing hash table of pointers to the addresses of
+     * the entries in an address list.
+     *
+     * The set is kept alongside the list: an address is added when an entry is added, and the set is rebuilt when an
+     * entry is removed. Therefore the address of an entry MUST NOT be changed while the entry is in the list.
+     *
+     */
+    class AddressSet
+    {
+    public:
+        AddressSet(void) { Clear(); }
+
+        void Clear(void);
+        void Add(const Address &aAddress);
+        bool IsOverflowed(void) const { return mOverflowed; }
+        bool Contains(const Address &aAddress) const;
+
+    private:
+        enum : uint16_t
+        {
+            kNumSlots     = OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE,
+            kMaxAddresses = (kNumSlots * 3) / 4,
+        };
+
+        static_assert(kMaxAddresses > 0, "OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE is too small");
+
+        static uint16_t GetSlot(const Address &aAddress);
+
+        const Address *mSlots[kNumSlots];
+        uint16_t       mNumAddresses;
+        bool           mOverflowed;
+    };
+
     class ExternalMulticastAddressIteratorBuilder
     {
     public:
@@ -633,8 +667,13 @@ private:
         Address::TypeFilter mFilter;
     };
 
+    void UpdateUnicastAddressSet(void);
+    void UpdateMulticastAddressSet(void);
+
     LinkedList<NetifUnicastAddress>   mUnicastAddresses;
     LinkedList<NetifMulticastAddress> mMulticastAddresses;
+    AddressSet                        mUnicastAddressSet;
+    AddressSet                        mMulticastAddressSet;
     bool                              mMulticastPromiscuous;
 
     otIp6AddressCallback mAddressCallback;
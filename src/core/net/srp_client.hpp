@@ -67,6 +67,9 @@ class Client : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged;
+
 public:
     /**
      * This enumeration types represents an SRP client item (service or host info) state.
@@ -35,6 +35,10 @@
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+#include <openthread/platform/ecdsa.h>
+#endif
+
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
@@ -82,11 +86,15 @@ Server::Server(Instance &aInstance)
     , mServiceUpdateHandlerContext(nullptr)
     , mLeaseTimer(aInstance, HandleLeaseTimer)
     , mOutstandingUpdatesTimer(aInstance, HandleOutstandingUpdatesTimer)
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    , mVerificationRequestId(0)
+#endif
     , mServiceUpdateId(Random::NonCrypto::GetUint32())
     , mEnabled(false)
     , mHasRegisteredAnyService(false)
 {
     IgnoreError(SetDomain(kDefaultDomain));
+    memset(&mVerificationCounters, 0, sizeof(mVerificationCounters));
 }
 
 void Server::SetServiceHandler(otSrpServerServiceUpdateHandler aServiceHandler, void *aServiceHandlerContext)
@@ -482,6 +490,10 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    FreePendingVerifications();
+#endif
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -555,14 +567,25 @@ void Server::HandleDnsUpdate(Message &                aMessage,
                              const Dns::UpdateHeader &aDnsHeader,
                              uint16_t                 aOffset)
 {
-    Error     error = kErrorNone;
-    Dns::Zone zone;
-    Host *    host = nullptr;
+    Error                          error  = kErrorNone;
+    TimeMilli                      rxTime = TimerMilli::GetNow();
+    Dns::Zone                      zone;
+    Host *                         host = nullptr;
+    Crypto::Sha256::Hash           hash;
+    Crypto::Ecdsa::P256::Signature signature;
 
     otLogInfoSrp("[server] receive DNS update from %s", aMessageInfo.GetPeerAddr().ToString().AsCString());
 
     SuccessOrExit(error = ProcessZoneSection(aMessage, aDnsHeader, aOffset, zone));
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    if (HasPendingVerification(aMessageInfo, aDnsHeader.GetMessageId()))
+    {
+        otLogInfoSrp("[server] drop SRP update request being verified: messageId=%hu", aDnsHeader.GetMessageId());
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     if (FindOutstandingUpdate(aMessageInfo, aDnsHeader.GetMessageId()) != nullptr)
     {
         otLogInfoSrp("[server] drop duplicated SRP update request: messageId=%hu", aDnsHeader.GetMessageId());
@@ -580,10 +603,10 @@ void Server::HandleDnsUpdate(Message &                aMessage,
     VerifyOrExit(host != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = ProcessUpdateSection(*host, aMessage, aDnsHeader, zone, aOffset));
 
-    // Parse lease time and validate signature.
-    SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aDnsHeader, aOffset));
+    // Parse lease time and the signature.
+    SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aDnsHeader, aOffset, hash, signature));
 
-    HandleUpdate(aDnsHeader, host, aMessageInfo);
+    VerifyAndHandleUpdate(aDnsHeader, *host, aMessageInfo, rxTime, hash, signature);
 
 exit:
     if (error != kErrorNone)
@@ -897,10 +920,12 @@ bool Server::IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord)
            aRecord.GetTtl() == 0 && aRecord.GetLength() == 0;
 }
 
-Error Server::ProcessAdditionalSection(Host *                   aHost,
-                                       const Message &          aMessage,
-                                       const Dns::UpdateHeader &aDnsHeader,
-                                       uint16_t &               aOffset) const
+Error Server::ProcessAdditionalSection(Host *                          aHost,
+                                       const Message &                 aMessage,
+                                       const Dns::UpdateHeader &       aDnsHeader,
+                                       uint16_t &                      aOffset,
+                                       Crypto::Sha256::Hash &          aHash,
+                                       Crypto::Ecdsa::P256::Signature &aSignature) const
 {
     Error            error = kErrorNone;
     Dns::OptRecord   optRecord;
@@ -946,36 +971,30 @@ Error Server::ProcessAdditionalSection(Host *                   aHost,
     signatureLength = sigRecord.GetLength() - (aOffset - sigRdataOffset);
     aOffset += signatureLength;
 
-    // Verify the signature. Currently supports only ECDSA.
+    // Read the signature and compute the hash it covers. Currently supports only ECDSA.
 
     VerifyOrExit(sigRecord.GetAlgorithm() == Dns::KeyRecord::kAlgorithmEcdsaP256Sha256, error = kErrorFailed);
     VerifyOrExit(sigRecord.GetTypeCovered() == 0, error = kErrorFailed);
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
-    SuccessOrExit(error = VerifySignature(*aHost->GetKey(), aMessage, aDnsHeader, sigOffset, sigRdataOffset,
-                                          sigRecord.GetLength(), signerName));
+    SuccessOrExit(error = aMessage.Read(aOffset - signatureLength, aSignature));
+    SuccessOrExit(error = ComputeSignedHash(aMessage, aDnsHeader, sigOffset, sigRdataOffset, signerName, aHash));
 
 exit:
     return error;
 }
 
-Error Server::VerifySignature(const Dns::Ecdsa256KeyRecord &aKey,
-                              const Message &               aMessage,
-                              Dns::UpdateHeader             aDnsHeader,
-                              uint16_t                      aSigOffset,
-                              uint16_t                      aSigRdataOffset,
-                              uint16_t                      aSigRdataLength,
-                              const char *                  aSignerName) const
+Error Server::ComputeSignedHash(const Message &       aMessage,
+                                Dns::UpdateHeader     aDnsHeader,
+                                uint16_t              aSigOffset,
+                                uint16_t              aSigRdataOffset,
+                                const char *          aSignerName,
+                                Crypto::Sha256::Hash &aHash) const
 {
-    Error                          error;
-    uint16_t                       offset = aMessage.GetOffset();
-    uint16_t                       signatureOffset;
-    Crypto::Sha256                 sha256;
-    Crypto::Sha256::Hash           hash;
-    Crypto::Ecdsa::P256::Signature signature;
-    Message *                      signerNameMessage = nullptr;
-
-    VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
+    Error          error;
+    uint16_t       offset = aMessage.GetOffset();
+    Crypto::Sha256 sha256;
+    Message *      signerNameMessage = nullptr;
 
     sha256.Start();
 
@@ -994,18 +1013,197 @@ Error Server::VerifySignature(const Dns::Ecdsa256KeyRecord &aKey,
     sha256.Update(aDnsHeader);
     sha256.Update(aMessage, offset + sizeof(aDnsHeader), aSigOffset - offset - sizeof(aDnsHeader));
 
-    sha256.Finish(hash);
+    sha256.Finish(aHash);
 
-    signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
-    SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
+exit:
+    FreeMessage(signerNameMessage);
+    return error;
+}
+
+void Server::VerifyAndHandleUpdate(const Dns::UpdateHeader &             aDnsHeader,
+                                   Host &                                aHost,
+                                   const Ip6::MessageInfo &              aMessageInfo,
+                                   TimeMilli                             aRxTime,
+                                   const Crypto::Sha256::Hash &          aHash,
+                                   const Crypto::Ecdsa::P256::Signature &aSignature)
+{
+    Error error;
+
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    // The platform verifies in the background and the update continues from
+    // `HandlePlatformVerifyDone()`. If the platform cannot take the request,
+    // fall back to verifying it here.
+    VerifyOrExit(StartPlatformVerification(aDnsHeader, aHost, aMessageInfo, aRxTime, aHash, aSignature) != kErrorNone);
+#endif
 
-    error = aKey.GetKey().Verify(hash, signature);
+    error = VerifySignature(aHost, aHash, aSignature);
+    HandleVerificationResult(error, aDnsHeader, aHost, aMessageInfo, aRxTime);
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
 exit:
-    FreeMessage(signerNameMessage);
+#endif
+    return;
+}
+
+Error Server::VerifySignature(Host &                                aHost,
+                              const Crypto::Sha256::Hash &          aHash,
+                              const Crypto::Ecdsa::P256::Signature &aSignature)
+{
+    Error                                 error;
+    const Crypto::Ecdsa::P256::PublicKey &publicKey = aHost.GetKey()->GetKey();
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE
+    // A registered host with the same name has the same key (checked by
+    // `HasNameConflictsWith()`), so its prepared key is used and kept
+    // up to date. Otherwise the key is prepared on the new host object
+    // which becomes the registered host on success.
+    Host *                                  existingHost = mHosts.FindMatching(aHost.GetFullName());
+    Crypto::Ecdsa::P256::PreparedPublicKey &preparedKey =
+        (existingHost != nullptr) ? existingHost->mPreparedKey : aHost.mPreparedKey;
+
+    if (preparedKey.IsPreparedFor(publicKey))
+    {
+        mVerificationCounters.mKeyCacheHits++;
+    }
+    else
+    {
+        SuccessOrExit(error = preparedKey.Prepare(publicKey));
+    }
+
+    error = preparedKey.Verify(aHash, aSignature);
+
+exit:
+#else
+    error = publicKey.Verify(aHash, aSignature);
+#endif
+
     return error;
 }
 
+void Server::HandleVerificationResult(Error                    aError,
+                                      const Dns::UpdateHeader &aDnsHeader,
+                                      Host &                   aHost,
+                                      const Ip6::MessageInfo & aMessageInfo,
+                                      TimeMilli                aRxTime)
+{
+    uint32_t latency = TimerMilli::GetNow() - aRxTime;
+
+    mVerificationCounters.mTotalLatency += latency;
+    mVerificationCounters.mMaxLatency = OT_MAX(mVerificationCounters.mMaxLatency, latency);
+
+    if (aError == kErrorNone)
+    {
+        mVerificationCounters.mVerified++;
+        HandleUpdate(aDnsHeader, &aHost, aMessageInfo);
+    }
+    else
+    {
+        otLogInfoSrp("[server] failed to verify signature: %s", ErrorToString(aError));
+        mVerificationCounters.mFailed++;
+        aHost.Free();
+        SendResponse(aDnsHeader, ErrorToDnsResponseCode(aError), aMessageInfo);
+    }
+}
+
+void Server::ResetVerificationCounters(void)
+{
+    uint16_t backlog = mVerificationCounters.mBacklog;
+
+    memset(&mVerificationCounters, 0, sizeof(mVerificationCounters));
+    mVerificationCounters.mBacklog    = backlog;
+    mVerificationCounters.mMaxBacklog = backlog;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
+Error Server::StartPlatformVerification(const Dns::UpdateHeader &             aDnsHeader,
+                                        Host &                                aHost,
+                                        const Ip6::MessageInfo &              aMessageInfo,
+                                        TimeMilli                             aRxTime,
+                                        const Crypto::Sha256::Hash &          aHash,
+                                        const Crypto::Ecdsa::P256::Signature &aSignature)
+{
+    static_assert(OT_CRYPTO_ECDSA_P256_PUBLIC_KEY_SIZE == Crypto::Ecdsa::P256::PublicKey::kSize,
+                  "public key size mismatch");
+    static_assert(OT_CRYPTO_ECDSA_P256_SIGNATURE_SIZE == Crypto::Ecdsa::P256::Signature::kSize,
+                  "signature size mismatch");
+
+    Error                error     = kErrorNone;
+    uint32_t             requestId = ++mVerificationRequestId;
+    PendingVerification *pending;
+
+    pending = PendingVerification::New(aDnsHeader, aHost, aMessageInfo, aRxTime, requestId);
+    VerifyOrExit(pending != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = otPlatEcdsaVerify(&GetInstance(), requestId, aHost.GetKey()->GetKey().GetBytes(), &aHash,
+                                            aSignature.GetBytes()));
+
+    mPendingVerifications.Push(*pending);
+    mVerificationCounters.mBacklog++;
+    mVerificationCounters.mMaxBacklog =
+        OT_MAX(mVerificationCounters.mMaxBacklog, mVerificationCounters.mBacklog);
+
+exit:
+    if (error != kErrorNone && pending != nullptr)
+    {
+        pending->Free();
+    }
+
+    return error;
+}
+
+void Server::HandlePlatformVerifyDone(uint32_t aRequestId, Error aError)
+{
+    PendingVerification *pending = mPendingVerifications.RemoveMatching(aRequestId);
+
+    // The request may have been dropped when the server stopped.
+    VerifyOrExit(pending != nullptr);
+
+    mVerificationCounters.mBacklog--;
+    mVerificationCounters.mOffloaded++;
+
+    HandleVerificationResult(aError, pending->GetDnsHeader(), pending->GetHost(), pending->GetMessageInfo(),
+                             pending->GetRxTime());
+    pending->Free();
+
+exit:
+    return;
+}
+
+bool Server::HasPendingVerification(const Ip6::MessageInfo &aMessageInfo, uint16_t aDnsMessageId) const
+{
+    bool found = false;
+
+    for (const PendingVerification *pending = mPendingVerifications.GetHead(); pending != nullptr;
+         pending                            = pending->GetNext())
+    {
+        if (aDnsMessageId == pending->GetDnsHeader().GetMessageId() &&
+            aMessageInfo.GetPeerAddr() == pending->GetMessageInfo().GetPeerAddr() &&
+            aMessageInfo.GetPeerPort() == pending->GetMessageInfo().GetPeerPort())
+        {
+            ExitNow(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+
+void Server::FreePendingVerifications(void)
+{
+    while (!mPendingVerifications.IsEmpty())
+    {
+        PendingVerification *pending = mPendingVerifications.Pop();
+
+        pending->GetHost().Free();
+        pending->Free();
+    }
+
+    mVerificationCounters.mBacklog = 0;
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
 void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, const Ip6::MessageInfo &aMessageInfo)
 {
     Error error = kErrorNone;
@@ -1441,6 +1639,9 @@ void Server::Host::Free(void)
 {
     FreeAllServices();
     mFullName.Free();
+#if OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE
+    mPreparedKey.Clear();
+#endif
     Instance::HeapFree(this);
 }
 
@@ -1634,7 +1835,62 @@ Server::UpdateMetadata::UpdateMetadata(Instance &               aInstance,
 {
 }
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
+Server::PendingVerification *Server::PendingVerification::New(const Dns::UpdateHeader &aHeader,
+                                                              Host &                   aHost,
+                                                              const Ip6::MessageInfo & aMessageInfo,
+                                                              TimeMilli                aRxTime,
+                                                              uint32_t                 aRequestId)
+{
+    void *               buf;
+    PendingVerification *pending = nullptr;
+
+    buf = Instance::HeapCAlloc(1, sizeof(PendingVerification));
+    VerifyOrExit(buf != nullptr);
+
+    pending = new (buf) PendingVerification(aHeader, aHost, aMessageInfo, aRxTime, aRequestId);
+
+exit:
+    return pending;
+}
+
+void Server::PendingVerification::Free(void)
+{
+    Instance::HeapFree(this);
+}
+
+Server::PendingVerification::PendingVerification(const Dns::UpdateHeader &aHeader,
+                                                 Host &                   aHost,
+                                                 const Ip6::MessageInfo & aMessageInfo,
+                                                 TimeMilli                aRxTime,
+                                                 uint32_t                 aRequestId)
+    : mDnsHeader(aHeader)
+    , mHost(&aHost)
+    , mMessageInfo(aMessageInfo)
+    , mRxTime(aRxTime)
+    , mRequestId(aRequestId)
+    , mNext(nullptr)
+{
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
 } // namespace Srp
 } // namespace ot
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+extern "C" void otPlatEcdsaVerifyDone(otInstance *aInstance, uint32_t aRequestId, otError aError)
+{
+    ot::Instance &instance = *static_cast<ot::Instance *>(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+
+    instance.Get<ot::Srp::Server>().HandlePlatformVerifyDone(aRequestId, aError);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
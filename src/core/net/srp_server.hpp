@@ -76,6 +76,8 @@ class Server : public InstanceLocator, private NonCopyable
     friend class Service;
     friend class Host;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged;
+
 public:
     enum : uint16_t
     {
@@ -402,6 +404,9 @@ public:
         uint32_t               mKeyLease; // The KEY-LEASE time in seconds.
         TimeMilli              mTimeLastUpdate;
         LinkedList<Service>    mServices;
+#if OPENTHREAD_CONFIG_SRP_SERVER_KEY_CACHE_ENABLE
+        Crypto::Ecdsa::P256::PreparedPublicKey mPreparedKey;
+#endif
     };
 
     /**
@@ -533,6 +538,33 @@ public:
      */
     void HandleServiceUpdateResult(ServiceUpdateId aId, Error aError);
 
+    /**
+     * This method returns the signature verification counters.
+     *
+     * @returns A reference to the signature verification counters.
+     *
+     */
+    const otSrpServerVerificationCounters &GetVerificationCounters(void) const { return mVerificationCounters; }
+
+    /**
+     * This method resets the signature verification counters.
+     *
+     * The current backlog is kept and becomes the new maximum backlog.
+     *
+     */
+    void ResetVerificationCounters(void);
+
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    /**
+     * This method handles the completion of a signature verification performed by the platform.
+     *
+     * @param[in]  aRequestId  The request identifier passed to `otPlatEcdsaVerify()`.
+     * @param[in]  aError      The verification result.
+     *
+     */
+    void HandlePlatformVerifyDone(uint32_t aRequestId, Error aError);
+#endif
+
 private:
     enum : uint16_t
     {
@@ -581,6 +613,41 @@ private:
         UpdateMetadata *  mNext;
     };
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    // This class holds a SRP update while its signature is verified by the platform.
+    class PendingVerification : public LinkedListEntry<PendingVerification>
+    {
+        friend class LinkedListEntry<PendingVerification>;
+
+    public:
+        static PendingVerification *New(const Dns::UpdateHeader &aHeader,
+                                        Host &                   aHost,
+                                        const Ip6::MessageInfo & aMessageInfo,
+                                        TimeMilli                aRxTime,
+                                        uint32_t                 aRequestId);
+        void                        Free(void);
+        const Dns::UpdateHeader &   GetDnsHeader(void) const { return mDnsHeader; }
+        Host &                      GetHost(void) { return *mHost; }
+        const Ip6::MessageInfo &    GetMessageInfo(void) const { return mMessageInfo; }
+        TimeMilli                   GetRxTime(void) const { return mRxTime; }
+        bool                        Matches(uint32_t aRequestId) const { return mRequestId == aRequestId; }
+
+    private:
+        PendingVerification(const Dns::UpdateHeader &aHeader,
+                            Host &                   aHost,
+                            const Ip6::MessageInfo & aMessageInfo,
+                            TimeMilli                aRxTime,
+                            uint32_t                 aRequestId);
+
+        Dns::UpdateHeader    mDnsHeader;
+        Host *               mHost; // The host owned by this entry until the verification completes.
+        Ip6::MessageInfo     mMessageInfo;
+        TimeMilli            mRxTime;
+        uint32_t             mRequestId;
+        PendingVerification *mNext;
+    };
+#endif
+
     void  Start(void);
     void  Stop(void);
     void  HandleNotifierEvents(Events aEvents);
@@ -602,17 +669,42 @@ private:
                                const Dns::UpdateHeader &aDnsHeader,
                                const Dns::Zone &        aZone,
                                uint16_t &               aOffset) const;
-    Error ProcessAdditionalSection(Host *                   aHost,
-                                   const Message &          aMessage,
+    Error ProcessAdditionalSection(Host *                          aHost,
+                                   const Message &                 aMessage,
+                                   const Dns::UpdateHeader &       aDnsHeader,
+                                   uint16_t &                      aOffset,
+                                   Crypto::Sha256::Hash &          aHash,
+                                   Crypto::Ecdsa::P256::Signature &aSignature) const;
+    Error ComputeSignedHash(const Message &       aMessage,
+                            Dns::UpdateHeader     aDnsHeader,
+                            uint16_t              aSigOffset,
+                            uint16_t              aSigRdataOffset,
+                            const char *          aSignerName,
+                            Crypto::Sha256::Hash &aHash) const;
+    void  VerifyAndHandleUpdate(const Dns::UpdateHeader &             aDnsHeader,
+                                Host &                                aHost,
+                                const Ip6::MessageInfo &              aMessageInfo,
+                                TimeMilli                             aRxTime,
+                                const Crypto::Sha256::Hash &          aHash,
+                                const Crypto::Ecdsa::P256::Signature &aSignature);
+    Error VerifySignature(Host &                                aHost,
+                          const Crypto::Sha256::Hash &          aHash,
+                          const Crypto::Ecdsa::P256::Signature &aSignature);
+    void  HandleVerificationResult(Error                    aError,
                                    const Dns::UpdateHeader &aDnsHeader,
-                                   uint16_t &               aOffset) const;
-    Error VerifySignature(const Dns::Ecdsa256KeyRecord &aKey,
-                          const Message &               aMessage,
-                          Dns::UpdateHeader             aDnsHeader,
-                          uint16_t                      aSigOffset,
-                          uint16_t                      aSigRdataOffset,
-                          uint16_t                      aSigRdataLength,
-                          const char *                  aSignerName) const;
+                                   Host &                   aHost,
+                                   const Ip6::MessageInfo & aMessageInfo,
+                                   TimeMilli                aRxTime);
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    Error StartPlatformVerification(const Dns::UpdateHeader &             aDnsHeader,
+                                    Host &                                aHost,
+                                    const Ip6::MessageInfo &              aMessageInfo,
+                                    TimeMilli                             aRxTime,
+                                    const Crypto::Sha256::Hash &          aHash,
+                                    const Crypto::Ecdsa::P256::Signature &aSignature);
+    void  FreePendingVerifications(void);
+    bool  HasPendingVerification(const Ip6::MessageInfo &aMessageInfo, uint16_t aDnsMessageId) const;
+#endif
     Error ProcessZoneSection(const Message &          aMessage,
                              const Dns::UpdateHeader &aDnsHeader,
                              uint16_t &               aOffset,
@@ -671,6 +763,12 @@ private:
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+    LinkedList<PendingVerification> mPendingVerifications;
+    uint32_t                        mVerificationRequestId;
+#endif
+    otSrpServerVerificationCounters mVerificationCounters;
+
     ServiceUpdateId mServiceUpdateId;
     bool            mEnabled : 1;
     bool            mHasRegisteredAnyService : 1;
@@ -74,6 +74,7 @@
 #include "config/logging.h"
 #include "config/mac.h"
 #include "config/mle.h"
+#include "config/packet_trace.h"
 #include "config/parent_search.h"
 #include "config/ping_sender.h"
 #include "config/platform.h"
@@ -166,6 +166,18 @@ public:
          */
         void HandleEnergyScanDone(int8_t aMaxRssi);
 
+        /**
+         * This callback method handles "Multi-channel Energy Scan Done" event from radio platform.
+         *
+         * This method is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability. It is called from
+         * `otPlatRadioMultiChannelEnergyScanDone()`.
+         *
+         * @param[in]  aResults     A pointer to an array with the results of the scanned channels.
+         * @param[in]  aNumResults  The number of entries in @p aResults.
+         *
+         */
+        void HandleMultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults);
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
         /**
          * This callback method handles a "Receive Done" event from radio platform when diagnostics mode is enabled.
@@ -507,6 +519,20 @@ public:
      */
     Error EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration);
 
+    /**
+     * This method begins the energy scan sequence of multiple channels on the radio.
+     *
+     * This function is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability.
+     *
+     * @param[in] aScanChannels  A bit-vector indicating the channels to perform the energy scan on.
+     * @param[in] aScanDuration  The duration, in milliseconds, for each channel to be scanned.
+     *
+     * @retval kErrorNone            Successfully started scanning the channels.
+     * @retval kErrorNotImplemented  The radio doesn't support multi-channel energy scanning.
+     *
+     */
+    Error MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration);
+
     /**
      * This method enables/disables source address match feature.
      *
@@ -797,6 +823,11 @@ inline Error Radio::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
     return otPlatRadioEnergyScan(GetInstancePtr(), aScanChannel, aScanDuration);
 }
 
+inline Error Radio::MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration)
+{
+    return otPlatRadioMultiChannelEnergyScan(GetInstancePtr(), aScanChannels, aScanDuration);
+}
+
 inline void Radio::EnableSrcMatch(bool aEnable)
 {
     otPlatRadioEnableSrcMatch(GetInstancePtr(), aEnable);
@@ -960,6 +991,11 @@ inline Error Radio::EnergyScan(uint8_t, uint16_t)
     return kErrorNotImplemented;
 }
 
+inline Error Radio::MultiChannelEnergyScan(uint32_t, uint16_t)
+{
+    return kErrorNotImplemented;
+}
+
 inline void Radio::EnableSrcMatch(bool)
 {
 }
@@ -58,6 +58,11 @@ void Radio::Callbacks::HandleEnergyScanDone(int8_t aMaxRssi)
     Get<Mac::SubMac>().HandleEnergyScanDone(aMaxRssi);
 }
 
+void Radio::Callbacks::HandleMultiChannelEnergyScanDone(const otEnergyScanResult *aResults, uint8_t aNumResults)
+{
+    Get<Mac::SubMac>().HandleMultiChannelEnergyScanDone(aResults, aNumResults);
+}
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 void Radio::Callbacks::HandleDiagsReceiveDone(Mac::RxFrame *aFrame, Error aError)
 {
@@ -115,6 +115,19 @@ exit:
     return;
 }
 
+extern "C" void otPlatRadioMultiChannelEnergyScanDone(otInstance *              aInstance,
+                                                      const otEnergyScanResult *aResults,
+                                                      uint8_t                   aNumResults)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+    instance.Get<Radio::Callbacks>().HandleMultiChannelEnergyScanDone(aResults, aNumResults);
+
+exit:
+    return;
+}
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 extern "C" void otPlatDiagRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, Error aError)
 {
@@ -162,6 +175,10 @@ extern "C" void otPlatRadioEnergyScanDone(otInstance *, int8_t)
 {
 }
 
+extern "C" void otPlatRadioMultiChannelEnergyScanDone(otInstance *, const otEnergyScanResult *, uint8_t)
+{
+}
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 extern "C" void otPlatDiagRadioReceiveDone(otInstance *, otRadioFrame *, Error)
 {
@@ -290,6 +307,17 @@ OT_TOOL_WEAK Error otPlatRadioGetRegion(otInstance *aInstance, uint16_t *aRegion
     return kErrorNotImplemented;
 }
 
+OT_TOOL_WEAK Error otPlatRadioMultiChannelEnergyScan(otInstance *aInstance,
+                                                     uint32_t    aScanChannels,
+                                                     uint16_t    aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannels);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return kErrorNotImplemented;
+}
+
 OT_TOOL_WEAK Error otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel, uint32_t aStart, uint32_t aDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -186,6 +186,10 @@ void Link::BeginTransmit(void)
     txPacket.GetHeader().SetPanId(destPanId);
     txPacket.GetHeader().SetSource(Get<Mac::Mac>().GetExtAddress());
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    txPacket.GetHeader().SetLargeFrameSupported();
+#endif
+
     if (type == Header::kTypeUnicast)
     {
         OT_ASSERT(destAddr.IsExtended());
@@ -338,6 +342,10 @@ void Link::ProcessReceivedPacket(Packet &aPacket)
     {
         VerifyOrExit(aPacket.GetHeader().GetDestination() == Get<Mac::Mac>().GetExtAddress());
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+        UpdateLargeFrameSupport(aPacket.GetHeader());
+#endif
+
         if (type == Header::kTypeAck)
         {
             HandleAck(aPacket);
@@ -370,6 +378,50 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+
+uint16_t Link::GetTxMtu(const Mac::Address &aMacDest)
+{
+    uint16_t        mtu = kMtuSize;
+    const Neighbor *neighbor;
+
+    VerifyOrExit(!aMacDest.IsNone() && !aMacDest.IsBroadcast());
+
+    neighbor = Get<NeighborTable>().FindNeighbor(aMacDest, Neighbor::kInStateAnyExceptInvalid);
+    VerifyOrExit((neighbor != nullptr) && neighbor->IsTrelLargeFrameSupported());
+
+    mtu = kLargeMtuSize;
+
+exit:
+    return mtu;
+}
+
+void Link::UpdateLargeFrameSupport(const Header &aHeader)
+{
+    // Large frame support is learned from unicast and ack packets
+    // received from a neighbor. Broadcast packets are not used
+    // since their sender is not necessarily a neighbor yet.
+
+    Mac::Address srcAddress;
+    Neighbor *   neighbor;
+
+    srcAddress.SetExtended(aHeader.GetSource());
+    neighbor = Get<NeighborTable>().FindNeighbor(srcAddress, Neighbor::kInStateAnyExceptInvalid);
+    VerifyOrExit(neighbor != nullptr);
+
+    if (neighbor->mTrelLargeFrameSupported != aHeader.IsLargeFrameSupported())
+    {
+        neighbor->mTrelLargeFrameSupported = aHeader.IsLargeFrameSupported();
+        otLogInfoMac("Trel: Large frame support for %s: %s", srcAddress.ToString().AsCString(),
+                     neighbor->mTrelLargeFrameSupported ? "yes" : "no");
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+
 void Link::HandleAck(Packet &aAckPacket)
 {
     Error        ackError;
@@ -423,6 +475,10 @@ void Link::SendAck(Packet &aRxPacket)
     ackPacket.GetHeader().SetSource(Get<Mac::Mac>().GetExtAddress());
     ackPacket.GetHeader().SetDestination(aRxPacket.GetHeader().GetSource());
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    ackPacket.GetHeader().SetLargeFrameSupported();
+#endif
+
     otLogDebgMac("Trel: SendAck [%s]", ackPacket.GetHeader().ToString().AsCString());
 
     IgnoreError(mInterface.Send(ackPacket));
@@ -75,8 +75,9 @@ class Link : public InstanceLocator
 public:
     enum
     {
-        kMtuSize = 1280 - 48 - sizeof(Header), ///< MTU size for TREL frame.
-        kFcsSize = 0,                          ///< FCS size for TREL frame.
+        kMtuSize      = 1280 - 48 - sizeof(Header), ///< MTU size for TREL frame.
+        kLargeMtuSize = 1500 - 48 - sizeof(Header), ///< MTU size for large TREL frame.
+        kFcsSize      = 0,                          ///< FCS size for TREL frame.
     };
 
     /**
@@ -149,10 +150,30 @@ public:
      */
     void Send(void);
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    /**
+     * This method gets the MTU size to use for a TREL frame sent to a given MAC destination.
+     *
+     * The large MTU size is used only for a unicast frame to a neighbor which has indicated that it supports large
+     * frames, otherwise the default MTU size is used.
+     *
+     * @param[in] aMacDest  The MAC destination address.
+     *
+     * @returns The MTU size (number of bytes) to use for the frame.
+     *
+     */
+    uint16_t GetTxMtu(const Mac::Address &aMacDest);
+#endif
+
 private:
     enum
     {
         kMaxHeaderSize   = sizeof(Header),
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+        kMaxMtuSize      = kLargeMtuSize,
+#else
+        kMaxMtuSize      = kMtuSize,
+#endif
         k154AckFrameSize = 3 + kFcsSize,
         kRxRssi          = -20, // The RSSI value used for received frames on TREL radio link.
         kAckWaitWindow   = 750, // (in msec)
@@ -172,6 +193,9 @@ private:
     void InvokeSendDone(Error aError) { InvokeSendDone(aError, nullptr); }
     void InvokeSendDone(Error aError, Mac::RxFrame *aAckFrame);
     void ProcessReceivedPacket(Packet &aPacket);
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    void UpdateLargeFrameSupport(const Header &aHeader);
+#endif
     void HandleAck(Packet &aAckPacket);
     void SendAck(Packet &aRxPacket);
     void ReportDeferredAckStatus(Neighbor &aNeighbor, Error aError);
@@ -194,7 +218,7 @@ private:
     Interface    mInterface;
     Mac::RxFrame mRxFrame;
     Mac::TxFrame mTxFrame;
-    uint8_t      mTxPacketBuffer[kMaxHeaderSize + kMtuSize];
+    uint8_t      mTxPacketBuffer[kMaxHeaderSize + kMaxMtuSize];
     uint8_t      mAckPacketBuffer[kMaxHeaderSize];
     uint8_t      mAckFrameBuffer[k154AckFrameSize];
 };
@@ -209,6 +233,18 @@ class NeighborInfo
 {
     friend class Link;
 
+public:
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    /**
+     * This method indicates whether the neighbor supports large TREL frames.
+     *
+     * @retval TRUE   The neighbor indicated that it supports large TREL frames.
+     * @retval FALSE  The neighbor did not indicate support for large TREL frames.
+     *
+     */
+    bool IsTrelLargeFrameSupported(void) const { return mTrelLargeFrameSupported; }
+#endif
+
 private:
     uint32_t GetPendingTrelAckCount(void) const { return (mTrelPreviousPendingAcks + mTrelCurrentPendingAcks); }
 
@@ -238,6 +274,9 @@ private:
     uint32_t mTrelTxPacketNumber;      // Next packet number to use for tx
     uint16_t mTrelCurrentPendingAcks;  // Number of pending acks for current interval.
     uint16_t mTrelPreviousPendingAcks; // Number of pending acks for previous interval.
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    bool mTrelLargeFrameSupported; // Whether neighbor supports large TREL frames.
+#endif
 };
 
 /**
@@ -107,6 +107,11 @@ Header::InfoString Header::ToString(void) const
         string.Append(GetAckMode() == kNoAck ? " no-ack" : " ack-req");
     }
 
+    if (IsLargeFrameSupported())
+    {
+        string.Append(" large");
+    }
+
     return string;
 }
 
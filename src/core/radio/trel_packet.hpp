@@ -134,6 +134,23 @@ public:
      */
     void SetAckMode(AckMode aAckMode);
 
+    /**
+     * This method indicates whether the Large Frame flag is set in the header.
+     *
+     * The Large Frame flag indicates that the sender can receive TREL frames up to the large MTU size.
+     *
+     * @retval TRUE   The Large Frame flag is set.
+     * @retval FALSE  The Large Frame flag is not set.
+     *
+     */
+    bool IsLargeFrameSupported(void) const { return (mControl & kLargeFrameFlag) != 0; }
+
+    /**
+     * This method sets the Large Frame flag in the header.
+     *
+     */
+    void SetLargeFrameSupported(void) { mControl |= kLargeFrameFlag; }
+
     /**
      * This method gets the channel field from the header.
      *
@@ -239,10 +256,11 @@ public:
 private:
     enum
     {
-        kTypeMask    = (3 << 0), // Bits 0-1 specify packet `Type`
-        kAckModeFlag = (1 << 2), // Bit 2 indicate "ack mode" (TREL ack requested or not).
-        kVersionMask = (7 << 5), // Bits 5-7 specify the version.
-        kVersion     = (0 << 5), // Current TREL header version.
+        kTypeMask       = (3 << 0), // Bits 0-1 specify packet `Type`
+        kAckModeFlag    = (1 << 2), // Bit 2 indicate "ack mode" (TREL ack requested or not).
+        kLargeFrameFlag = (1 << 3), // Bit 3 indicates sender supports large frames.
+        kVersionMask    = (7 << 5), // Bits 5-7 specify the version.
+        kVersion        = (0 << 5), // Current TREL header version.
     };
 
     // All header fields are big-endian.
@@ -210,6 +210,9 @@ class AnnounceSender : public AnnounceSenderBase
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventActiveDatasetChanged | kEventThreadChannelChanged;
+
 public:
     /**
      * This constructor initializes the object.
@@ -78,8 +78,10 @@ void CslTxScheduler::InitFrameRequestAhead(void)
     mCslFrameRequestAheadUs = OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US + busTxTimeUs;
 }
 
-void CslTxScheduler::Update(void)
+void CslTxScheduler::Update(Child &aChild)
 {
+    ScheduleChild(aChild);
+
     if (mCslTxMessage == nullptr)
     {
         RescheduleCslTx();
@@ -106,11 +108,32 @@ void CslTxScheduler::Clear(void)
         child.SetCslLastHeard(TimeMilli(0));
     }
 
+    mCslTxHeap.Clear();
+
     mFrameContext.mMessageNextOffset = 0;
     mCslTxChild                      = nullptr;
     mCslTxMessage                    = nullptr;
 }
 
+bool CslTxScheduler::IsCslTxPending(const Child &aChild)
+{
+    return !aChild.IsStateInvalid() && aChild.IsCslSynchronized() && (aChild.GetIndirectMessageCount() > 0);
+}
+
+void CslTxScheduler::ScheduleChild(Child &aChild)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    if (IsCslTxPending(aChild))
+    {
+        mCslTxHeap.Update(childIndex, GetNextCslTxWindow(aChild, otPlatRadioGetNow(&GetInstance())));
+    }
+    else
+    {
+        mCslTxHeap.Remove(childIndex);
+    }
+}
+
 /**
  * This method always finds the most recent CSL tx among all children,
  * and requests `Mac` to do CSL tx at specific time. It shouldn't be called
@@ -119,44 +142,55 @@ void CslTxScheduler::Clear(void)
  */
 void CslTxScheduler::RescheduleCslTx(void)
 {
-    uint32_t minDelayTime = Time::kMaxDuration;
-    Child *  bestChild    = nullptr;
+    uint64_t radioNow  = otPlatRadioGetNow(&GetInstance());
+    Child *  bestChild = nullptr;
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    while (!mCslTxHeap.IsEmpty())
     {
-        uint32_t delay;
-        uint32_t cslTxDelay;
+        uint16_t childIndex = mCslTxHeap.GetTop();
+        Child &  child      = *Get<ChildTable>().GetChildAtIndex(childIndex);
 
-        if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
+        if (!IsCslTxPending(child))
         {
+            mCslTxHeap.Remove(childIndex);
             continue;
         }
 
-        delay = GetNextCslTransmissionDelay(child, cslTxDelay);
-
-        if (delay < minDelayTime)
+        if (mCslTxHeap.GetKey(childIndex) >= radioNow + mCslFrameRequestAheadUs)
         {
-            minDelayTime = delay;
-            bestChild    = &child;
+            bestChild = &child;
+            break;
         }
+
+        mCslTxHeap.Update(childIndex, GetNextCslTxWindow(child, radioNow));
     }
 
     if (bestChild != nullptr)
     {
-        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
+        uint64_t txWindow = mCslTxHeap.GetKey(Get<ChildTable>().GetChildIndex(*bestChild));
+
+        Get<Mac::Mac>().RequestCslFrameTransmission(
+            static_cast<uint32_t>(txWindow - radioNow - mCslFrameRequestAheadUs) / 1000UL);
     }
 
     mCslTxChild = bestChild;
 }
 
-uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
+uint64_t CslTxScheduler::GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const
 {
-    uint64_t radioNow      = otPlatRadioGetNow(&GetInstance());
     uint32_t periodInUs    = aChild.GetCslPeriod() * kUsPerTenSymbols;
     uint64_t firstTxWindow = aChild.GetLastRxTimestamp() + aChild.GetCslPhase() * kUsPerTenSymbols;
-    uint64_t nextTxWindow  = radioNow - (radioNow % periodInUs) + (firstTxWindow % periodInUs);
+    uint64_t nextTxWindow  = aRadioNow - (aRadioNow % periodInUs) + (firstTxWindow % periodInUs);
+
+    while (nextTxWindow < aRadioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
+
+    return nextTxWindow;
+}
 
-    while (nextTxWindow < radioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
+uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
+{
+    uint64_t radioNow     = otPlatRadioGetNow(&GetInstance());
+    uint64_t nextTxWindow = GetNextCslTxWindow(aChild, radioNow);
 
     aDelayFromLastRx = static_cast<uint32_t>(nextTxWindow - aChild.GetLastRxTimestamp());
 
@@ -33,6 +33,7 @@
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
 
+#include "common/indexed_min_heap.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
@@ -174,14 +175,18 @@ public:
     explicit CslTxScheduler(Instance &aInstance);
 
     /**
-     * This method updates the next CSL transmission (finds the nearest child).
+     * This method updates the next CSL transmission after a change of the CSL state or of the indirect message of a
+     * child.
      *
-     * It would then request the `Mac` to do the CSL tx. If the last CSL tx has been fired at `Mac` but hasn't been
-     * done yet, and it's aborted, this method would set `mCslTxChild` to `nullptr` to notify the `HandleTransmitDone`
-     * that the operation has been aborted.
+     * The child is (re-)scheduled at its next CSL transmission window if it is CSL synchronized and has an indirect
+     * message, and the nearest child is then found. It would then request the `Mac` to do the CSL tx. If the last CSL
+     * tx has been fired at `Mac` but hasn't been done yet, and it's aborted, this method would set `mCslTxChild` to
+     * `nullptr` to notify the `HandleTransmitDone` that the operation has been aborted.
+     *
+     * @param[in]  aChild  The child whose CSL state or indirect message changed.
      *
      */
-    void Update(void);
+    void Update(Child &aChild);
 
     /**
      * This method clears all the states inside `CslTxScheduler` and the related states in each child.
@@ -190,10 +195,18 @@ public:
     void Clear(void);
 
 private:
+    enum : uint16_t
+    {
+        kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    };
+
     void InitFrameRequestAhead(void);
     void RescheduleCslTx(void);
+    void ScheduleChild(Child &aChild);
 
-    uint32_t GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const;
+    static bool IsCslTxPending(const Child &aChild);
+    uint64_t    GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const;
+    uint32_t    GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const;
 
     // Callbacks from `Mac`
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
@@ -201,6 +214,15 @@ private:
 
     void HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, Child &aChild);
 
+    // Children with a pending CSL tx (indexed by child table index),
+    // keyed by their next CSL tx window (radio time in microseconds).
+    // A child which is no longer pending is removed lazily when it
+    // reaches the top. A window which has already passed is moved to
+    // the next one only when it reaches the top: the keys below the
+    // top can not be earlier than the top key.
+
+    IndexedMinHeap<uint64_t, kMaxChildren> mCslTxHeap;
+
     uint32_t                mCslFrameRequestAheadUs;
     Child *                 mCslTxChild;
     Message *               mCslTxMessage;
@@ -81,6 +81,8 @@ class DuaManager : public InstanceLocator, private NonCopyable
     friend class ot::Notifier;
     friend class ot::TimeTicker;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventIp6AddressAdded;
+
 public:
     /**
      * This constructor initializes the object.
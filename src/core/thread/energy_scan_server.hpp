@@ -55,6 +55,8 @@ class EnergyScanServer : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
 public:
     /**
      * This constructor initializes the object.
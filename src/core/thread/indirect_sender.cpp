@@ -43,6 +43,7 @@
 #include "thread/mesh_forwarder.hpp"
 #include "thread/mle_tlvs.hpp"
 #include "thread/topology.hpp"
+#include "utils/packet_trace.hpp"
 
 namespace ot {
 
@@ -101,6 +102,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    OT_PACKET_TRACE(kIndirectHold, &aMessage, aChild.GetIndirectMessageCount());
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -137,18 +139,21 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
-    Message *message;
-    Message *nextMessage;
+    PriorityQueue *queues[] = {&Get<MeshForwarder>().mSendQueue, &Get<MeshForwarder>().mIndirectSendQueue};
+    Message *      nextMessage;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    for (PriorityQueue *queue : queues)
     {
-        nextMessage = message->GetNext();
+        for (Message *message = queue->GetHead(); message; message = nextMessage)
+        {
+            nextMessage = message->GetNext();
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+            message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+        }
     }
 
     aChild.SetIndirectMessage(nullptr);
@@ -156,7 +161,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -186,13 +191,25 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        Message *nextMessage;
 
         for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
         {
+            message->ClearChildMask(childIndex);
+        }
+
+        // Indirect-only messages for the child now need direct
+        // transmission, so they move to the send queue.
+
+        for (Message *message = Get<MeshForwarder>().mIndirectSendQueue.GetHead(); message; message = nextMessage)
+        {
+            nextMessage = message->GetNext();
+
             if (message->GetChildMask(childIndex))
             {
                 message->ClearChildMask(childIndex);
                 message->SetDirectTransmission();
+                Get<MeshForwarder>().UpdateSendQueue(*message);
             }
         }
 
@@ -201,7 +218,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
     }
 
@@ -215,18 +232,39 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
-    Message *message;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    // Messages for sleepy children are in the indirect send queue,
+    // or still in the send queue if their direct transmission is
+    // pending. Both queues are searched from the highest priority
+    // level so that the message order follows the priorities.
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+    const PriorityQueue *queues[]   = {&Get<MeshForwarder>().mIndirectSendQueue, &Get<MeshForwarder>().mSendQueue};
+    Message *            message    = nullptr;
+    uint16_t             childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    for (uint8_t priority = Message::kNumPriorities; priority > 0; priority--)
     {
-        if (message->GetChildMask(childIndex) &&
-            (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
+        for (const PriorityQueue *queue : queues)
         {
-            break;
+            for (message = queue->GetHeadForPriority(static_cast<Message::Priority>(priority - 1)); message;
+                 message = message->GetNext())
+            {
+                if (message->GetPriority() != priority - 1)
+                {
+                    break;
+                }
+
+                if (message->GetChildMask(childIndex) &&
+                    (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
+                {
+                    ExitNow();
+                }
+            }
         }
     }
 
+    message = nullptr;
+
+exit:
     return message;
 }
 
@@ -256,7 +294,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
         aChild.SetWaitingForMessageUpdate(true);
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
 
         ExitNow();
@@ -288,7 +326,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
     aChild.SetWaitingForMessageUpdate(true);
     mDataPollHandler.RequestFrameChange(DataPollHandler::kReplaceFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -314,7 +352,7 @@ void IndirectSender::UpdateIndirectMessage(Child &aChild)
     aChild.SetIndirectTxSuccess(true);
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
     if (message != nullptr)
@@ -421,6 +459,8 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
     Message *message    = aChild.GetIndirectMessage();
     uint16_t nextOffset = aContext.mMessageNextOffset;
 
+    OT_PACKET_TRACE(kTxDone, message, aChild.GetIndirectMessageCount());
+
     VerifyOrExit(mEnabled);
 
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
@@ -477,7 +517,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         aChild.SetIndirectFragmentOffset(nextOffset);
         mDataPollHandler.HandleNewFrame(aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
         ExitNow();
     }
@@ -51,6 +51,7 @@
 #include "thread/mle.hpp"
 #include "thread/mle_router.hpp"
 #include "thread/thread_netif.hpp"
+#include "utils/packet_trace.hpp"
 
 namespace ot {
 
@@ -89,6 +90,7 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mEnabled(false)
     , mTxPaused(false)
     , mSendBusy(false)
+    , mTxPipelineCount(0)
     , mScheduleTransmissionTask(aInstance, MeshForwarder::ScheduleTransmissionTask)
 #if OPENTHREAD_FTD
     , mIndirectSender(aInstance)
@@ -102,6 +104,10 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
 #endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    mLowpanHeaderCache.Clear();
+#endif
 }
 
 void MeshForwarder::Start(void)
@@ -130,8 +136,18 @@ void MeshForwarder::Stop(void)
     while ((message = mSendQueue.GetHead()) != nullptr)
     {
         mSendQueue.Dequeue(*message);
+        OT_PACKET_TRACE(kDrop, message, mSendQueue.GetNumMessages());
+        message->Free();
+    }
+
+#if OPENTHREAD_FTD
+    while ((message = mIndirectSendQueue.GetHead()) != nullptr)
+    {
+        mIndirectSendQueue.Dequeue(*message);
+        OT_PACKET_TRACE(kDrop, message, mIndirectSendQueue.GetNumMessages());
         message->Free();
     }
+#endif
 
     while ((message = mReassemblyList.GetHead()) != nullptr)
     {
@@ -144,6 +160,10 @@ void MeshForwarder::Stop(void)
     mFragmentPriorityList.Clear();
 #endif
 
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    mLowpanHeaderCache.Clear();
+#endif
+
     mEnabled     = false;
     mSendMessage = nullptr;
     Get<Mac::Mac>().SetRxOnWhenIdle(false);
@@ -208,7 +228,11 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
 
     OT_ASSERT(queue != nullptr);
 
+#if OPENTHREAD_FTD
+    if ((queue == &mSendQueue) || (queue == &mIndirectSendQueue))
+#else
     if (queue == &mSendQueue)
+#endif
     {
 #if OPENTHREAD_FTD
         for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
@@ -224,6 +248,7 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
     }
 
     queue->Dequeue(aMessage);
+    OT_PACKET_TRACE(kDrop, &aMessage, queue->GetNumMessages());
     LogMessage(kMessageEvict, aMessage, nullptr, kErrorNoBufs);
     aMessage.Free();
 }
@@ -243,6 +268,33 @@ void MeshForwarder::ScheduleTransmissionTask(Tasklet &aTasklet)
 }
 
 void MeshForwarder::ScheduleTransmissionTask(void)
+{
+    mTxPipelineCount = 0;
+    StartDirectTransmission();
+}
+
+void MeshForwarder::ScheduleNextTransmission(void)
+{
+    // This is called from the transmit done callback of a direct
+    // frame. When the pipeline depth allows, the next direct
+    // transmission is requested right away so that `Mac` starts
+    // it as soon as the callback returns, without an idle radio
+    // transition in between. Otherwise it is left to the tasklet.
+
+#if OPENTHREAD_CONFIG_MAC_TX_PIPELINE_DEPTH > 0
+    if (mTxPipelineCount < OPENTHREAD_CONFIG_MAC_TX_PIPELINE_DEPTH)
+    {
+        mTxPipelineCount++;
+        StartDirectTransmission();
+    }
+    else
+#endif
+    {
+        mScheduleTransmissionTask.Post();
+    }
+}
+
+void MeshForwarder::StartDirectTransmission(void)
 {
     VerifyOrExit(!mSendBusy && !mTxPaused);
 
@@ -265,13 +317,14 @@ Message *MeshForwarder::GetDirectTransmission(void)
     Message *curMessage, *nextMessage;
     Error    error = kErrorNone;
 
+    // All messages in the send queue have a pending direct
+    // transmission (indirect-only messages are kept in the
+    // indirect send queue), so the head is the next message
+    // to send unless it fails to route.
+
     for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
     {
-        if (!curMessage->GetDirectTransmission())
-        {
-            nextMessage = curMessage->GetNext();
-            continue;
-        }
+        OT_ASSERT(curMessage->GetDirectTransmission());
 
         curMessage->SetDoNotEvict(true);
 
@@ -308,6 +361,7 @@ Message *MeshForwarder::GetDirectTransmission(void)
         switch (error)
         {
         case kErrorNone:
+            OT_PACKET_TRACE(kRoute, curMessage, mSendQueue.GetNumMessages());
             ExitNow();
 
 #if OPENTHREAD_FTD
@@ -315,12 +369,14 @@ Message *MeshForwarder::GetDirectTransmission(void)
         case kErrorAddressQuery:
             mSendQueue.Dequeue(*curMessage);
             mResolvingQueue.Enqueue(*curMessage);
+            OT_PACKET_TRACE(kAddressQuery, curMessage, mResolvingQueue.GetNumMessages());
             continue;
 
 #endif
 
         default:
             mSendQueue.Dequeue(*curMessage);
+            OT_PACKET_TRACE(kDrop, curMessage, mSendQueue.GetNumMessages());
             LogMessage(kMessageDrop, *curMessage, nullptr, error);
             curMessage->Free();
             continue;
@@ -547,6 +603,7 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     case Message::kType6lowpan:
         SendMesh(*mSendMessage, *frame);
+        OT_PACKET_TRACE(kFrame, mSendMessage, mSendQueue.GetNumMessages());
         break;
 
     case Message::kTypeSupervision:
@@ -715,6 +772,16 @@ start:
     payload          = aFrame.GetPayload();
     maxPayloadLength = aFrame.GetMaxPayloadLength();
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE && OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    if (&aFrame == &Get<Trel::Link>().GetTransmitFrame())
+    {
+        // A unicast frame to a neighbor supporting large TREL frames
+        // can carry a larger payload than the default TREL MTU.
+
+        maxPayloadLength += Get<Trel::Link>().GetTxMtu(aMacDest) - aFrame.GetMtu();
+    }
+#endif
+
     headerLength = 0;
 
 #if OPENTHREAD_FTD
@@ -803,7 +870,7 @@ start:
             meshDest   = aMacDest;
         }
 
-        error = Get<Lowpan::Lowpan>().Compress(aMessage, meshSource, meshDest, buffer);
+        error = CompressIp6Header(aMessage, meshSource, meshDest, buffer);
         OT_ASSERT(error == kErrorNone);
 
         hcLength = static_cast<uint8_t>(buffer.GetWritePointer() - payload);
@@ -839,6 +906,7 @@ start:
 
             fragmentHeader.InitFirstFragment(aMessage.GetLength(), static_cast<uint16_t>(aMessage.GetDatagramTag()));
             fragmentHeader.WriteTo(payload);
+            OT_PACKET_TRACE(kFragment, &aMessage, mSendQueue.GetNumMessages());
 
             payload += Lowpan::FragmentHeader::kFirstFragmentHeaderSize;
             headerLength += Lowpan::FragmentHeader::kFirstFragmentHeaderSize;
@@ -871,6 +939,7 @@ start:
         fragmentHeader.Init(aMessage.GetLength(), static_cast<uint16_t>(aMessage.GetDatagramTag()),
                             aMessage.GetOffset());
         fragmentHeaderLength = fragmentHeader.WriteTo(payload);
+        OT_PACKET_TRACE(kFragment, &aMessage, mSendQueue.GetNumMessages());
 
         payload += fragmentHeaderLength;
         headerLength += fragmentHeaderLength;
@@ -897,9 +966,135 @@ start:
 #endif
     }
 
+    OT_PACKET_TRACE(kFrame, &aMessage, mSendQueue.GetNumMessages());
+
     return nextOffset;
 }
 
+Error MeshForwarder::CompressIp6Header(Message &             aMessage,
+                                       const Mac::Address &  aMacSource,
+                                       const Mac::Address &  aMacDest,
+                                       Lowpan::BufferWriter &aBuffer)
+{
+    Error error;
+
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    // A retransmission of the same message (e.g., data poll triggered
+    // tx to a sleepy child, or the retry with link security enabled in
+    // `PrepareDataFrame()`) reuses the previously compressed header,
+    // skipping the header parsing and the context lookups.
+
+    uint32_t                        partitionId    = Get<Mle::Mle>().GetLeaderData().GetPartitionId();
+    uint8_t                         netDataVersion = Get<NetworkData::Leader>().GetVersion();
+    uint8_t *                       header         = aBuffer.GetWritePointer();
+    uint16_t                        startOffset    = aMessage.GetOffset();
+    const LowpanHeaderCache::Entry *entry;
+
+    entry = mLowpanHeaderCache.FindEntry(aMessage, aMacSource, aMacDest, partitionId, netDataVersion);
+
+    if (entry != nullptr)
+    {
+        SuccessOrExit(error = aBuffer.Write(entry->GetHeader(), entry->GetHeaderLength()));
+        aMessage.MoveOffset(entry->GetIp6HeaderLength());
+        ExitNow();
+    }
+#endif
+
+    SuccessOrExit(error = Get<Lowpan::Lowpan>().Compress(aMessage, aMacSource, aMacDest, aBuffer));
+
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    mLowpanHeaderCache.AddEntry(aMessage, aMacSource, aMacDest, partitionId, netDataVersion, header,
+                                static_cast<uint8_t>(aBuffer.GetWritePointer() - header),
+                                aMessage.GetOffset() - startOffset);
+#endif
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+
+bool MeshForwarder::LowpanHeaderCache::Entry::Matches(const Message &     aMessage,
+                                                      const Mac::Address &aSource,
+                                                      const Mac::Address &aDest,
+                                                      uint32_t            aPartitionId,
+                                                      uint8_t             aNetDataVersion) const
+{
+    // A message is allocated with a zero cache id, so an entry left
+    // over from a freed message never matches a new message reusing
+    // the same buffer.
+
+    return (mMessage == &aMessage) && (mMessageId != 0) && (mMessageId == aMessage.GetLowpanCacheId()) &&
+           (mPartitionId == aPartitionId) && (mNetDataVersion == aNetDataVersion) && (mSource == aSource) &&
+           (mDest == aDest);
+}
+
+const MeshForwarder::LowpanHeaderCache::Entry *MeshForwarder::LowpanHeaderCache::FindEntry(
+    const Message &     aMessage,
+    const Mac::Address &aSource,
+    const Mac::Address &aDest,
+    uint32_t            aPartitionId,
+    uint8_t             aNetDataVersion) const
+{
+    const Entry *rval = nullptr;
+
+    VerifyOrExit(aMessage.GetLowpanCacheId() != 0);
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.Matches(aMessage, aSource, aDest, aPartitionId, aNetDataVersion))
+        {
+            rval = &entry;
+            break;
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void MeshForwarder::LowpanHeaderCache::AddEntry(Message &           aMessage,
+                                                const Mac::Address &aSource,
+                                                const Mac::Address &aDest,
+                                                uint32_t            aPartitionId,
+                                                uint8_t             aNetDataVersion,
+                                                const uint8_t *     aHeader,
+                                                uint8_t             aHeaderLength,
+                                                uint16_t            aIp6HeaderLength)
+{
+    Entry &entry = mEntries[mNextEntry];
+
+    VerifyOrExit(aHeaderLength <= sizeof(entry.mHeader));
+
+    if (aMessage.GetLowpanCacheId() == 0)
+    {
+        if (++mNextMessageId == 0)
+        {
+            mNextMessageId++;
+        }
+
+        aMessage.SetLowpanCacheId(mNextMessageId);
+    }
+
+    // Entries are replaced in round-robin order.
+    mNextEntry = (mNextEntry + 1) % kNumEntries;
+
+    entry.mMessage         = &aMessage;
+    entry.mMessageId       = aMessage.GetLowpanCacheId();
+    entry.mPartitionId     = aPartitionId;
+    entry.mNetDataVersion  = aNetDataVersion;
+    entry.mSource          = aSource;
+    entry.mDest            = aDest;
+    entry.mIp6HeaderLength = aIp6HeaderLength;
+    entry.mHeaderLength    = aHeaderLength;
+    memcpy(entry.mHeader, aHeader, aHeaderLength);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+
 Neighbor *MeshForwarder::UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, Error aError, const Mac::Address &aMacDest)
 {
     Neighbor *neighbor = nullptr;
@@ -985,6 +1180,8 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, Error aError)
 
     mSendBusy = false;
 
+    OT_PACKET_TRACE(kTxDone, mSendMessage, mSendQueue.GetNumMessages());
+
     VerifyOrExit(mEnabled);
 
     if (!aFrame.IsEmpty())
@@ -1099,11 +1296,20 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
     RemoveMessageIfNoPendingTx(*mSendMessage);
 
 exit:
-    mScheduleTransmissionTask.Post();
+    ScheduleNextTransmission();
 }
 
 void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
 {
+    PriorityQueue *queue;
+
+#if OPENTHREAD_FTD
+    if (aMessage.IsChildPending())
+    {
+        UpdateSendQueue(aMessage);
+    }
+#endif
+
     VerifyOrExit(!aMessage.GetDirectTransmission() && !aMessage.IsChildPending());
 
     if (mSendMessage == &aMessage)
@@ -1112,7 +1318,9 @@ void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
         mMessageNextOffset = 0;
     }
 
-    mSendQueue.Dequeue(aMessage);
+    queue = aMessage.GetPriorityQueue();
+    queue->Dequeue(aMessage);
+    OT_PACKET_TRACE(kDequeue, &aMessage, queue->GetNumMessages());
     aMessage.Free();
 
 exit:
@@ -1145,6 +1353,8 @@ void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
     switch (aFrame.GetType())
     {
     case Mac::Frame::kFcfFrameData:
+        OT_PACKET_TRACE(kRxFrame, nullptr, 0);
+
         if (Lowpan::MeshHeader::IsMeshHeader(payload, payloadLength))
         {
 #if OPENTHREAD_FTD
@@ -1463,6 +1673,7 @@ Error MeshForwarder::HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLi
     ThreadNetif &netif = Get<ThreadNetif>();
 
     LogMessage(kMessageReceive, aMessage, &aMacSource, kErrorNone);
+    OT_PACKET_TRACE(kRxDatagram, &aMessage, 0);
 
     if (aMessage.GetType() == Message::kTypeIp6)
     {
@@ -272,6 +272,14 @@ public:
      */
     const PriorityQueue &GetSendQueue(void) const { return mSendQueue; }
 
+    /**
+     * This method returns a reference to the send queue.
+     *
+     * @returns  A reference to the send queue.
+     *
+     */
+    PriorityQueue &GetSendQueue(void) { return mSendQueue; }
+
     /**
      * This method returns a reference to the reassembly queue.
      *
@@ -302,6 +310,17 @@ public:
      *
      */
     const PriorityQueue &GetResolvingQueue(void) const { return mResolvingQueue; }
+
+    /**
+     * This method returns a reference to the indirect send queue.
+     *
+     * The indirect send queue holds the messages which are only pending indirect transmission to sleepy children
+     * (i.e., no pending direct transmission). Messages with a pending direct transmission are in the send queue.
+     *
+     * @returns  A reference to the indirect send queue.
+     *
+     */
+    const PriorityQueue &GetIndirectSendQueue(void) const { return mIndirectSendQueue; }
 #endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
@@ -327,6 +346,7 @@ private:
         kReassemblyTimeout      = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT, // Reassembly timeout (in seconds).
         kMeshHeaderFrameMtu     = OT_RADIO_FRAME_MAX_SIZE, // Max. MTU allowed when generating a Mesh Header frame.
         kMeshHeaderFrameFcsSize = sizeof(uint16_t),        // Frame FCS size for Mesh Header frame.
+        kMaxHeaderLength        = 48,                      // Max. length of a cached compressed 6LoWPAN header.
     };
 
     enum MessageAction : uint8_t ///< Defines the action parameter in `LogMessageInfo()` method.
@@ -386,6 +406,69 @@ private:
     };
 #endif // OPENTHREAD_FTD
 
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    // Caches the compressed IPv6 (and next) headers of the messages
+    // being sent. An entry is bound to a message (its pointer along
+    // with its cache id, set on first use), to the MAC (or mesh)
+    // source and destination addresses used for compression and to
+    // the Network Data (partition ID and version) providing the
+    // compression contexts.
+    class LowpanHeaderCache : public Clearable<LowpanHeaderCache>
+    {
+    public:
+        class Entry : public Clearable<Entry>
+        {
+            friend class LowpanHeaderCache;
+
+        public:
+            const uint8_t *GetHeader(void) const { return mHeader; }
+            uint8_t        GetHeaderLength(void) const { return mHeaderLength; }
+            uint16_t       GetIp6HeaderLength(void) const { return mIp6HeaderLength; }
+
+        private:
+            bool Matches(const Message &     aMessage,
+                         const Mac::Address &aSource,
+                         const Mac::Address &aDest,
+                         uint32_t            aPartitionId,
+                         uint8_t             aNetDataVersion) const;
+
+            const Message *mMessage;
+            uint32_t       mPartitionId;
+            uint16_t       mMessageId;
+            uint16_t       mIp6HeaderLength;
+            uint8_t        mHeaderLength;
+            uint8_t        mNetDataVersion;
+            Mac::Address   mSource;
+            Mac::Address   mDest;
+            uint8_t        mHeader[kMaxHeaderLength];
+        };
+
+        const Entry *FindEntry(const Message &     aMessage,
+                               const Mac::Address &aSource,
+                               const Mac::Address &aDest,
+                               uint32_t            aPartitionId,
+                               uint8_t             aNetDataVersion) const;
+        void         AddEntry(Message &           aMessage,
+                              const Mac::Address &aSource,
+                              const Mac::Address &aDest,
+                              uint32_t            aPartitionId,
+                              uint8_t             aNetDataVersion,
+                              const uint8_t *     aHeader,
+                              uint8_t             aHeaderLength,
+                              uint16_t            aIp6HeaderLength);
+
+    private:
+        enum : uint8_t
+        {
+            kNumEntries = OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE,
+        };
+
+        Entry    mEntries[kNumEntries];
+        uint16_t mNextMessageId;
+        uint8_t  mNextEntry;
+    };
+#endif // OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+
     void  SendIcmpErrorIfDstUnreach(const Message &     aMessage,
                                     const Mac::Address &aMacSource,
                                     const Mac::Address &aMacDest);
@@ -442,6 +525,10 @@ private:
                               uint16_t            aMeshDest      = 0xffff,
                               bool                aAddFragHeader = false);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, const Mac::Address &aMacDest, bool aAckRequest);
+    Error    CompressIp6Header(Message &             aMessage,
+                               const Mac::Address &  aMacSource,
+                               const Mac::Address &  aMacDest,
+                               Lowpan::BufferWriter &aBuffer);
 
     void  SendMesh(Message &aMessage, Mac::TxFrame &aFrame);
     void  SendDestinationUnreachable(uint16_t aMeshSource, const Message &aMessage);
@@ -467,10 +554,16 @@ private:
     void          HandleSentFrame(Mac::TxFrame &aFrame, Error aError);
     void          UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor);
     void          RemoveMessageIfNoPendingTx(Message &aMessage);
+#if OPENTHREAD_FTD
+    void            UpdateSendQueue(Message &aMessage);
+    static Message *FindEvictableMessage(const PriorityQueue &aQueue, uint8_t aPriority);
+#endif
 
     void        HandleTimeTick(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
     void        ScheduleTransmissionTask(void);
+    void        ScheduleNextTransmission(void);
+    void        StartDirectTransmission(void);
 
     Error GetFramePriority(const uint8_t *     aFrame,
                            uint16_t            aFrameLength,
@@ -572,6 +665,7 @@ private:
     bool         mEnabled : 1;
     bool         mTxPaused : 1;
     bool         mSendBusy : 1;
+    uint8_t      mTxPipelineCount;
 
     Tasklet mScheduleTransmissionTask;
 
@@ -580,10 +674,15 @@ private:
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
     PriorityQueue        mResolvingQueue;
+    PriorityQueue        mIndirectSendQueue;
     IndirectSender       mIndirectSender;
 #endif
 
     DataPollSender mDataPollSender;
+
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    LowpanHeaderCache mLowpanHeaderCache;
+#endif
 };
 
 /**
@@ -41,6 +41,7 @@
 #include "net/ip6.hpp"
 #include "net/tcp6.hpp"
 #include "net/udp6.hpp"
+#include "utils/packet_trace.hpp"
 
 namespace ot {
 
@@ -52,7 +53,11 @@ Error MeshForwarder::SendMessage(Message &aMessage)
 
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    aMessage.SetLowpanCacheId(0);
+#endif
     mSendQueue.Enqueue(aMessage);
+    OT_PACKET_TRACE(kEnqueue, &aMessage, mSendQueue.GetNumMessages());
 
     switch (aMessage.GetType())
     {
@@ -132,6 +137,11 @@ Error MeshForwarder::SendMessage(Message &aMessage)
         break;
     }
 
+    // Move the message to the indirect send queue if it is only
+    // pending indirect transmission (or drop it if it is not
+    // destined to anyone).
+    RemoveMessageIfNoPendingTx(aMessage);
+
     mScheduleTransmissionTask.Post();
 
     return error;
@@ -165,6 +175,7 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
             }
             else
             {
+                OT_PACKET_TRACE(kDrop, cur, mResolvingQueue.GetNumMessages());
                 LogMessage(kMessageDrop, *cur, nullptr, aError);
                 cur->Free();
             }
@@ -180,59 +191,32 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
 Error MeshForwarder::EvictMessage(Message::Priority aPriority)
 {
     Error          error    = kErrorNotFound;
-    PriorityQueue *queues[] = {&mResolvingQueue, &mSendQueue};
+    PriorityQueue *queues[] = {&mResolvingQueue, &mIndirectSendQueue, &mSendQueue};
     Message *      evict    = nullptr;
 
-    // search for a lower priority message to evict (choose lowest priority message among all queues)
-    for (PriorityQueue *queue : queues)
+    // Search for a lower priority message to evict (choose the
+    // lowest priority message among all queues).
+    for (uint8_t priority = 0; priority < aPriority; priority++)
     {
-        for (uint8_t priority = 0; priority < aPriority; priority++)
+        for (PriorityQueue *queue : queues)
         {
-            for (Message *message = queue->GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
-                 message          = message->GetNext())
-            {
-                if (message->GetPriority() != priority)
-                {
-                    break;
-                }
+            evict = FindEvictableMessage(*queue, priority);
 
-                if (message->GetDoNotEvict())
-                {
-                    continue;
-                }
-
-                evict     = message;
-                aPriority = static_cast<Message::Priority>(priority);
-                break;
+            if (evict != nullptr)
+            {
+                ExitNow(error = kErrorNone);
             }
         }
     }
 
-    if (evict != nullptr)
-    {
-        ExitNow(error = kErrorNone);
-    }
-
+    // Search for an equal or higher priority indirect message to evict.
     for (uint8_t priority = aPriority; priority < Message::kNumPriorities; priority++)
     {
-        // search for an equal or higher priority indirect message to evict
-        for (Message *message = mSendQueue.GetHeadForPriority(aPriority); message; message = message->GetNext())
-        {
-            if (message->GetPriority() != priority)
-            {
-                break;
-            }
-
-            if (message->GetDoNotEvict())
-            {
-                continue;
-            }
+        evict = FindEvictableMessage(mIndirectSendQueue, priority);
 
-            if (message->IsChildPending())
-            {
-                evict = message;
-                ExitNow(error = kErrorNone);
-            }
+        if (evict != nullptr)
+        {
+            ExitNow(error = kErrorNone);
         }
     }
 
@@ -246,89 +230,149 @@ exit:
     return error;
 }
 
-void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
+Message *MeshForwarder::FindEvictableMessage(const PriorityQueue &aQueue, uint8_t aPriority)
 {
-    Message *nextMessage;
+    // Only the message currently being processed for direct
+    // transmission is marked as "do not evict", so this loop
+    // checks at most two messages.
+
+    Message *message;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    for (message = aQueue.GetHeadForPriority(static_cast<Message::Priority>(aPriority)); message != nullptr;
+         message = message->GetNext())
     {
-        nextMessage = message->GetNext();
+        if (message->GetPriority() != aPriority)
+        {
+            message = nullptr;
+            break;
+        }
 
-        if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
+        if (!message->GetDoNotEvict())
         {
-            continue;
+            break;
         }
+    }
 
-        if (mIndirectSender.RemoveMessageFromSleepyChild(*message, aChild) != kErrorNone)
+    return message;
+}
+
+void MeshForwarder::UpdateSendQueue(Message &aMessage)
+{
+    PriorityQueue *queue    = aMessage.GetPriorityQueue();
+    PriorityQueue &newQueue = aMessage.GetDirectTransmission() ? mSendQueue : mIndirectSendQueue;
+
+    VerifyOrExit((queue == &mSendQueue) || (queue == &mIndirectSendQueue));
+    VerifyOrExit(queue != &newQueue);
+
+    queue->Dequeue(aMessage);
+    newQueue.Enqueue(aMessage);
+
+    if (&newQueue == &mSendQueue)
+    {
+        mScheduleTransmissionTask.Post();
+    }
+
+exit:
+    return;
+}
+
+void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
+{
+    PriorityQueue *queues[] = {&mSendQueue, &mIndirectSendQueue};
+    Message *      nextMessage;
+
+    for (PriorityQueue *queue : queues)
+    {
+        for (Message *message = queue->GetHead(); message; message = nextMessage)
         {
-            switch (message->GetType())
+            nextMessage = message->GetNext();
+
+            if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
             {
-            case Message::kTypeIp6:
+                continue;
+            }
+
+            if (mIndirectSender.RemoveMessageFromSleepyChild(*message, aChild) != kErrorNone)
             {
-                Ip6::Header ip6header;
+                switch (message->GetType())
+                {
+                case Message::kTypeIp6:
+                {
+                    Ip6::Header ip6header;
 
-                IgnoreError(message->Read(0, ip6header));
+                    IgnoreError(message->Read(0, ip6header));
 
-                if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(ip6header.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
+                    if (&aChild ==
+                        static_cast<Child *>(Get<NeighborTable>().FindNeighbor(ip6header.GetDestination())))
+                    {
+                        message->ClearDirectTransmission();
+                    }
+
+                    break;
                 }
 
-                break;
-            }
+                case Message::kType6lowpan:
+                {
+                    Lowpan::MeshHeader meshHeader;
 
-            case Message::kType6lowpan:
-            {
-                Lowpan::MeshHeader meshHeader;
+                    IgnoreError(meshHeader.ParseFrom(*message));
 
-                IgnoreError(meshHeader.ParseFrom(*message));
+                    if (&aChild ==
+                        static_cast<Child *>(Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination())))
+                    {
+                        message->ClearDirectTransmission();
+                    }
 
-                if (&aChild == static_cast<Child *>(Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
+                    break;
                 }
 
-                break;
+                default:
+                    break;
+                }
             }
 
-            default:
-                break;
-            }
+            RemoveMessageIfNoPendingTx(*message);
         }
-
-        RemoveMessageIfNoPendingTx(*message);
     }
 }
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    PriorityQueue *queues[] = {&mSendQueue, &mIndirectSendQueue};
+    Ip6::Header    ip6Header;
+    Message *      nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (PriorityQueue *queue : queues)
     {
-        if (message->GetSubType() != Message::kSubTypeMleDataResponse)
+        for (Message *message = queue->GetHead(); message; message = nextMessage)
         {
-            continue;
-        }
+            nextMessage = message->GetNext();
+
+            if (message->GetSubType() != Message::kSubTypeMleDataResponse)
+            {
+                continue;
+            }
 
-        IgnoreError(message->Read(0, ip6Header));
+            IgnoreError(message->Read(0, ip6Header));
 
-        if (!(ip6Header.GetDestination().IsMulticast()))
-        {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+            if (!(ip6Header.GetDestination().IsMulticast()))
+            {
+                for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+                {
+                    IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
+                }
+            }
+
+            if (mSendMessage == message)
             {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
+                mSendMessage = nullptr;
             }
-        }
 
-        if (mSendMessage == message)
-        {
-            mSendMessage = nullptr;
+            queue->Dequeue(*message);
+            OT_PACKET_TRACE(kDrop, message, queue->GetNumMessages());
+            LogMessage(kMessageDrop, *message, nullptr, kErrorNone);
+            message->Free();
         }
-
-        mSendQueue.Dequeue(*message);
-        LogMessage(kMessageDrop, *message, nullptr, kErrorNone);
-        message->Free();
     }
 }
 
@@ -35,6 +35,10 @@
 
 #if OPENTHREAD_MTD
 
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#include "utils/packet_trace.hpp"
+
 namespace ot {
 
 Error MeshForwarder::SendMessage(Message &aMessage)
@@ -42,8 +46,12 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetDirectTransmission();
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
+#if OPENTHREAD_CONFIG_6LOWPAN_HEADER_CACHE_SIZE > 0
+    aMessage.SetLowpanCacheId(0);
+#endif
 
     mSendQueue.Enqueue(aMessage);
+    OT_PACKET_TRACE(kEnqueue, &aMessage, mSendQueue.GetNumMessages());
     mScheduleTransmissionTask.Post();
 
     return kErrorNone;
@@ -100,6 +100,10 @@ class Mle : public InstanceLocator, private NonCopyable
     friend class ot::LinkMetrics;
 #endif
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventIp6AddressAdded | kEventIp6AddressRemoved | kEventIp6MulticastSubscribed |
+        kEventIp6MulticastUnsubscribed | kEventThreadNetdataChanged | kEventThreadKeySeqCounterChanged;
+
 public:
     /**
      * This constructor initializes the MLE object.
@@ -1594,6 +1598,7 @@ protected:
     TimerMilli    mDelayedResponseTimer;     ///< The timer to delay MLE responses.
     TimerMilli    mMessageTransmissionTimer; ///< The timer for (re-)sending of MLE messages (e.g. Child Update).
     uint8_t       mParentLeaderCost;
+    otMleCounters mCounters;
 
 private:
     enum
@@ -1877,7 +1882,6 @@ private:
     Ip6::NetifUnicastAddress mServiceAlocs[kMaxServiceAlocs];
 #endif
 
-    otMleCounters mCounters;
 
     Ip6::NetifUnicastAddress   mLinkLocal64;
     Ip6::NetifUnicastAddress   mMeshLocal64;
@@ -35,6 +35,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -326,6 +327,7 @@ void MleRouter::SetStateRouter(uint16_t aRloc16)
     mMessageTransmissionTimer.Stop();
     StopAdvertiseTrickleTimer();
     ResetAdvertiseInterval();
+    mRouterTable.SignalRouteChange();
 
     Get<ThreadNetif>().SubscribeAllRoutersMulticast();
     mPreviousPartitionIdRouter = mLeaderData.GetPartitionId();
@@ -357,6 +359,7 @@ void MleRouter::SetStateLeader(uint16_t aRloc16)
     mMessageTransmissionTimer.Stop();
     StopAdvertiseTrickleTimer();
     ResetAdvertiseInterval();
+    mRouterTable.SignalRouteChange();
     IgnoreError(GetLeaderAloc(mLeaderAloc.GetAddress()));
     Get<ThreadNetif>().AddUnicastAddress(mLeaderAloc);
 
@@ -955,6 +958,7 @@ Error MleRouter::HandleLinkAccept(const Message &         aMessage,
     router->ResetLinkFailures();
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
+    mRouterTable.SignalRouteChange();
 
     mNeighborTable.Signal(OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED, *router);
 
@@ -1134,6 +1138,7 @@ Error MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Message
     Router *        router;
     uint8_t         routerId;
     uint8_t         routerCount;
+    uint32_t        routeDigest;
 
     aMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddr);
 
@@ -1381,11 +1386,23 @@ Error MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Message
         }
 
         router->SetLastHeard(TimerMilli::GetNow());
+
+        // Skip processing a Route TLV identical to the last one from this router
+        // if nothing affecting its outcome changed in the router table since.
+        routeDigest = CalculateRouteTlvDigest(route, mRouterTable.GetLinkCost(*router));
+
+        if (router->IsStateValid() && router->MatchesRouteTlvDigest(routeDigest, mRouterTable.GetRouteGeneration()))
+        {
+            mCounters.mAdvertisementsSkipped++;
+            ExitNow();
+        }
+
+        UpdateRoutes(route, routerId);
+        router->SetRouteTlvDigest(routeDigest, mRouterTable.GetRouteGeneration());
+        mCounters.mAdvertisementsProcessed++;
         break;
     }
 
-    UpdateRoutes(route, routerId);
-
 exit:
     if (aNeighbor && aNeighbor->GetRloc16() != sourceAddress)
     {
@@ -1496,6 +1513,11 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
         ResetAdvertiseInterval();
     }
 
+    if (changed || resetAdvInterval)
+    {
+        mRouterTable.SignalRouteChange();
+    }
+
 #if (OPENTHREAD_CONFIG_LOG_MLE && (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO))
 
     VerifyOrExit(changed);
@@ -1518,6 +1540,24 @@ exit:
     return;
 }
 
+uint32_t MleRouter::CalculateRouteTlvDigest(const RouteTlv &aRoute, uint8_t aLinkCost)
+{
+    Crc16          ccitt(Crc16::kCcitt);
+    Crc16          ansi(Crc16::kAnsi);
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&aRoute);
+
+    for (uint16_t index = 0; index < aRoute.GetSize(); index++)
+    {
+        ccitt.Update(bytes[index]);
+        ansi.Update(bytes[index]);
+    }
+
+    ccitt.Update(aLinkCost);
+    ansi.Update(aLinkCost);
+
+    return (static_cast<uint32_t>(ccitt.Get()) << 16) | ansi.Get();
+}
+
 bool MleRouter::UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval)
 {
     bool    changed = false;
@@ -1799,7 +1839,7 @@ void MleRouter::HandleTimeTick(void)
         {
             otLogInfoMle("Child CSL synchronization expired");
             child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
+            Get<CslTxScheduler>().Update(child);
         }
 #endif
 
@@ -632,6 +632,8 @@ private:
     void  UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
     bool  UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval);
 
+    static uint32_t CalculateRouteTlvDigest(const RouteTlv &aRoute, uint8_t aLinkCost);
+
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
                                              const otMessageInfo *aMessageInfo,
@@ -78,6 +78,8 @@ class MlrManager : public InstanceLocator, private NonCopyable
     friend class ot::Notifier;
     friend class ot::TimeTicker;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventIp6MulticastSubscribed;
+
 public:
     /**
      * This constructor initializes the object.
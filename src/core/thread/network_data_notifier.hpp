@@ -54,6 +54,9 @@ class Notifier : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadChildRemoved | kEventThreadNetdataChanged;
+
 public:
     /**
      * Constructor.
@@ -290,6 +290,21 @@ Mac::TxFrame &RadioSelector::SelectRadio(Message &aMessage, const Mac::Address &
     }
 
     selectedRadio = Select(neighbor->GetSupportedRadioTypes(), *neighbor);
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE && OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    // A message which would need 6LoWPAN fragmentation on 15.4 radio
+    // link is sent over TREL link (if usable) when the neighbor
+    // supports large TREL frames, since the entire message can then
+    // be sent in a single frame.
+
+    if ((selectedRadio != Mac::kRadioTypeTrel) && IsBulkMessage(aMessage) &&
+        neighbor->GetSupportedRadioTypes().Contains(Mac::kRadioTypeTrel) && neighbor->IsTrelLargeFrameSupported() &&
+        (neighbor->GetRadioPreference(Mac::kRadioTypeTrel) >= kMinBulkTrelPreference))
+    {
+        selectedRadio = Mac::kRadioTypeTrel;
+    }
+#endif
+
     selections.Add(selectedRadio);
 
     Log(OT_LOG_LEVEL_DEBG, "SelectRadio", selectedRadio, *neighbor);
@@ -324,6 +339,13 @@ exit:
     return aTxFrames.GetTxFrame(selections);
 }
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE && OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+bool RadioSelector::IsBulkMessage(const Message &aMessage)
+{
+    return (aMessage.GetLength() - aMessage.GetOffset()) > kBulkMessageMinLength;
+}
+#endif
+
 Mac::RadioType RadioSelector::SelectPollFrameRadio(const Neighbor &aParent)
 {
     // This array defines the order in which different radio link types
@@ -195,11 +195,16 @@ private:
         kInitPreference                       = 200,  // Initial preference value
         kHighPreference                       = 220,  // High preference.
         kTrelProbeProbability                 = 25,   // Probability percentage to probe on TREL link
+        kMinBulkTrelPreference                = 150,  // Min TREL preference to select it for bulk messages.
+        kBulkMessageMinLength                 = 127,  // Min length of a bulk message (exceeds a 15.4 frame).
         kRadioPreferenceStringSize            = 75,
     };
 
     otLogLevel     UpdatePreference(Neighbor &aNeighbor, Mac::RadioType aRadioType, int16_t aDifference);
     Mac::RadioType Select(Mac::RadioTypes aRadioOptions, const Neighbor &aNeighbor);
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE && OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+    static bool IsBulkMessage(const Message &aMessage);
+#endif
     void           Log(otLogLevel aLogLevel, const char *aActionText, Mac::RadioType aType, const Neighbor &aNeighbor);
 
     static const Mac::RadioType sRadioSelectionOrder[Mac::kNumRadioTypes];
@@ -58,6 +58,7 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
     , mActiveRouterCount(0)
+    , mRouteGeneration(1)
 {
     for (Router &router : mRouters)
     {
@@ -91,6 +92,7 @@ void RouterTable::Clear(void)
 {
     mAllocatedRouterIds.Clear();
     memset(mRouterIdReuseDelay, 0, sizeof(mRouterIdReuseDelay));
+    memset(mLinkCosts, 0, sizeof(mLinkCosts));
     UpdateAllocation();
 }
 
@@ -105,6 +107,8 @@ void RouterTable::ClearNeighbors(void)
 
         router.SetState(Neighbor::kStateInvalid);
     }
+
+    SignalRouteChange();
 }
 
 bool RouterTable::IsAllocated(uint8_t aRouterId) const
@@ -117,6 +121,7 @@ void RouterTable::UpdateAllocation(void)
     uint8_t indexMap[Mle::kMaxRouterId + 1];
 
     mActiveRouterCount = 0;
+    SignalRouteChange();
 
     // build index map
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
@@ -302,6 +307,7 @@ void RouterTable::RemoveRouterLink(Router &aRouter)
 {
     aRouter.SetLinkQualityOut(0);
     aRouter.SetLastHeard(TimerMilli::GetNow());
+    SignalRouteChange();
 
     for (Router *cur = GetFirstEntry(); cur != nullptr; cur = GetNextEntry(cur))
     {
@@ -518,6 +524,32 @@ void RouterTable::HandleTimeTick(void)
             }
         }
     }
+
+    UpdateLinkCosts();
+}
+
+void RouterTable::UpdateLinkCosts(void)
+{
+    // Link costs also change as link quality is averaged on every
+    // received frame. Any change invalidates the Route TLV digests.
+
+    bool changed = false;
+
+    for (uint8_t index = 0; index < mActiveRouterCount; index++)
+    {
+        uint8_t linkCost = GetLinkCost(mRouters[index]);
+
+        if (mLinkCosts[index] != linkCost)
+        {
+            mLinkCosts[index] = linkCost;
+            changed           = true;
+        }
+    }
+
+    if (changed)
+    {
+        SignalRouteChange();
+    }
 }
 
 } // namespace ot
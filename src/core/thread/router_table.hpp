@@ -180,6 +180,23 @@ public:
      */
     uint8_t GetLinkCost(Router &aRouter);
 
+    /**
+     * This method returns the current route generation.
+     *
+     * The route generation changes whenever the router table changes in a way that may affect the outcome of
+     * processing a Route TLV (router ID allocation, neighbor links, link costs, or route updates).
+     *
+     * @returns The current route generation.
+     *
+     */
+    uint32_t GetRouteGeneration(void) const { return mRouteGeneration; }
+
+    /**
+     * This method signals a change in the router table that invalidates the recorded Route TLV digests.
+     *
+     */
+    void SignalRouteChange(void) { mRouteGeneration++; }
+
     /**
      * This method returns the neighbor for a given RLOC16.
      *
@@ -354,6 +371,7 @@ private:
     };
 
     void          UpdateAllocation(void);
+    void          UpdateLinkCosts(void);
     const Router *GetFirstEntry(void) const;
     const Router *GetNextEntry(const Router *aRouter) const;
     Router *GetFirstEntry(void) { return const_cast<Router *>(const_cast<const RouterTable *>(this)->GetFirstEntry()); }
@@ -374,6 +392,8 @@ private:
     TimeMilli        mRouterIdSequenceLastUpdated;
     uint8_t          mRouterIdSequence;
     uint8_t          mActiveRouterCount;
+    uint8_t          mLinkCosts[Mle::kMaxRouters];
+    uint32_t         mRouteGeneration;
 };
 
 } // namespace ot
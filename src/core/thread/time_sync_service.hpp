@@ -56,6 +56,8 @@ class TimeSync : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadPartitionIdChanged;
+
 public:
     /**
      * This constructor initializes the object.
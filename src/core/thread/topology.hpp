@@ -1179,30 +1179,6 @@ public:
      */
     void SetRequestTlv(uint8_t aIndex, uint8_t aType) { mRequestTlvs[aIndex] = aType; }
 
-#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
-
-    /**
-     * This method increments the number of seconds since last supervision of the child.
-     *
-     */
-    void IncrementSecondsSinceLastSupervision(void) { mSecondsSinceSupervision++; }
-
-    /**
-     * This method returns the number of seconds since last supervision of the child (last message to the child)
-     *
-     * @returns Number of seconds since last supervision of the child.
-     *
-     */
-    uint16_t GetSecondsSinceLastSupervision(void) const { return mSecondsSinceSupervision; }
-
-    /**
-     * This method resets the number of seconds since last supervision of the child to zero.
-     *
-     */
-    void ResetSecondsSinceLastSupervision(void) { mSecondsSinceSupervision = 0; }
-
-#endif // #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
-
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     /**
      * This method returns MLR state of an IPv6 multicast address.
@@ -1303,10 +1279,6 @@ private:
         uint8_t mAttachChallenge[Mle::kMaxChallengeSize]; ///< The challenge value
     };
 
-#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
-    uint16_t mSecondsSinceSupervision; ///< Number of seconds since last supervision of the child.
-#endif
-
     static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < 8192, "mQueuedMessageCount cannot fit max required!");
 };
 
@@ -1397,6 +1369,36 @@ public:
      */
     void SetCost(uint8_t aCost) { mCost = aCost; }
 
+#if OPENTHREAD_FTD
+    /**
+     * This method indicates whether a Route TLV matches the last one processed from this router.
+     *
+     * @param[in]  aDigest      The digest of the received Route TLV.
+     * @param[in]  aGeneration  The current route generation of the router table.
+     *
+     * @retval TRUE   The Route TLV digest and the route generation both match the stored ones.
+     * @retval FALSE  The Route TLV digest or the route generation do not match the stored ones.
+     *
+     */
+    bool MatchesRouteTlvDigest(uint32_t aDigest, uint32_t aGeneration) const
+    {
+        return (mRouteTlvDigest == aDigest) && (mRouteGeneration == aGeneration);
+    }
+
+    /**
+     * This method records the digest of the last Route TLV processed from this router.
+     *
+     * @param[in]  aDigest      The digest of the processed Route TLV.
+     * @param[in]  aGeneration  The route generation of the router table after processing the Route TLV.
+     *
+     */
+    void SetRouteTlvDigest(uint32_t aDigest, uint32_t aGeneration)
+    {
+        mRouteTlvDigest  = aDigest;
+        mRouteGeneration = aGeneration;
+    }
+#endif
+
 private:
     uint8_t mNextHop;            ///< The next hop towards this router
     uint8_t mLinkQualityOut : 2; ///< The link quality out for this router
@@ -1406,6 +1408,11 @@ private:
 #else
     uint8_t mCost : 4;     ///< The cost to this router via neighbor router
 #endif
+
+#if OPENTHREAD_FTD
+    uint32_t mRouteTlvDigest;  ///< The digest of the last Route TLV processed from this router
+    uint32_t mRouteGeneration; ///< The route generation when the last Route TLV was processed
+#endif
 };
 
 } // namespace ot
@@ -119,10 +119,30 @@ void ChannelMonitor::HandleTimer(Timer &aTimer)
 
 void ChannelMonitor::HandleTimer(void)
 {
-    IgnoreError(Get<Mac::Mac>().EnergyScan(mScanChannelMasks[mChannelMaskIndex], 0,
-                                           &ChannelMonitor::HandleEnergyScanResult, this));
+    uint32_t scanChannels = mScanChannelMasks[mChannelMaskIndex];
+    uint32_t interval     = kTimerInterval;
 
-    mTimer.StartAt(mTimer.GetFireTime(), Random::NonCrypto::AddJitter(kTimerInterval, kMaxJitterInterval));
+    if (Get<Mac::Mac>().IsMultiChannelEnergyScanSupported())
+    {
+        // The radio can sample all the channels in a single operation,
+        // so scan the channels of all masks together once every
+        // `kSampleInterval`. Setting the index to the last mask
+        // ensures the scan completion counts a full sample round.
+
+        scanChannels = 0;
+
+        for (uint32_t mask : mScanChannelMasks)
+        {
+            scanChannels |= mask;
+        }
+
+        mChannelMaskIndex = kNumChannelMasks - 1;
+        interval          = kSampleInterval;
+    }
+
+    IgnoreError(Get<Mac::Mac>().EnergyScan(scanChannels, 0, &ChannelMonitor::HandleEnergyScanResult, this));
+
+    mTimer.StartAt(mTimer.GetFireTime(), Random::NonCrypto::AddJitter(interval, kMaxJitterInterval));
 }
 
 void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult, void *aContext)
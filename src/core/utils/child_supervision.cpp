@@ -55,6 +55,21 @@ ChildSupervisor::ChildSupervisor(Instance &aInstance)
 
 void ChildSupervisor::SetSupervisionInterval(uint16_t aInterval)
 {
+    // Re-key the deadlines of the tracked children, keeping the time
+    // since their last supervision unchanged.
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(child);
+
+        if (mDeadlines.Contains(childIndex))
+        {
+            TimeMilli lastSupervision = mDeadlines.GetKey(childIndex) - Time::SecToMsec(mSupervisionInterval);
+
+            mDeadlines.Update(childIndex, lastSupervision + Time::SecToMsec(aInterval));
+        }
+    }
+
     mSupervisionInterval = aInterval;
     CheckState();
 }
@@ -102,18 +117,60 @@ exit:
 
 void ChildSupervisor::UpdateOnSend(Child &aChild)
 {
-    aChild.ResetSecondsSinceLastSupervision();
+    mDeadlines.Update(Get<ChildTable>().GetChildIndex(aChild),
+                      TimerMilli::GetNow() + Time::SecToMsec(mSupervisionInterval));
 }
 
 void ChildSupervisor::HandleTimeTick(void)
 {
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    TimeMilli now = TimerMilli::GetNow();
+
+    while (!mDeadlines.IsEmpty())
+    {
+        uint16_t childIndex = mDeadlines.GetTop();
+        Child *  child      = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if (now < mDeadlines.GetKey(childIndex))
+        {
+            break;
+        }
+
+        if ((child == nullptr) || !child->IsStateValid())
+        {
+            mDeadlines.Remove(childIndex);
+            continue;
+        }
+
+        if (child->IsRxOnWhenIdle())
+        {
+            mDeadlines.Update(childIndex, now + Time::SecToMsec(mSupervisionInterval));
+            continue;
+        }
+
+        // The child is checked again on next tick, unless a message
+        // is sent to it in the meantime (`UpdateOnSend()` then moves
+        // its deadline a full supervision interval ahead).
+
+        mDeadlines.Update(childIndex, now + kOneSecond);
+        SendMessage(*child);
+    }
+}
+
+void ChildSupervisor::UpdateChildren(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (uint16_t childIndex = 0; childIndex < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN; childIndex++)
     {
-        child.IncrementSecondsSinceLastSupervision();
+        Child *child = Get<ChildTable>().GetChildAtIndex(childIndex);
 
-        if ((child.GetSecondsSinceLastSupervision() >= mSupervisionInterval) && !child.IsRxOnWhenIdle())
+        if ((child == nullptr) || !child->IsStateValid())
+        {
+            mDeadlines.Remove(childIndex);
+        }
+        else if (!mDeadlines.Contains(childIndex))
         {
-            SendMessage(child);
+            mDeadlines.Update(childIndex, now + Time::SecToMsec(mSupervisionInterval));
         }
     }
 }
@@ -129,6 +186,15 @@ void ChildSupervisor::CheckState(void)
     shouldRun = ((mSupervisionInterval != 0) && !Get<Mle::MleRouter>().IsDisabled() &&
                  Get<ChildTable>().HasChildren(Child::kInStateValid));
 
+    if (shouldRun)
+    {
+        UpdateChildren();
+    }
+    else
+    {
+        mDeadlines.Clear();
+    }
+
     if (shouldRun && !Get<TimeTicker>().IsReceiverRegistered(TimeTicker::kChildSupervisor))
     {
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kChildSupervisor);
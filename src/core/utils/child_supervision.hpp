@@ -39,6 +39,7 @@
 
 #include <stdint.h>
 
+#include "common/indexed_min_heap.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
@@ -98,6 +99,9 @@ class ChildSupervisor : public InstanceLocator, private NonCopyable
     friend class ot::Notifier;
     friend class ot::TimeTicker;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadChildAdded | kEventThreadChildRemoved;
+
 public:
     /**
      * This constructor initializes the object.
@@ -167,10 +171,16 @@ private:
 
     void SendMessage(Child &aChild);
     void CheckState(void);
+    void UpdateChildren(void);
     void HandleTimeTick(void);
     void HandleNotifierEvents(Events aEvents);
 
     uint16_t mSupervisionInterval;
+
+    // The supervision deadline of every valid child (keyed by child
+    // index), so that on each time tick only the children whose
+    // deadline has passed are visited.
+    IndexedMinHeap<TimeMilli, OPENTHREAD_CONFIG_MLE_MAX_CHILDREN> mDeadlines;
 };
 
 #endif // #if OPENTHREAD_FTD
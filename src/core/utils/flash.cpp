@@ -68,6 +68,8 @@ void Flash::Init(void)
         }
     }
 
+    ResetIndex();
+
     for (mSwapUsed = kSwapMarkerSize; mSwapUsed <= mSwapSize - sizeof(record); mSwapUsed += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(record));
@@ -80,6 +82,11 @@ void Flash::Init(void)
         {
             break;
         }
+
+        if (record.IsValid())
+        {
+            AddToIndex({mSwapUsed, record.GetKey(), static_cast<uint8_t>(record.GetLength()), record.IsFirst()});
+        }
     }
 
     SanitizeFreeSpace();
@@ -116,47 +123,41 @@ exit:
 
 Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
 {
-    Error        error       = kErrorNotFound;
-    uint16_t     valueLength = 0;
-    int          index       = 0; // This must be initalized to 0. See [Note] in Delete().
-    uint32_t     offset;
-    RecordHeader record;
-
-    for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    Error      error       = kErrorNotFound;
+    uint16_t   valueLength = 0;
+    uint32_t   valueOffset = 0;
+    int        index       = 0; // This must be initalized to 0. See [Note] in Delete().
+    uint32_t   cursor      = GetFirstCursor();
+    RecordInfo info;
+
+    while (ReadNextValidRecord(cursor, info))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
-
-        if ((record.GetKey() != aKey) || !record.IsValid())
+        if (info.mKey != aKey)
         {
             continue;
         }
 
-        if (record.IsFirst())
+        if (info.mFirst)
         {
             index = 0;
         }
 
         if (index == aIndex)
         {
-            if (aValue && aValueLength)
-            {
-                uint16_t readLength = *aValueLength;
-
-                if (readLength > record.GetLength())
-                {
-                    readLength = record.GetLength();
-                }
-
-                otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
-            }
-
-            valueLength = record.GetLength();
+            valueOffset = info.mOffset + sizeof(RecordHeader);
+            valueLength = info.mLength;
             error       = kErrorNone;
         }
 
         index++;
     }
 
+    if ((error == kErrorNone) && aValue && aValueLength)
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, valueOffset, aValue,
+                        (*aValueLength > valueLength) ? valueLength : *aValueLength);
+    }
+
     if (aValueLength)
     {
         *aValueLength = valueLength;
@@ -198,22 +199,22 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+    AddToIndex({mSwapUsed, aKey, static_cast<uint8_t>(aValueLength), aFirst});
+
     mSwapUsed += record.GetSize();
 
 exit:
     return error;
 }
 
-bool Flash::DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const
+bool Flash::DoesValidRecordExist(uint32_t aCursor, uint16_t aKey) const
 {
-    RecordHeader record;
-    bool         rval = false;
+    RecordInfo info;
+    bool       rval = false;
 
-    for (; aOffset < mSwapUsed; aOffset += record.GetSize())
+    while (ReadNextValidRecord(aCursor, info))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
-
-        if (record.IsValid() && record.IsFirst() && (record.GetKey() == aKey))
+        if (info.mFirst && (info.mKey == aKey))
         {
             ExitNow(rval = true);
         }
@@ -225,60 +226,62 @@ exit:
 
 void Flash::Swap(void)
 {
-    uint8_t  dstIndex  = !mSwapIndex;
-    uint32_t dstOffset = kSwapMarkerSize;
-    Record   record;
+    uint8_t    dstIndex  = !mSwapIndex;
+    uint32_t   dstOffset = kSwapMarkerSize;
+    uint32_t   cursor    = GetFirstCursor();
+    RecordInfo info;
+    Record     record;
 
     otPlatFlashErase(&GetInstance(), dstIndex);
 
-    for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
+    while (ReadNextValidRecord(cursor, info))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, sizeof(RecordHeader));
-
-        VerifyOrExit(record.IsAddBeginSet());
-
-        if (!record.IsValid() || DoesValidRecordExist(srcOffset + record.GetSize(), record.GetKey()))
+        if (DoesValidRecordExist(cursor, info.mKey))
         {
             continue;
         }
 
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, record.GetSize());
+        otPlatFlashRead(&GetInstance(), mSwapIndex, info.mOffset, &record, sizeof(RecordHeader));
+        otPlatFlashRead(&GetInstance(), mSwapIndex, info.mOffset, &record, record.GetSize());
         otPlatFlashWrite(&GetInstance(), dstIndex, dstOffset, &record, record.GetSize());
         dstOffset += record.GetSize();
     }
 
-exit:
     otPlatFlashWrite(&GetInstance(), dstIndex, 0, &sSwapActive, sizeof(sSwapActive));
     otPlatFlashWrite(&GetInstance(), mSwapIndex, 0, &sSwapInactive, sizeof(sSwapInactive));
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+    BuildIndex();
 }
 
 Error Flash::Delete(uint16_t aKey, int aIndex)
 {
-    Error        error = kErrorNotFound;
-    int          index = 0; // This must be initalized to 0. See [Note] below.
+    Error        error  = kErrorNotFound;
+    int          index  = 0; // This must be initalized to 0. See [Note] below.
+    uint32_t     cursor = GetFirstCursor();
+    RecordInfo   info;
     RecordHeader record;
 
-    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    while (ReadNextValidRecord(cursor, info))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
-
-        if ((record.GetKey() != aKey) || !record.IsValid())
+        if (info.mKey != aKey)
         {
             continue;
         }
 
-        if (record.IsFirst())
+        if (info.mFirst)
         {
             index = 0;
         }
 
         if ((aIndex == index) || (aIndex == -1))
         {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, info.mOffset, &record, sizeof(record));
             record.SetDeleted();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, info.mOffset, &record, sizeof(record));
+            RemoveIndexEntry(cursor);
             error = kErrorNone;
         }
 
@@ -288,8 +291,16 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
 
         if ((index == 1) && (aIndex == 0))
         {
+            RecordInfo *entry = GetIndexEntry(cursor);
+
+            otPlatFlashRead(&GetInstance(), mSwapIndex, info.mOffset, &record, sizeof(record));
             record.SetFirst();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, info.mOffset, &record, sizeof(record));
+
+            if (entry != nullptr)
+            {
+                entry->mFirst = true;
+            }
         }
 
         index++;
@@ -305,6 +316,153 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+    ResetIndex();
+}
+
+uint32_t Flash::GetFirstCursor(void) const
+{
+    // While the index is valid, a cursor is a position in the index,
+    // otherwise it is a record offset in the active swap area.
+
+    return IsIndexValid() ? 0 : kSwapMarkerSize;
+}
+
+bool Flash::ReadNextValidRecord(uint32_t &aCursor, RecordInfo &aInfo) const
+{
+    bool found;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexValid)
+    {
+        found = (aCursor < mIndexLength);
+
+        if (found)
+        {
+            aInfo = mIndex[aCursor++];
+        }
+    }
+    else
+#endif
+    {
+        found = ReadNextValidRecordFromFlash(aCursor, aInfo);
+    }
+
+    return found;
+}
+
+bool Flash::ReadNextValidRecordFromFlash(uint32_t &aOffset, RecordInfo &aInfo) const
+{
+    bool         found = false;
+    RecordHeader record;
+
+    while (aOffset < mSwapUsed)
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+        VerifyOrExit(record.IsAddBeginSet());
+
+        aInfo.mOffset = aOffset;
+        aOffset += record.GetSize();
+
+        if (record.IsValid())
+        {
+            aInfo.mKey    = record.GetKey();
+            aInfo.mLength = static_cast<uint8_t>(record.GetLength());
+            aInfo.mFirst  = record.IsFirst();
+            ExitNow(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+
+bool Flash::IsIndexValid(void) const
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    return mIndexValid;
+#else
+    return false;
+#endif
+}
+
+void Flash::ResetIndex(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    mIndexLength = 0;
+    mIndexValid  = true;
+#endif
+}
+
+void Flash::BuildIndex(void)
+{
+    uint32_t   offset = kSwapMarkerSize;
+    RecordInfo info;
+
+    ResetIndex();
+
+    while (ReadNextValidRecordFromFlash(offset, info))
+    {
+        AddToIndex(info);
+    }
+}
+
+void Flash::AddToIndex(const RecordInfo &aInfo)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    VerifyOrExit(mIndexValid);
+
+    if (mIndexLength >= OT_ARRAY_LENGTH(mIndex))
+    {
+        // Too many valid records, fall back to scanning the flash
+        // until the next swap compacts them.
+        mIndexValid = false;
+        ExitNow();
+    }
+
+    mIndex[mIndexLength++] = aInfo;
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aInfo);
+#endif
+}
+
+Flash::RecordInfo *Flash::GetIndexEntry(uint32_t aCursor)
+{
+    // Returns the index entry last read with `aCursor`.
+
+    RecordInfo *entry = nullptr;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexValid)
+    {
+        entry = &mIndex[aCursor - 1];
+    }
+#else
+    OT_UNUSED_VARIABLE(aCursor);
+#endif
+
+    return entry;
+}
+
+void Flash::RemoveIndexEntry(uint32_t &aCursor)
+{
+    // Removes the index entry last read with `aCursor`, and moves
+    // `aCursor` back so that the next read returns the entry
+    // following the removed one.
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    if (mIndexValid)
+    {
+        aCursor--;
+        mIndexLength--;
+        memmove(&mIndex[aCursor], &mIndex[aCursor + 1], (mIndexLength - aCursor) * sizeof(RecordInfo));
+    }
+#else
+    OT_UNUSED_VARIABLE(aCursor);
+#endif
 }
 
 } // namespace ot
@@ -222,14 +222,42 @@ private:
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
+    struct RecordInfo
+    {
+        uint32_t mOffset; // Offset of the record header in the active swap area.
+        uint16_t mKey;
+        uint8_t  mLength;
+        bool     mFirst;
+    };
+
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
-    bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
+    bool  DoesValidRecordExist(uint32_t aCursor, uint16_t aKey) const;
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
+    uint32_t GetFirstCursor(void) const;
+    bool     ReadNextValidRecord(uint32_t &aCursor, RecordInfo &aInfo) const;
+    bool     ReadNextValidRecordFromFlash(uint32_t &aOffset, RecordInfo &aInfo) const;
+
+    bool        IsIndexValid(void) const;
+    void        ResetIndex(void);
+    void        BuildIndex(void);
+    void        AddToIndex(const RecordInfo &aInfo);
+    RecordInfo *GetIndexEntry(uint32_t aCursor);
+    void        RemoveIndexEntry(uint32_t &aCursor);
+
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE > 0
+    // RAM index of the valid records in the active swap area, in
+    // flash order. It is only used while `mIndexValid` is set,
+    // i.e., while all valid records fit in it.
+    RecordInfo mIndex[OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE];
+    uint16_t   mIndexLength;
+    bool       mIndexValid;
+#endif
 };
 
 } // namespace ot
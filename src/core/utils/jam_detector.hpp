@@ -55,6 +55,8 @@ class JamDetector : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged;
+
 public:
     /**
      * This function pointer is called if jam state changes (assuming jamming detection is enabled).
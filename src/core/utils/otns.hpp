@@ -63,6 +63,9 @@ class Otns : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadPartitionIdChanged | kEventJoinerStateChanged;
+
 public:
     /**
      * This constructor initializes the object.
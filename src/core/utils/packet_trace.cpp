@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the per-packet trace of the mesh data path.
+ */
+
+#include "packet_trace.hpp"
+
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+
+#include <openthread/platform/time.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Utils {
+
+PacketTrace::PacketTrace(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mStart(0)
+    , mLength(0)
+    , mLostCount(0)
+    , mTxMessage(nullptr)
+{
+}
+
+void PacketTrace::Record(Event aEvent, const Message *aMessage, uint16_t aQueueDepth)
+{
+    otPacketTraceEvent *event;
+
+    switch (aEvent)
+    {
+    case kFrame:
+    case kFragment:
+        mTxMessage = aMessage;
+        break;
+
+    case kCsmaBackoff:
+    case kTxStart:
+    case kAckWait:
+    case kRetry:
+        aMessage = mTxMessage;
+        break;
+
+    case kTxDone:
+        if (aMessage == nullptr)
+        {
+            aMessage = mTxMessage;
+        }
+
+        mTxMessage = nullptr;
+        break;
+
+    default:
+        break;
+    }
+
+    if (mLength == kNumEvents)
+    {
+        mStart = (mStart + 1) % kNumEvents;
+        mLength--;
+        mLostCount++;
+    }
+
+    event = &mEvents[(mStart + mLength) % kNumEvents];
+    mLength++;
+
+    event->mTimestamp  = otPlatTimeGet();
+    event->mMessage    = aMessage;
+    event->mQueueDepth = aQueueDepth;
+    event->mEvent      = aEvent;
+}
+
+uint16_t PacketTrace::Read(otPacketTraceEvent *aEvents, uint16_t aMaxEvents)
+{
+    uint16_t count = OT_MIN(aMaxEvents, mLength);
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        aEvents[i] = mEvents[mStart];
+        mStart     = (mStart + 1) % kNumEvents;
+    }
+
+    mLength -= count;
+
+    return count;
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
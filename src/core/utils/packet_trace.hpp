@@ -0,0 +1,158 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the per-packet trace of the mesh data path.
+ */
+
+#ifndef PACKET_TRACE_HPP_
+#define PACKET_TRACE_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+
+#include <openthread/packet_trace.h>
+
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+
+/**
+ * This macro records a packet trace event.
+ *
+ * It must be used from a method of a class that derives from `InstanceLocator`. When packet trace is disabled, the
+ * macro expands to nothing and its arguments are not evaluated.
+ *
+ * @param[in] aEvent       The event (`Utils::PacketTrace::Event`).
+ * @param[in] aMessage     A pointer to the message (may be `nullptr` for MAC events).
+ * @param[in] aQueueDepth  The related queue depth.
+ *
+ */
+#define OT_PACKET_TRACE(aEvent, aMessage, aQueueDepth) \
+    Get<Utils::PacketTrace>().Record(Utils::PacketTrace::aEvent, (aMessage), (aQueueDepth))
+
+namespace ot {
+namespace Utils {
+
+/**
+ * This class implements the packet trace ring buffer.
+ *
+ * Each event records a timestamp, an event type, the message it applies to, and a queue depth. When the ring buffer is
+ * full the oldest event is overwritten.
+ *
+ * MAC layer events (CSMA backoff, transmit start, ack wait, retry) are recorded with no message and are attributed to
+ * the message whose frame is currently being transmitted.
+ *
+ */
+class PacketTrace : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * This enumeration defines the trace event types.
+     *
+     */
+    enum Event : uint8_t
+    {
+        kIp6Send      = OT_PACKET_TRACE_EVENT_IP6_SEND,      ///< IPv6 datagram queued by `Ip6`.
+        kEnqueue      = OT_PACKET_TRACE_EVENT_ENQUEUE,       ///< Message queued in `MeshForwarder`.
+        kAddressQuery = OT_PACKET_TRACE_EVENT_ADDRESS_QUERY, ///< Message held waiting for address resolution.
+        kRoute        = OT_PACKET_TRACE_EVENT_ROUTE,         ///< Route resolved for direct transmission.
+        kIndirectHold = OT_PACKET_TRACE_EVENT_INDIRECT_HOLD, ///< Message held for a sleepy child.
+        kFrame        = OT_PACKET_TRACE_EVENT_FRAME,         ///< MAC frame prepared from the message.
+        kFragment     = OT_PACKET_TRACE_EVENT_FRAGMENT,      ///< MAC frame prepared with a 6LoWPAN fragment.
+        kCsmaBackoff  = OT_PACKET_TRACE_EVENT_CSMA_BACKOFF,  ///< CSMA backoff started.
+        kTxStart      = OT_PACKET_TRACE_EVENT_TX_START,      ///< Frame handed to the radio.
+        kAckWait      = OT_PACKET_TRACE_EVENT_ACK_WAIT,      ///< Waiting for the ack.
+        kRetry        = OT_PACKET_TRACE_EVENT_RETRY,         ///< Frame retransmission.
+        kTxDone       = OT_PACKET_TRACE_EVENT_TX_DONE,       ///< Frame transmission completed.
+        kDequeue      = OT_PACKET_TRACE_EVENT_DEQUEUE,       ///< Message delivered and removed from the send queue.
+        kDrop         = OT_PACKET_TRACE_EVENT_DROP,          ///< Message dropped.
+        kRxFrame      = OT_PACKET_TRACE_EVENT_RX_FRAME,      ///< MAC data frame received.
+        kRxDatagram   = OT_PACKET_TRACE_EVENT_RX_DATAGRAM,   ///< IPv6 datagram passed to `Ip6`.
+    };
+
+    /**
+     * This constructor initializes the `PacketTrace` object.
+     *
+     * @param[in] aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit PacketTrace(Instance &aInstance);
+
+    /**
+     * This method records a trace event.
+     *
+     * @param[in] aEvent       The event.
+     * @param[in] aMessage     A pointer to the message, or `nullptr` to attribute the event to the message being
+     *                         transmitted.
+     * @param[in] aQueueDepth  The related queue depth.
+     *
+     */
+    void Record(Event aEvent, const Message *aMessage, uint16_t aQueueDepth);
+
+    /**
+     * This method reads (and removes) the oldest trace events.
+     *
+     * @param[out] aEvents     A pointer to an array to output the events.
+     * @param[in]  aMaxEvents  The maximum number of events to read.
+     *
+     * @returns The number of events written to @p aEvents.
+     *
+     */
+    uint16_t Read(otPacketTraceEvent *aEvents, uint16_t aMaxEvents);
+
+    /**
+     * This method returns the number of events overwritten before being read.
+     *
+     * @returns The number of lost events.
+     *
+     */
+    uint32_t GetLostCount(void) const { return mLostCount; }
+
+private:
+    static constexpr uint16_t kNumEvents = OPENTHREAD_CONFIG_PACKET_TRACE_NUM_EVENTS;
+
+    otPacketTraceEvent mEvents[kNumEvents];
+    uint16_t           mStart;
+    uint16_t           mLength;
+    uint32_t           mLostCount;
+    const Message *    mTxMessage;
+};
+
+} // namespace Utils
+} // namespace ot
+
+#else // OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+
+#define OT_PACKET_TRACE(aEvent, aMessage, aQueueDepth)
+
+#endif // OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+
+#endif // PACKET_TRACE_HPP_
@@ -64,6 +64,8 @@ class Slaac : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventIp6AddressRemoved;
+
 public:
     enum
     {
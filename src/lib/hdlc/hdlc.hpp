@@ -195,6 +195,11 @@ private:
 template <uint16_t kSize> class MultiFrameBuffer : public FrameWritePointer
 {
 public:
+    enum
+    {
+        kFrameHeaderSize = sizeof(uint16_t) + sizeof(uint16_t), ///< Number of bytes kept in front of each frame.
+    };
+
     /**
      * This constructor initializes the `MultiFrameBuffer` object.
      *
@@ -447,7 +452,7 @@ private:
     {
         kHeaderTotalLengthOffset = 0,
         kHeaderSkipLengthOffset  = sizeof(uint16_t),
-        kHeaderSize              = sizeof(uint16_t) + sizeof(uint16_t),
+        kHeaderSize              = kFrameHeaderSize,
     };
 
     uint8_t  mBuffer[kSize];
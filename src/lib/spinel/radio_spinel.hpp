@@ -467,6 +467,22 @@ public:
      */
     otError EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration);
 
+    /**
+     * This method begins the energy scan sequence of multiple channels on the radio.
+     *
+     * The results are reported through `otPlatRadioMultiChannelEnergyScanDone()` once all channels were scanned.
+     *
+     * @param[in]  aScanChannels    A bit-vector indicating the channels to perform the energy scan on.
+     * @param[in]  aScanDuration    The duration, in milliseconds, for each channel to be scanned.
+     *
+     * @retval  OT_ERROR_NONE               Succeeded.
+     * @retval  OT_ERROR_NOT_CAPABLE        The transceiver does not support multi-channel energy scan.
+     * @retval  OT_ERROR_INVALID_ARGS       @p aScanChannels is empty.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError MultiChannelEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration);
+
     /**
      * This method switches the radio state from Receive to Transmit.
      *
@@ -899,7 +915,8 @@ private:
      */
     bool IsSafeToHandleNow(spinel_prop_key_t aKey) const
     {
-        return !(aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT);
+        return !(aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT ||
+                 aKey == SPINEL_PROP_MAC_SCAN_STATE);
     }
 
     void HandleNotification(SpinelInterface::RxFrameBuffer &aFrameBuffer);
@@ -958,11 +975,15 @@ private:
     char         mVersion[kVersionStringSize];
     otExtAddress mIeeeEui64;
 
+    otEnergyScanResult mEnergyScanResults[kChannelMaskBufferSize]; ///< Results of the multi-channel energy scan.
+    uint8_t            mNumEnergyScanResults;
+
     State mState;
-    bool  mIsPromiscuous : 1;     ///< Promiscuous mode.
-    bool  mIsReady : 1;           ///< NCP ready.
-    bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
-    bool  mIsTimeSynced : 1;      ///< Host has calculated the time difference between host and RCP.
+    bool  mIsPromiscuous : 1;            ///< Promiscuous mode.
+    bool  mIsReady : 1;                  ///< NCP ready.
+    bool  mSupportsLogStream : 1;        ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
+    bool  mIsTimeSynced : 1;             ///< Host has calculated the time difference between host and RCP.
+    bool  mIsMultiChannelEnergyScan : 1; ///< A multi-channel energy scan is in progress.
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
@@ -980,6 +1001,7 @@ private:
     otExtAddress mSrcMatchExtEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
     int16_t      mSrcMatchExtEntryCount;
     uint8_t      mScanChannel;
+    uint32_t     mScanChannels;
     uint16_t     mScanDuration;
     int8_t       mCcaEnergyDetectThreshold;
     int8_t       mTransmitPower;
@@ -190,11 +190,13 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mRadioCaps(0)
     , mChannel(0)
     , mRxSensitivity(0)
+    , mNumEnergyScanResults(0)
     , mState(kStateDisabled)
     , mIsPromiscuous(false)
     , mIsReady(false)
     , mSupportsLogStream(false)
     , mIsTimeSynced(false)
+    , mIsMultiChannelEnergyScan(false)
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     , mRcpFailureCount(0)
     , mSrcMatchShortEntryCount(0)
@@ -832,7 +834,6 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleValueIs(spinel_prop_k
 {
     otError        error = OT_ERROR_NONE;
     spinel_ssize_t unpacked;
-
     if (aKey == SPINEL_PROP_STREAM_RAW)
     {
         SuccessOrExit(error = ParseRadioFrame(mRxRadioFrame, aBuffer, aLength, unpacked));
@@ -870,12 +871,39 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleValueIs(spinel_prop_k
 
         VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
+        if (mIsMultiChannelEnergyScan)
+        {
+            // The results are reported together once the RCP goes back to idle scan state.
+            VerifyOrExit(mNumEnergyScanResults < OT_ARRAY_LENGTH(mEnergyScanResults), error = OT_ERROR_NO_BUFS);
+            mEnergyScanResults[mNumEnergyScanResults].mChannel = scanChannel;
+            mEnergyScanResults[mNumEnergyScanResults].mMaxRssi = maxRssi;
+            mNumEnergyScanResults++;
+            ExitNow();
+        }
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
         mEnergyScanning = false;
 #endif
 
         otPlatRadioEnergyScanDone(mInstance, maxRssi);
     }
+    else if (aKey == SPINEL_PROP_MAC_SCAN_STATE)
+    {
+        uint8_t scanState;
+
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT8_S, &scanState);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        VerifyOrExit(mIsMultiChannelEnergyScan && (scanState == SPINEL_SCAN_STATE_IDLE));
+
+        mIsMultiChannelEnergyScan = false;
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        mEnergyScanning = false;
+#endif
+
+        otPlatRadioMultiChannelEnergyScanDone(mInstance, mEnergyScanResults, mNumEnergyScanResults);
+    }
     else if (aKey == SPINEL_PROP_STREAM_DEBUG)
     {
         char         logStream[OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE + 1];
@@ -1518,6 +1546,43 @@ exit:
     return error;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::MultiChannelEnergyScan(uint32_t aScanChannels,
+                                                                                uint16_t aScanDuration)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t channels[kChannelMaskBufferSize];
+    uint8_t numChannels = 0;
+
+    VerifyOrExit(mRadioCaps & OT_RADIO_CAPS_MULTI_ENERGY_SCAN, error = OT_ERROR_NOT_CAPABLE);
+
+    for (uint8_t channel = 0; channel < kChannelMaskBufferSize; channel++)
+    {
+        if (aScanChannels & (1UL << channel))
+        {
+            channels[numChannels++] = channel;
+        }
+    }
+
+    VerifyOrExit(numChannels > 0, error = OT_ERROR_INVALID_ARGS);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    mScanChannels   = aScanChannels;
+    mScanDuration   = aScanDuration;
+    mEnergyScanning = true;
+#endif
+
+    mIsMultiChannelEnergyScan = true;
+    mNumEnergyScanResults     = 0;
+
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_MASK, SPINEL_DATATYPE_DATA_S, channels, numChannels));
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_PERIOD, SPINEL_DATATYPE_UINT16_S, aScanDuration));
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_STATE, SPINEL_DATATYPE_UINT8_S, SPINEL_SCAN_STATE_ENERGY));
+
+exit:
+    return error;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::Get(spinel_prop_key_t aKey, const char *aFormat, ...)
 {
@@ -2261,7 +2326,14 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
 
     if (mEnergyScanning)
     {
-        SuccessOrDie(EnergyScan(mScanChannel, mScanDuration));
+        if (mIsMultiChannelEnergyScan)
+        {
+            SuccessOrDie(MultiChannelEnergyScan(mScanChannels, mScanDuration));
+        }
+        else
+        {
+            SuccessOrDie(EnergyScan(mScanChannel, mScanDuration));
+        }
     }
 
     --mRcpFailureCount;
@@ -1475,6 +1475,7 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         {SPINEL_PROP_CNTR_MLE_COUNTERS, "CNTR_MLE_COUNTERS"},
         {SPINEL_PROP_CNTR_ALL_IP_COUNTERS, "CNTR_ALL_IP_COUNTERS"},
         {SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM, "CNTR_MAC_RETRY_HISTOGRAM"},
+        {SPINEL_PROP_MSG_POOL_STATS, "MSG_POOL_STATS"},
         {SPINEL_PROP_NEST_STREAM_MFG, "NEST_STREAM_MFG"},
         {SPINEL_PROP_NEST_LEGACY_ULA_PREFIX, "NEST_LEGACY_ULA_PREFIX"},
         {SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED, "NEST_LEGACY_LAST_NODE_JOINED"},
@@ -1616,6 +1617,7 @@ const char *spinel_capability_to_cstr(spinel_capability_t capability)
         {SPINEL_CAP_SRP_CLIENT, "SRP_CLIENT"},
         {SPINEL_CAP_DUA, "DUA"},
         {SPINEL_CAP_REFERENCE_DEVICE, "REFERENCE_DEVICE"},
+        {SPINEL_CAP_MSG_POOL_STATS, "MSG_POOL_STATS"},
         {SPINEL_CAP_ERROR_RATE_TRACKING, "ERROR_RATE_TRACKING"},
         {SPINEL_CAP_THREAD_COMMISSIONER, "THREAD_COMMISSIONER"},
         {SPINEL_CAP_THREAD_TMF_PROXY, "THREAD_TMF_PROXY"},
@@ -1250,6 +1250,7 @@ enum
     SPINEL_CAP_SRP_CLIENT              = (SPINEL_CAP_OPENTHREAD__BEGIN + 14),
     SPINEL_CAP_DUA                     = (SPINEL_CAP_OPENTHREAD__BEGIN + 15),
     SPINEL_CAP_REFERENCE_DEVICE        = (SPINEL_CAP_OPENTHREAD__BEGIN + 16),
+    SPINEL_CAP_MSG_POOL_STATS          = (SPINEL_CAP_OPENTHREAD__BEGIN + 17),
     SPINEL_CAP_OPENTHREAD__END         = 640,
 
     SPINEL_CAP_THREAD__BEGIN          = 1024,
@@ -4661,6 +4662,35 @@ enum
      */
     SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM = SPINEL_PROP_CNTR__BEGIN + 404,
 
+    /// Message pool occupancy statistics.
+    /** Format: SSSSSS t(A(L)) t(A(S)) t(A(S)) t(A(S)) t(A(S)) t(A(L)) t(A(L))
+     *
+     * Required capability: SPINEL_CAP_MSG_POOL_STATS
+     *
+     * The contents are:
+     *
+     *      `S`, (BuffersInUse)             The number of buffers currently in use.
+     *      `S`, (MaxBuffersInUse)          The high-water mark of buffers in use.
+     *      `S`, (MessagesInUse)            The number of messages currently allocated.
+     *      `S`, (MaxMessagesInUse)         The high-water mark of allocated messages.
+     *      `S`, (6loSendQueueMaxMessages)  The high-water mark of messages in the 6LoWPAN send queue.
+     *      `S`, (Ip6SendQueueMaxMessages)  The high-water mark of messages in the IPv6 send queue.
+     *      `t(A(L))`, (AllocFailures)      Buffer allocation failures per priority (low, normal, high, net).
+     *      `t(A(S))`, (TypeMessages)       Messages currently allocated per message type.
+     *      `t(A(S))`, (MaxTypeMessages)    High-water mark of messages per message type.
+     *      `t(A(S))`, (SubTypeMessages)    Messages currently allocated per message sub type.
+     *      `t(A(S))`, (MaxSubTypeMessages) High-water mark of messages per message sub type.
+     *      `t(A(L))`, (BufferCountHist)    Histogram of buffers per freed message (1, 2, ..., the last bin holds
+     *                                      all larger counts).
+     *      `t(A(L))`, (LifetimeHist)       Histogram of lifetime of freed messages (<10ms, <100ms, <1s, <10s,
+     *                                      <100s, and larger).
+     *
+     * Writing to this property with any value would reset the statistics (high-water marks are set to the current
+     * values).
+     *
+     */
+    SPINEL_PROP_MSG_POOL_STATS = SPINEL_PROP_CNTR__BEGIN + 405,
+
     SPINEL_PROP_CNTR__END = 0x800,
 
     SPINEL_PROP_RCP_EXT__BEGIN = 0x800,
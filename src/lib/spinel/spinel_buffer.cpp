@@ -32,6 +32,8 @@
 
 #include "spinel_buffer.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -85,9 +87,10 @@ void Buffer::Clear(void)
     mReadPointer                   = mBuffer;
 
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-    mReadMessage       = nullptr;
-    mReadMessageOffset = 0;
-    mReadMessageTail   = mMessageBuffer;
+    mReadMessage        = nullptr;
+    mReadMessageOffset  = 0;
+    mReadMessagePointer = nullptr;
+    mReadMessageTail    = nullptr;
 
     // Free all messages in the queues.
 
@@ -621,7 +624,7 @@ exit:
 }
 
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-// This method prepares an associated message in current segment and fills the message buffer. It returns
+// This method prepares an associated message in current segment and gets its first chunk. It returns
 // ThreadError_NotFound if there is no message or if the message has no content.
 otError Buffer::OutFramePrepareMessage(void)
 {
@@ -643,8 +646,8 @@ otError Buffer::OutFramePrepareMessage(void)
     // Reset the offset for reading the message.
     mReadMessageOffset = 0;
 
-    // Fill the content from current message into the message buffer.
-    SuccessOrExit(error = OutFrameFillMessageBuffer());
+    // Get the first contiguous chunk of the current message.
+    SuccessOrExit(error = OutFrameGetMessageChunk());
 
     // If all successful, set the state to `InMessage`.
     mReadState = kReadStateInMessage;
@@ -653,35 +656,60 @@ exit:
     return error;
 }
 
-// This method fills content from current message into the message buffer. It returns OT_ERROR_NOT_FOUND if no more
-// content in the current message.
-otError Buffer::OutFrameFillMessageBuffer(void)
+// This method sets the message read pointer to the next contiguous chunk of the current message (directly in the
+// message buffers, without copying). It returns OT_ERROR_NOT_FOUND if no more content in the current message.
+otError Buffer::OutFrameGetMessageChunk(void)
 {
-    otError error = OT_ERROR_NONE;
-    int     readLength;
+    otError  error = OT_ERROR_NONE;
+    uint16_t length;
 
     VerifyOrExit(mReadMessage != nullptr, error = OT_ERROR_NOT_FOUND);
 
-    VerifyOrExit(mReadMessageOffset < otMessageGetLength(mReadMessage), error = OT_ERROR_NOT_FOUND);
-
-    // Read portion of current message from the offset into message buffer.
-    readLength = otMessageRead(mReadMessage, mReadMessageOffset, mMessageBuffer, sizeof(mMessageBuffer));
+    length = otMessageGetContiguousBytes(mReadMessage, mReadMessageOffset, &mReadMessagePointer);
 
-    VerifyOrExit(readLength > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(length > 0, error = OT_ERROR_NOT_FOUND);
 
-    // Update the message offset, set up the message tail, and set read pointer to start of message buffer.
+    // Update the message offset and set up the tail of the chunk.
 
-    mReadMessageOffset += readLength;
+    mReadMessageOffset += length;
 
-    mReadMessageTail = mMessageBuffer + readLength;
-
-    mReadPointer = mMessageBuffer;
+    mReadMessageTail = mReadMessagePointer + length;
 
 exit:
     return error;
 }
 #endif // #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
 
+// This method is called when the read pointer reaches the end of the current segment. It prepares any message
+// associated with the segment, or moves to the next segment (if any).
+void Buffer::OutFrameHandleSegmentEnd(void)
+{
+    otError error;
+
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+    error = OutFramePrepareMessage();
+#else
+    error = OT_ERROR_NOT_FOUND;
+#endif
+
+    if (error != OT_ERROR_NONE)
+    {
+        IgnoreError(OutFramePrepareSegment());
+    }
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+// This method is called when the read pointer reaches the end of the current message chunk. It gets the next chunk
+// of the message, or moves to the next segment (if any).
+void Buffer::OutFrameHandleMessageChunkEnd(void)
+{
+    if (OutFrameGetMessageChunk() != OT_ERROR_NONE)
+    {
+        IgnoreError(OutFramePrepareSegment());
+    }
+}
+#endif // #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+
 otError Buffer::OutFrameBegin(void)
 {
     otError error = OT_ERROR_NONE;
@@ -711,7 +739,6 @@ bool Buffer::OutFrameHasEnded(void)
 
 uint8_t Buffer::OutFrameReadByte(void)
 {
-    otError error;
     uint8_t retval = kReadByteAfterFrameHasEnded;
 
     switch (mReadState)
@@ -734,56 +761,115 @@ uint8_t Buffer::OutFrameReadByte(void)
         // Check if at end of current segment.
         if (mReadPointer == mReadSegmentTail)
         {
+            OutFrameHandleSegmentEnd();
+        }
+
+        break;
+
+    case kReadStateInMessage:
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-            // Prepare any message associated with this segment.
-            error = OutFramePrepareMessage();
-#else
-            error = OT_ERROR_NOT_FOUND;
+        // Read a byte from current message read pointer and move the pointer by 1 byte.
+        retval = *mReadMessagePointer;
+        mReadMessagePointer++;
+
+        // Check if at the end of current message chunk.
+        if (mReadMessagePointer == mReadMessageTail)
+        {
+            OutFrameHandleMessageChunkEnd();
+        }
 #endif
+        break;
+    }
 
-            // If there is no message, move to next segment (if any).
-            if (error != OT_ERROR_NONE)
-            {
-                IgnoreError(OutFramePrepareSegment());
-            }
+    return retval;
+}
+
+const uint8_t *Buffer::OutFrameReadChunk(uint16_t &aLength)
+{
+    const uint8_t *chunk  = nullptr;
+    uint16_t       length = 0;
+
+    switch (mReadState)
+    {
+    case kReadStateNotActive:
+        OT_FALL_THROUGH;
+
+    case kReadStateDone:
+        break;
+
+    case kReadStateInSegment:
+
+        chunk = mReadPointer;
+
+        if (mReadDirection == kForward)
+        {
+            // The bytes of a forward segment are stored in order, and are contiguous up to the segment tail or
+            // the end of `mBuffer` (whichever comes first).
+            length = static_cast<uint16_t>(((mReadSegmentTail > mReadPointer) ? mReadSegmentTail : mBufferEnd) -
+                                           mReadPointer);
+        }
+        else
+        {
+            // The bytes of a backward (high priority) segment are stored in reverse order, so they are read one at a
+            // time.
+            length = 1;
+        }
+
+        if (length > aLength)
+        {
+            length = aLength;
+        }
+
+        mReadPointer = GetUpdatedBufPtr(mReadPointer, length, mReadDirection);
+
+        if (mReadPointer == mReadSegmentTail)
+        {
+            OutFrameHandleSegmentEnd();
         }
 
         break;
 
     case kReadStateInMessage:
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-        // Read a byte from current read pointer and move the read pointer by 1 byte.
-        retval = *mReadPointer;
-        mReadPointer++;
+        chunk  = mReadMessagePointer;
+        length = static_cast<uint16_t>(mReadMessageTail - mReadMessagePointer);
 
-        // Check if at the end of content in message buffer.
-        if (mReadPointer == mReadMessageTail)
+        if (length > aLength)
         {
-            // Fill more bytes from current message into message buffer.
-            error = OutFrameFillMessageBuffer();
+            length = aLength;
+        }
 
-            // If no more bytes in the message, move to next segment (if any).
-            if (error != OT_ERROR_NONE)
-            {
-                IgnoreError(OutFramePrepareSegment());
-            }
+        mReadMessagePointer += length;
+
+        if (mReadMessagePointer == mReadMessageTail)
+        {
+            OutFrameHandleMessageChunkEnd();
         }
 #endif
         break;
     }
 
-    return retval;
+    aLength = length;
+
+    return (length > 0) ? chunk : nullptr;
 }
 
 uint16_t Buffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
     uint16_t bytesRead = 0;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while (bytesRead < aReadLength)
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        uint16_t       length = aReadLength - bytesRead;
+        const uint8_t *chunk  = OutFrameReadChunk(length);
+
+        VerifyOrExit(chunk != nullptr);
+
+        memcpy(aDataBuffer + bytesRead, chunk, length);
+        bytesRead += length;
     }
 
+exit:
     return bytesRead;
 }
 
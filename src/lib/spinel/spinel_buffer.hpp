@@ -379,6 +379,22 @@ public:
      */
     uint8_t OutFrameReadByte(void);
 
+    /**
+     * This method reads the next contiguous chunk of bytes from the current output frame without copying them.
+     *
+     * The NCP buffer maintains a read offset for the current output frame being read. This method returns a pointer to
+     * the bytes at the read offset which are stored contiguously (either in the NCP buffer itself or in one of the
+     * buffers of an `otMessage` added using `InFrameFeedMessage()`) and moves the read offset forward past them. The
+     * returned bytes remain valid until the frame is removed using `OutFrameRemove()`.
+     *
+     * @param[inout] aLength  On input, the maximum number of bytes to read. On output, the number of bytes read.
+     *
+     * @returns A pointer to the chunk, or `nullptr` (with @p aLength set to zero) if the current output frame has
+     *          ended or there is no prepared/active output frame.
+     *
+     */
+    const uint8_t *OutFrameReadChunk(uint16_t &aLength);
+
     /**
      * This method reads and copies bytes from the current output frame into a given buffer.
      *
@@ -568,7 +584,6 @@ private:
     enum
     {
         kReadByteAfterFrameHasEnded = 0,      // Value returned by ReadByte() when frame has ended.
-        kMessageReadBufferSize      = 16,     // Size of message buffer array `mMessageBuffer`.
         kUnknownFrameLength         = 0xffff, // Value used when frame length is unknown.
         kSegmentHeaderSize          = 2,      // Length of the segment header.
         kSegmentHeaderLengthMask    = 0x3fff, // Bit mask to get the length from the segment header
@@ -613,11 +628,12 @@ private:
 
     void    OutFrameSelectReadDirection(void);
     otError OutFramePrepareSegment(void);
-    void    OutFrameMoveToNextSegment(void);
+    void    OutFrameHandleSegmentEnd(void);
 
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
     otError OutFramePrepareMessage(void);
-    otError OutFrameFillMessageBuffer(void);
+    otError OutFrameGetMessageChunk(void);
+    void    OutFrameHandleMessageChunkEnd(void);
 #endif
 
     uint8_t *const mBuffer;       // Pointer to the buffer used to store the data.
@@ -642,15 +658,15 @@ private:
     uint8_t *mReadFrameStart[kNumPrios]; // Pointer to start of current frame being read.
     uint8_t *mReadSegmentHead;           // Pointer to start of current segment in the frame being read.
     uint8_t *mReadSegmentTail;           // Pointer to end of current segment in the frame being read.
-    uint8_t *mReadPointer;               // Pointer to next byte to read (either in segment or in msg buffer).
+    uint8_t *mReadPointer;               // Pointer to next byte to read in current segment.
 
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-    otMessageQueue mWriteFrameMessageQueue;                // Message queue for the current frame being written.
-    otMessageQueue mMessageQueue[kNumPrios];               // Main message queues.
-    otMessage *    mReadMessage;                           // Current Message in the frame being read.
-    uint16_t       mReadMessageOffset;                     // Offset within current message being read.
-    uint8_t        mMessageBuffer[kMessageReadBufferSize]; // Buffer to hold part of current message being read.
-    uint8_t *      mReadMessageTail;                       // Pointer to end of current part in mMessageBuffer.
+    otMessageQueue mWriteFrameMessageQueue;  // Message queue for the current frame being written.
+    otMessageQueue mMessageQueue[kNumPrios]; // Main message queues.
+    otMessage *    mReadMessage;             // Current Message in the frame being read.
+    uint16_t       mReadMessageOffset;       // Offset within current message (end of current chunk).
+    const uint8_t *mReadMessagePointer;      // Pointer to next byte to read in current message chunk.
+    const uint8_t *mReadMessageTail;         // Pointer to end of current message chunk.
 #endif
 };
 
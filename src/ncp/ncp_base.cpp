@@ -58,25 +58,6 @@ namespace Ncp {
 // MARK: Utility Functions
 // ----------------------------------------------------------------------------
 
-#if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
-static bool HasOnly1BitSet(uint32_t aValue)
-{
-    return aValue != 0 && ((aValue & (aValue - 1)) == 0);
-}
-
-static uint8_t IndexOfMSB(uint32_t aValue)
-{
-    uint8_t index = 0;
-
-    while (aValue >>= 1)
-    {
-        index++;
-    }
-
-    return index;
-}
-#endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
-
 spinel_status_t NcpBase::ThreadErrorToSpinelStatus(otError aError)
 {
     spinel_status_t ret;
@@ -246,6 +227,7 @@ NcpBase::NcpBase(Instance *aInstance)
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
     , mCurTransmitTID(0)
     , mCurScanChannel(kInvalidScanChannel)
+    , mPendingScanChannels(0)
     , mSrcMatchEnabled(false)
 #endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -1626,6 +1608,33 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SCAN_STATE>(void)
     return mEncoder.WriteUint8(scanState);
 }
 
+#if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
+otError NcpBase::StartLinkRawEnergyScan(void)
+{
+    uint8_t scanChannel = 0;
+    otError error;
+
+    // Scan the channels in increasing order.
+    while ((mPendingScanChannels & (1UL << scanChannel)) == 0)
+    {
+        scanChannel++;
+    }
+
+    mPendingScanChannels &= ~(1UL << scanChannel);
+    mCurScanChannel = static_cast<int8_t>(scanChannel);
+
+    error = otLinkRawEnergyScan(mInstance, scanChannel, mScanPeriod, LinkRawEnergyScanDone);
+
+    if (error != OT_ERROR_NONE)
+    {
+        mCurScanChannel      = kInvalidScanChannel;
+        mPendingScanChannels = 0;
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
+
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_STATE>(void)
 {
     uint8_t state = 0;
@@ -1650,17 +1659,15 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_STATE>(void)
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
         if (otLinkRawIsEnabled(mInstance))
         {
-            uint8_t scanChannel;
-
-            // Make sure we aren't already scanning and that we have
-            // only 1 bit set for the channel mask.
+            // Make sure we aren't already scanning and that we have at
+            // least one channel in the mask. The channels are scanned
+            // one after the other and the scan state goes back to idle
+            // after the last one.
             VerifyOrExit(mCurScanChannel == kInvalidScanChannel, error = OT_ERROR_INVALID_STATE);
-            VerifyOrExit(HasOnly1BitSet(mScanChannelMask), error = OT_ERROR_INVALID_ARGS);
-
-            scanChannel     = IndexOfMSB(mScanChannelMask);
-            mCurScanChannel = static_cast<int8_t>(scanChannel);
+            VerifyOrExit(mScanChannelMask != 0, error = OT_ERROR_INVALID_ARGS);
 
-            error = otLinkRawEnergyScan(mInstance, scanChannel, mScanPeriod, LinkRawEnergyScanDone);
+            mPendingScanChannels = mScanChannelMask;
+            error                = StartLinkRawEnergyScan();
         }
         else
 #endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
@@ -1888,6 +1895,10 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MAC_RETRY_HISTOGRAM));
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MSG_POOL_STATS));
+#endif
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_PEEK_POKE));
 #endif
@@ -285,6 +285,7 @@ protected:
 
     static void LinkRawEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
     void        LinkRawEnergyScanDone(int8_t aEnergyScanMaxRssi);
+    otError     StartLinkRawEnergyScan(void);
 
 #endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 
@@ -623,9 +624,10 @@ protected:
 #endif
 
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
-    uint8_t mCurTransmitTID;
-    int8_t  mCurScanChannel;
-    bool    mSrcMatchEnabled;
+    uint8_t  mCurTransmitTID;
+    int8_t   mCurScanChannel;
+    uint32_t mPendingScanChannels;
+    bool     mSrcMatchEnabled;
 #endif // OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
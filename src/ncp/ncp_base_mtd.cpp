@@ -2883,6 +2883,82 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_MAC_RETRY_HISTOG
 }
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_POOL_STATS>(void)
+{
+    otError            error = OT_ERROR_NONE;
+    otMessagePoolStats stats;
+
+    otMessageGetPoolStats(mInstance, &stats);
+
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.mBuffersInUse));
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.mMaxBuffersInUse));
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.mMessagesInUse));
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.mMaxMessagesInUse));
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.m6loSendQueueMaxMessages));
+    SuccessOrExit(error = mEncoder.WriteUint16(stats.mIp6SendQueueMaxMessages));
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint32_t count : stats.mAllocFailures)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint32(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint16_t count : stats.mTypeMessages)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint16_t count : stats.mMaxTypeMessages)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint16_t count : stats.mSubTypeMessages)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint16_t count : stats.mMaxSubTypeMessages)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint32_t count : stats.mBufferCountHistogram)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint32(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    for (uint32_t count : stats.mLifetimeHistogram)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint32(count));
+    }
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MSG_POOL_STATS>(void)
+{
+    otMessageResetPoolStats(mInstance);
+
+    return OT_ERROR_NONE;
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_ALL_IP_COUNTERS>(void)
 {
     otThreadResetIp6Counters(mInstance);
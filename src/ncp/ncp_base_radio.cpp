@@ -206,6 +206,9 @@ void NcpBase::LinkRawEnergyScanDone(int8_t aEnergyScanMaxRssi)
     SuccessOrExit(mEncoder.WriteInt8(aEnergyScanMaxRssi));
     SuccessOrExit(mEncoder.EndFrame());
 
+    // Continue with the next channel of a multi-channel scan.
+    VerifyOrExit((mPendingScanChannels == 0) || (StartLinkRawEnergyScan() != OT_ERROR_NONE));
+
     // We are finished with the scan, so send out
     // a property update indicating such.
     SuccessOrExit(mEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUE_IS,
@@ -220,7 +223,16 @@ exit:
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_RADIO_CAPS>(void)
 {
-    return mEncoder.WriteUintPacked(otLinkRawGetCaps(mInstance));
+    otRadioCaps caps = otLinkRawGetCaps(mInstance);
+
+    // Energy scan of multiple channels is handled by NCP scanning the
+    // channels one after the other.
+    if (caps & OT_RADIO_CAPS_ENERGY_SCAN)
+    {
+        caps |= OT_RADIO_CAPS_MULTI_ENERGY_SCAN;
+    }
+
+    return mEncoder.WriteUintPacked(caps);
 }
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SRC_MATCH_ENABLED>(void)
@@ -85,7 +85,8 @@ NcpHdlc::NcpHdlc(Instance *aInstance, otNcpHdlcSendCallback aSendCallback)
     , mFrameEncoder(mHdlcBuffer)
     , mFrameDecoder(mRxBuffer, &NcpHdlc::HandleFrame, this)
     , mState(kStartingFrame)
-    , mByte(0)
+    , mTxChunk(nullptr)
+    , mTxChunkLength(0)
     , mHdlcSendImmediate(false)
     , mHdlcSendTask(*aInstance, EncodeAndSend)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -154,13 +155,18 @@ void NcpHdlc::EncodeAndSend(void)
 
             while (!txFrameBuffer.OutFrameHasEnded())
             {
-                mByte = txFrameBuffer.OutFrameReadByte();
+                // Encode directly from the frame content (NCP buffer or message buffers) one chunk at a time.
+                mTxChunkLength = kTxChunkMaxLength;
+                mTxChunk       = txFrameBuffer.OutFrameReadChunk(mTxChunkLength);
 
                 OT_FALL_THROUGH;
 
             case kEncodingFrame:
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte));
+                for (; mTxChunkLength > 0; mTxChunk++, mTxChunkLength--)
+                {
+                    SuccessOrExit(mFrameEncoder.Encode(*mTxChunk));
+                }
             }
 
             // track the change of mHostPowerStateInProgress by the
@@ -352,9 +358,18 @@ bool NcpHdlc::BufferEncrypterReader::OutFrameHasEnded(void)
     return (mDataBufferReadIndex >= mOutputDataLength);
 }
 
-uint8_t NcpHdlc::BufferEncrypterReader::OutFrameReadByte(void)
+const uint8_t *NcpHdlc::BufferEncrypterReader::OutFrameReadChunk(uint16_t &aLength)
 {
-    return mDataBuffer[mDataBufferReadIndex++];
+    const uint8_t *chunk = &mDataBuffer[mDataBufferReadIndex];
+
+    if (aLength > mOutputDataLength - mDataBufferReadIndex)
+    {
+        aLength = static_cast<uint16_t>(mOutputDataLength - mDataBufferReadIndex);
+    }
+
+    mDataBufferReadIndex += aLength;
+
+    return chunk;
 }
 
 otError NcpHdlc::BufferEncrypterReader::OutFrameRemove(void)
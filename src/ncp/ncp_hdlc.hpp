@@ -74,6 +74,7 @@ private:
     enum
     {
         kHdlcTxBufferSize = OPENTHREAD_CONFIG_NCP_HDLC_TX_CHUNK_SIZE,   // HDLC tx buffer size.
+        kTxChunkMaxLength = 0xffff,                                     // Max length of a frame chunk to encode.
         kRxBufferSize     = OPENTHREAD_CONFIG_NCP_HDLC_RX_BUFFER_SIZE + // Rx buffer size (should be large enough to fit
                         OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE, // one whole (decoded) received frame).
     };
@@ -98,11 +99,11 @@ private:
          * Takes a reference to Spinel::Buffer in order to read spinel frames.
          */
         explicit BufferEncrypterReader(Spinel::Buffer &aTxFrameBuffer);
-        bool    IsEmpty(void) const;
-        otError OutFrameBegin(void);
-        bool    OutFrameHasEnded(void);
-        uint8_t OutFrameReadByte(void);
-        otError OutFrameRemove(void);
+        bool           IsEmpty(void) const;
+        otError        OutFrameBegin(void);
+        bool           OutFrameHasEnded(void);
+        const uint8_t *OutFrameReadChunk(uint16_t &aLength);
+        otError        OutFrameRemove(void);
 
     private:
         void Reset(void);
@@ -132,7 +133,8 @@ private:
     Hdlc::Decoder                        mFrameDecoder;
     Hdlc::FrameBuffer<kHdlcTxBufferSize> mHdlcBuffer;
     HdlcTxState                          mState;
-    uint8_t                              mByte;
+    const uint8_t *                      mTxChunk;
+    uint16_t                             mTxChunkLength;
     Hdlc::FrameBuffer<kRxBufferSize>     mRxBuffer;
     bool                                 mHdlcSendImmediate;
     Tasklet                              mHdlcSendTask;
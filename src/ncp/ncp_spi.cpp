@@ -82,6 +82,7 @@ NcpSpi::NcpSpi(Instance *aInstance)
     , mTxState(kTxStateIdle)
     , mHandlingRxFrame(false)
     , mResetFlag(true)
+    , mHostSupportsMultiFrame(false)
     , mPrepareTxFrameTask(*aInstance, NcpSpi::PrepareTxFrame)
     , mSendFrameLength(0)
 {
@@ -93,11 +94,15 @@ NcpSpi::NcpSpi(Instance *aInstance)
     sendFrame.SetHeaderAcceptLen(0);
     sendFrame.SetHeaderDataLen(0);
 
+    // Frames with no data advertise that we can receive packed frames.
+
     emptyFullAccept.SetHeaderFlagByte(/* aResetFlag */ true);
+    emptyFullAccept.SetHeaderMultiFrameFlag(true);
     emptyFullAccept.SetHeaderAcceptLen(kSpiBufferSize - kSpiHeaderSize);
     emptyFullAccept.SetHeaderDataLen(0);
 
     emptyZeroAccept.SetHeaderFlagByte(/* aResetFlag */ true);
+    emptyZeroAccept.SetHeaderMultiFrameFlag(true);
     emptyZeroAccept.SetHeaderAcceptLen(0);
     emptyZeroAccept.SetHeaderDataLen(0);
 
@@ -150,6 +155,19 @@ bool NcpSpi::SpiTransactionComplete(uint8_t *aOutputBuf,
 
     transDataLen = aTransLen - kSpiHeaderSize;
 
+    // Track whether the host can receive packed frames. A host
+    // that has reset needs to advertise it again.
+
+    if (inputFrame.IsResetFlagSet())
+    {
+        mHostSupportsMultiFrame = false;
+    }
+
+    if (inputFrame.IsMultiFrameFlagSet())
+    {
+        mHostSupportsMultiFrame = true;
+    }
+
     if (!mHandlingRxFrame)
     {
         uint16_t rxDataLen = inputFrame.GetHeaderDataLen();
@@ -188,10 +206,15 @@ exit:
 
     if (mResetFlag && (aTransLen > 0) && (aOutputLen > 0))
     {
+        bool isPacked = sendFrame.IsMultiFrameFlagSet();
+
         mResetFlag = false;
         sendFrame.SetHeaderFlagByte(/*aResetFlag */ false);
+        sendFrame.SetHeaderMultiFrameFlag(isPacked);
         SpiFrame(mEmptySendFrameFullAccept).SetHeaderFlagByte(/*aResetFlag */ false);
+        SpiFrame(mEmptySendFrameFullAccept).SetHeaderMultiFrameFlag(true);
         SpiFrame(mEmptySendFrameZeroAccept).SetHeaderFlagByte(/*aResetFlag */ false);
+        SpiFrame(mEmptySendFrameZeroAccept).SetHeaderMultiFrameFlag(true);
     }
 
     if (mTxState == kTxStateSending)
@@ -256,35 +279,22 @@ void NcpSpi::HandleFrameAddedToTxBuffer(void *                   aContext,
 
 void NcpSpi::PrepareNextSpiSendFrame(void)
 {
-    otError  error = OT_ERROR_NONE;
-    uint16_t frameLength;
-    uint16_t readLength;
-    SpiFrame sendFrame(mSendFrame);
+    otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(!mTxFrameBuffer.IsEmpty());
+    // `mSendFrame` may still hold frames from an earlier attempt
+    // which failed to prepare the transaction.
 
-    if (ShouldWakeHost())
+    if (mSendFrameLength == 0)
     {
-        otPlatWakeHost();
-    }
-
-    SuccessOrExit(error = mTxFrameBuffer.OutFrameBegin());
-
-    frameLength = mTxFrameBuffer.OutFrameGetLength();
-    OT_ASSERT(frameLength <= kSpiBufferSize - kSpiHeaderSize);
-
-    // The "accept length" in `mSendFrame` is already updated based
-    // on current state of receive. It is changed either from the
-    // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
-
-    readLength = mTxFrameBuffer.OutFrameRead(frameLength, sendFrame.GetData());
-    OT_ASSERT(readLength == frameLength);
+        VerifyOrExit(!mTxFrameBuffer.IsEmpty());
 
-    // Suppress the warning when assertions are disabled
-    OT_UNUSED_VARIABLE(readLength);
+        if (ShouldWakeHost())
+        {
+            otPlatWakeHost();
+        }
 
-    sendFrame.SetHeaderDataLen(frameLength);
-    mSendFrameLength = frameLength + kSpiHeaderSize;
+        FillSpiSendFrame();
+    }
 
     mTxState = kTxStateSending;
 
@@ -307,12 +317,72 @@ void NcpSpi::PrepareNextSpiSendFrame(void)
         ExitNow();
     }
 
-    IgnoreError(mTxFrameBuffer.OutFrameRemove());
-
 exit:
     return;
 }
 
+void NcpSpi::FillSpiSendFrame(void)
+{
+    // This method reads frames from the tx frame buffer into
+    // `mSendFrame`. If the host can receive packed frames, as many
+    // frames as fit are packed (each preceded by its length) into
+    // the data of a single SPI frame. Otherwise, only the front
+    // frame is read.
+
+    SpiFrame sendFrame(mSendFrame);
+    uint8_t *data       = sendFrame.GetData();
+    uint16_t dataLength = 0;
+    bool     isPacked   = mHostSupportsMultiFrame;
+
+    // The "accept length" in `mSendFrame` is already updated based
+    // on current state of receive. It is changed either from the
+    // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
+
+    while (mTxFrameBuffer.OutFrameBegin() == OT_ERROR_NONE)
+    {
+        uint16_t frameLength = mTxFrameBuffer.OutFrameGetLength();
+        uint16_t readLength;
+
+        OT_ASSERT(frameLength <= kSpiBufferSize - kSpiHeaderSize);
+
+        if (isPacked && (dataLength + SpiFrame::kPackedLengthSize + frameLength > kSpiBufferSize - kSpiHeaderSize))
+        {
+            // A frame too large to be packed is sent on its own.
+            if (dataLength > 0)
+            {
+                break;
+            }
+
+            isPacked = false;
+        }
+
+        if (isPacked)
+        {
+            Encoding::LittleEndian::WriteUint16(frameLength, data + dataLength);
+            dataLength += SpiFrame::kPackedLengthSize;
+        }
+
+        readLength = mTxFrameBuffer.OutFrameRead(frameLength, data + dataLength);
+        OT_ASSERT(readLength == frameLength);
+
+        // Suppress the warning when assertions are disabled
+        OT_UNUSED_VARIABLE(readLength);
+
+        dataLength += frameLength;
+
+        IgnoreError(mTxFrameBuffer.OutFrameRemove());
+
+        if (!isPacked)
+        {
+            break;
+        }
+    }
+
+    sendFrame.SetHeaderMultiFrameFlag(isPacked);
+    sendFrame.SetHeaderDataLen(dataLength);
+    mSendFrameLength = dataLength + kSpiHeaderSize;
+}
+
 void NcpSpi::PrepareTxFrame(Tasklet &aTasklet)
 {
     OT_UNUSED_VARIABLE(aTasklet);
@@ -324,7 +394,8 @@ void NcpSpi::PrepareTxFrame(void)
     switch (mTxState)
     {
     case kTxStateHandlingSendDone:
-        mTxState = kTxStateIdle;
+        mTxState         = kTxStateIdle;
+        mSendFrameLength = 0;
 
         OT_FALL_THROUGH;
         // to next case to prepare the next frame (if any).
@@ -346,8 +417,37 @@ void NcpSpi::HandleRxFrame(void)
     SpiFrame recvFrame(mReceiveFrame);
     SpiFrame sendFrame(mSendFrame);
 
-    // Pass the received frame to base class to process.
-    HandleReceive(recvFrame.GetData(), recvFrame.GetHeaderDataLen());
+    if (recvFrame.IsMultiFrameFlagSet())
+    {
+        // The data is packed as a sequence of frames, each preceded
+        // by its length. Pass each frame to base class to process.
+
+        const uint8_t *data       = recvFrame.GetData();
+        uint16_t       dataLength = recvFrame.GetHeaderDataLen();
+
+        while (dataLength >= SpiFrame::kPackedLengthSize)
+        {
+            uint16_t frameLength = Encoding::LittleEndian::ReadUint16(data);
+
+            data += SpiFrame::kPackedLengthSize;
+            dataLength -= SpiFrame::kPackedLengthSize;
+
+            if (frameLength > dataLength)
+            {
+                break;
+            }
+
+            HandleReceive(data, frameLength);
+
+            data += frameLength;
+            dataLength -= frameLength;
+        }
+    }
+    else
+    {
+        // Pass the received frame to base class to process.
+        HandleReceive(recvFrame.GetData(), recvFrame.GetHeaderDataLen());
+    }
 
     // The order of operations below is important. We should clear
     // the `mHandlingRxFrame` before checking `mTxState` and possibly
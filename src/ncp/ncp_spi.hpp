@@ -62,7 +62,7 @@
  *
  *                       0   1   2   3   4   5   6   7
  *                     +---+---+---+---+---+---+---+---+
- *                     |RST|CRC|CCF|  RESERVED |PATTERN|
+ *                     |RST|CRC|CCF|MLT|RESERVED|PATTERN|
  *                     +---+---+---+---+---+---+---+---+
  *
  *   -  "RST": This bit is set when that device has been reset since the
@@ -73,6 +73,13 @@
  *   -  "CCF": "CRC Check Failure".  Set if the CRC check on the last
  *      received frame failed, cleared to zero otherwise.  This bit is
  *      only used if both sides support CRC.
+ *   -  "MLT": "Multi-frame".  In a frame with no data, this bit is set
+ *      when that device can receive multiple frames packed in the data of
+ *      a single SPI frame.  In a frame with data, it indicates that the
+ *      data is packed as a sequence of frames, each preceded by its
+ *      16-bit length (Little Endian).  A device MUST NOT send packed data
+ *      before it has seen this bit set in a frame from the other device
+ *      since that device last reset.
  *   -  "RESERVED": These bits are all reserved for future used.  They
  *      MUST be cleared to zero and MUST be ignored if set.
  *   -  "PATTERN": These bits are set to a fixed value to help distinguish
@@ -131,7 +138,8 @@ class SpiFrame
 public:
     enum
     {
-        kHeaderSize = 5, ///< SPI header size (in bytes).
+        kHeaderSize       = 5, ///< SPI header size (in bytes).
+        kPackedLengthSize = 2, ///< Size of the length preceding each frame in packed data (in bytes).
     };
 
     /**
@@ -179,6 +187,30 @@ public:
      */
     void SetHeaderFlagByte(bool aResetFlag) { mBuffer[kIndexFlagByte] = kFlagPattern | (aResetFlag ? kFlagReset : 0); }
 
+    /**
+     * This method indicates whether or not the "MLT" (multi-frame) bit is set in the frame header.
+     *
+     * In a frame with no data, the bit indicates that the sender can receive packed frames. In a frame with data, it
+     * indicates that the data is packed as a sequence of frames, each preceded by its length.
+     *
+     * @retval TRUE   If the multi-frame flag is set.
+     * @retval FALSE  If the multi-frame flag is not set.
+     *
+     */
+    bool IsMultiFrameFlagSet(void) const { return ((mBuffer[kIndexFlagByte] & kFlagMultiFrame) == kFlagMultiFrame); }
+
+    /**
+     * This method sets or clears the "MLT" (multi-frame) bit in the frame header.
+     *
+     * @param[in] aMultiFrameFlag   The multi-frame flag.
+     *
+     */
+    void SetHeaderMultiFrameFlag(bool aMultiFrameFlag)
+    {
+        mBuffer[kIndexFlagByte] = static_cast<uint8_t>((mBuffer[kIndexFlagByte] & ~kFlagMultiFrame) |
+                                                       (aMultiFrameFlag ? kFlagMultiFrame : 0));
+    }
+
     /**
      * This method gets the "flag byte" field in the SPI frame header.
      *
@@ -234,6 +266,7 @@ private:
         kIndexDataLen   = 3, // data len   (uint16_t little-endian encoding).
 
         kFlagReset       = (1 << 7), // Flag byte RESET bit.
+        kFlagMultiFrame  = (1 << 4), // Flag byte MLT (multi-frame) bit.
         kFlagPattern     = 0x02,     // Flag byte PATTERN bits.
         kFlagPatternMask = 0x03,     // Flag byte PATTERN mask.
     };
@@ -302,10 +335,12 @@ private:
     void        PrepareTxFrame(void);
     void        HandleRxFrame(void);
     void        PrepareNextSpiSendFrame(void);
+    void        FillSpiSendFrame(void);
 
     volatile TxState mTxState;
     volatile bool    mHandlingRxFrame;
     volatile bool    mResetFlag;
+    volatile bool    mHostSupportsMultiFrame;
 
     Tasklet mPrepareTxFrameTask;
 
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary log file writer.
+ */
+
+#include "posix/platform/binary_log_writer.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <openthread/logging.h>
+
+#include "platform-posix.h"
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+// The file starts with a magic and a format version, followed by the records as returned by `otLoggingReadBinary()`.
+static const uint8_t kFileHeader[] = {'O', 'T', 'B', 'L', 1};
+
+void BinaryLogWriter::Init(const char *aPath)
+{
+    mLength = 0;
+    mOffset = 0;
+    mFd     = open(aPath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    VerifyOrDie(mFd != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(write(mFd, kFileHeader, sizeof(kFileHeader)) == sizeof(kFileHeader), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(fcntl(mFd, F_SETFL, fcntl(mFd, F_GETFL) | O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+
+    Mainloop::Manager::Get().Add(*this);
+}
+
+void BinaryLogWriter::Deinit(void)
+{
+    VerifyOrExit(mFd != -1);
+
+    Mainloop::Manager::Get().Remove(*this);
+
+    VerifyOrDie(fcntl(mFd, F_SETFL, fcntl(mFd, F_GETFL) & ~O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+
+    do
+    {
+        Flush();
+
+        if (mOffset == mLength)
+        {
+            mLength = otLoggingReadBinary(mBuffer, sizeof(mBuffer));
+            mOffset = 0;
+        }
+    } while (mOffset < mLength);
+
+    close(mFd);
+    mFd = -1;
+
+exit:
+    return;
+}
+
+void BinaryLogWriter::Update(otSysMainloopContext &aContext)
+{
+    if (mOffset == mLength)
+    {
+        mLength = otLoggingReadBinary(mBuffer, sizeof(mBuffer));
+        mOffset = 0;
+    }
+
+    VerifyOrExit(mOffset < mLength);
+
+    FD_SET(mFd, &aContext.mWriteFdSet);
+
+    if (aContext.mMaxFd < mFd)
+    {
+        aContext.mMaxFd = mFd;
+    }
+
+exit:
+    return;
+}
+
+void BinaryLogWriter::Process(const otSysMainloopContext &aContext)
+{
+    if (FD_ISSET(mFd, &aContext.mWriteFdSet))
+    {
+        Flush();
+    }
+}
+
+void BinaryLogWriter::Flush(void)
+{
+    ssize_t rval;
+
+    VerifyOrExit(mOffset < mLength);
+
+    rval = write(mFd, &mBuffer[mOffset], mLength - mOffset);
+
+    if (rval > 0)
+    {
+        mOffset += static_cast<uint16_t>(rval);
+    }
+    else if (rval == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+
+exit:
+    return;
+}
+
+BinaryLogWriter &BinaryLogWriter::Get(void)
+{
+    static BinaryLogWriter sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary log file writer.
+ */
+
+#ifndef OT_POSIX_PLATFORM_BINARY_LOG_WRITER_HPP_
+#define OT_POSIX_PLATFORM_BINARY_LOG_WRITER_HPP_
+
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class drains the binary log ring buffer into a file.
+ *
+ * The file is opened in non-blocking mode and is only written when `select()` reports it writable, so a slow log
+ * destination (e.g., a FIFO read by a decoder) never stalls the stack. Records produced while the writer is behind
+ * are dropped by the ring buffer and counted.
+ *
+ */
+class BinaryLogWriter : public Mainloop::Source, private NonCopyable
+{
+public:
+    /**
+     * This method opens the log file and registers the writer in the mainloop.
+     *
+     * @param[in]  aPath  The path of the log file.
+     *
+     */
+    void Init(const char *aPath);
+
+    /**
+     * This method flushes pending records and closes the log file.
+     *
+     */
+    void Deinit(void);
+
+    void Update(otSysMainloopContext &aContext) override;
+    void Process(const otSysMainloopContext &aContext) override;
+
+    /**
+     * This function returns the binary log writer singleton.
+     *
+     * @returns A reference to the binary log writer singleton.
+     *
+     */
+    static BinaryLogWriter &Get(void);
+
+private:
+    enum : uint16_t
+    {
+        kBufferSize = 2048,
+    };
+
+    void Flush(void);
+
+    int      mFd = -1;
+    uint16_t mLength;
+    uint16_t mOffset;
+    uint8_t  mBuffer[kBufferSize];
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#endif // OT_POSIX_PLATFORM_BINARY_LOG_WRITER_HPP_
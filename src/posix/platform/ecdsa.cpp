@@ -0,0 +1,278 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ECDSA signature verification worker.
+ */
+
+#include "openthread-posix-config.h"
+#include "platform-posix.h"
+
+#if OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+
+#if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#error "OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE is required for OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <openthread/crypto.h>
+#include <openthread/platform/ecdsa.h>
+
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class verifies ECDSA signatures in a worker thread.
+ *
+ * Requests are queued in a fixed size ring and verified in order by a single worker thread. Completed requests are
+ * signaled through a pipe watched by the mainloop, and reported with `otPlatEcdsaVerifyDone()` from the mainloop
+ * context.
+ *
+ */
+class EcdsaVerifier : public Mainloop::Source, private NonCopyable
+{
+public:
+    otError Queue(otInstance *              aInstance,
+                  uint32_t                  aRequestId,
+                  const uint8_t *           aPublicKey,
+                  const otCryptoSha256Hash &aHash,
+                  const uint8_t *           aSignature);
+
+    void Update(otSysMainloopContext &aContext) override;
+    void Process(const otSysMainloopContext &aContext) override;
+
+    static EcdsaVerifier &Get(void);
+
+private:
+    enum
+    {
+        kQueueSize = OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFY_QUEUE_SIZE,
+    };
+
+    struct Request
+    {
+        otInstance *       mInstance;
+        uint32_t           mRequestId;
+        uint8_t            mPublicKey[OT_CRYPTO_ECDSA_P256_PUBLIC_KEY_SIZE];
+        otCryptoSha256Hash mHash;
+        uint8_t            mSignature[OT_CRYPTO_ECDSA_P256_SIGNATURE_SIZE];
+        otError            mError;
+    };
+
+    // The ring holds requests in two consecutive ranges:
+    // [mReportHead, mVerifyHead) verified and waiting to be reported,
+    // [mVerifyHead, mTail) waiting to be verified.
+    // Indices grow monotonically, a slot is `index % kQueueSize`.
+
+    void         Start(void);
+    static void *Run(void *aVerifier);
+    void         Run(void);
+
+    pthread_mutex_t mMutex      = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t  mCondition  = PTHREAD_COND_INITIALIZER;
+    bool            mStarted    = false;
+    int             mPipe[2]    = {-1, -1};
+    uint32_t        mReportHead = 0;
+    uint32_t        mVerifyHead = 0;
+    uint32_t        mTail       = 0;
+    Request         mRequests[kQueueSize];
+};
+
+otError EcdsaVerifier::Queue(otInstance *              aInstance,
+                             uint32_t                  aRequestId,
+                             const uint8_t *           aPublicKey,
+                             const otCryptoSha256Hash &aHash,
+                             const uint8_t *           aSignature)
+{
+    otError  error = OT_ERROR_NONE;
+    Request *request;
+
+    if (!mStarted)
+    {
+        Start();
+    }
+
+    pthread_mutex_lock(&mMutex);
+
+    VerifyOrExit(mTail - mReportHead < kQueueSize, error = OT_ERROR_BUSY);
+
+    request             = &mRequests[mTail % kQueueSize];
+    request->mInstance  = aInstance;
+    request->mRequestId = aRequestId;
+    request->mHash      = aHash;
+    memcpy(request->mPublicKey, aPublicKey, sizeof(request->mPublicKey));
+    memcpy(request->mSignature, aSignature, sizeof(request->mSignature));
+
+    mTail++;
+    pthread_cond_signal(&mCondition);
+
+exit:
+    pthread_mutex_unlock(&mMutex);
+    return error;
+}
+
+void EcdsaVerifier::Start(void)
+{
+    pthread_t thread;
+
+    VerifyOrDie(pipe(mPipe) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int fd : mPipe)
+    {
+        VerifyOrDie(fcntl(fd, F_SETFD, FD_CLOEXEC) != -1, OT_EXIT_ERROR_ERRNO);
+    }
+
+    VerifyOrDie(fcntl(mPipe[0], F_SETFL, fcntl(mPipe[0], F_GETFL) | O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+
+    // The worker lives as long as the process and never touches OpenThread state.
+    VerifyOrDie(pthread_create(&thread, nullptr, &EcdsaVerifier::Run, this) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_detach(thread) == 0, OT_EXIT_FAILURE);
+
+    Mainloop::Manager::Get().Add(*this);
+    mStarted = true;
+}
+
+void *EcdsaVerifier::Run(void *aVerifier)
+{
+    static_cast<EcdsaVerifier *>(aVerifier)->Run();
+
+    return nullptr;
+}
+
+void EcdsaVerifier::Run(void)
+{
+    const uint8_t done = 1;
+
+    pthread_mutex_lock(&mMutex);
+
+    while (true)
+    {
+        Request *request;
+
+        while (mVerifyHead == mTail)
+        {
+            pthread_cond_wait(&mCondition, &mMutex);
+        }
+
+        // The slot is not reused before it is reported, so it can be accessed without the lock.
+        request = &mRequests[mVerifyHead % kQueueSize];
+        pthread_mutex_unlock(&mMutex);
+
+        request->mError =
+            otCryptoEcdsaVerify(request->mPublicKey, sizeof(request->mPublicKey), request->mHash.m8,
+                                sizeof(request->mHash.m8), request->mSignature, sizeof(request->mSignature));
+
+        pthread_mutex_lock(&mMutex);
+        mVerifyHead++;
+
+        while (write(mPipe[1], &done, sizeof(done)) == -1)
+        {
+            VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+        }
+    }
+}
+
+void EcdsaVerifier::Update(otSysMainloopContext &aContext)
+{
+    FD_SET(mPipe[0], &aContext.mReadFdSet);
+
+    if (aContext.mMaxFd < mPipe[0])
+    {
+        aContext.mMaxFd = mPipe[0];
+    }
+}
+
+void EcdsaVerifier::Process(const otSysMainloopContext &aContext)
+{
+    uint8_t buffer[16];
+    ssize_t rval;
+
+    VerifyOrExit(FD_ISSET(mPipe[0], &aContext.mReadFdSet));
+
+    // Drain the wake-ups, the ring indices tell what has completed.
+    do
+    {
+        rval = read(mPipe[0], buffer, sizeof(buffer));
+    } while (rval > 0);
+
+    VerifyOrDie(rval == 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, OT_EXIT_ERROR_ERRNO);
+
+    while (true)
+    {
+        Request request;
+
+        pthread_mutex_lock(&mMutex);
+
+        if (mReportHead == mVerifyHead)
+        {
+            pthread_mutex_unlock(&mMutex);
+            break;
+        }
+
+        request = mRequests[mReportHead % kQueueSize];
+        mReportHead++;
+        pthread_mutex_unlock(&mMutex);
+
+        // The callback may queue new requests, so it is invoked without the lock.
+        otPlatEcdsaVerifyDone(request.mInstance, request.mRequestId, request.mError);
+    }
+
+exit:
+    return;
+}
+
+EcdsaVerifier &EcdsaVerifier::Get(void)
+{
+    static EcdsaVerifier sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+otError otPlatEcdsaVerify(otInstance *              aInstance,
+                          uint32_t                  aRequestId,
+                          const uint8_t *           aPublicKey,
+                          const otCryptoSha256Hash *aHash,
+                          const uint8_t *           aSignature)
+{
+    return ot::Posix::EcdsaVerifier::Get().Queue(aInstance, aRequestId, aPublicKey, *aHash, aSignature);
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
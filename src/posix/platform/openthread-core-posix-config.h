@@ -114,6 +114,29 @@
 #define OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+ *
+ * Define to 1 to generate PSKc in a worker thread of the POSIX platform.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+ *
+ * Define to 1 to verify ECDSA signatures in a worker thread of the POSIX platform.
+ *
+ * The worker calls into mbedTLS concurrently with the OpenThread processing, so it is only enabled by default when
+ * the heap is provided by the (thread-safe) C library.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_ECDSA_VERIFY_ENABLE OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
 
 #ifndef OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
@@ -236,4 +259,24 @@
 #define OPENTHREAD_CONFIG_CLI_UART_RX_BUFFER_SIZE 640
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+ *
+ * Define to 1 to enable DTLS session resumption for EC-JPAKE sessions.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+ *
+ * Define to 1 to enable large frames on TREL radio link.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE
+#define OPENTHREAD_CONFIG_RADIO_LINK_TREL_LARGE_FRAME_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -100,6 +100,27 @@
 #define OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_BINARY_LOG_FILE
+ *
+ * Define the file to which the binary log records are written when `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_BINARY_LOG_FILE
+#define OPENTHREAD_POSIX_CONFIG_BINARY_LOG_FILE "/tmp/openthread.otlog"
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_PACKET_TRACE_FILE
+ *
+ * Define the file to which the packet trace events are written when `OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE` is
+ * enabled.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_PACKET_TRACE_FILE
+#define OPENTHREAD_POSIX_CONFIG_PACKET_TRACE_FILE "/tmp/openthread-trace.json"
+#endif
+
 /**
  * RCP bus UART.
  *
@@ -155,6 +176,28 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFY_QUEUE_SIZE
+ *
+ * The maximum number of ECDSA signature verifications queued to the verification worker thread.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFY_QUEUE_SIZE
+#define OPENTHREAD_POSIX_CONFIG_ECDSA_VERIFY_QUEUE_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SOCKET_BATCH_SIZE
+ *
+ * The maximum number of datagrams received from or sent to a TREL or platform UDP socket per main loop wakeup.
+ *
+ * On Linux the datagrams are transferred with a single `recvmmsg()`/`sendmmsg()` call.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SOCKET_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_SOCKET_BATCH_SIZE 8
+#endif
+
 #ifdef __APPLE__
 
 /**
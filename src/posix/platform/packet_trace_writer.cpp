@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the packet trace file writer.
+ */
+
+#include "posix/platform/packet_trace_writer.hpp"
+
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "platform-posix.h"
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+static const char *EventToString(uint8_t aEvent)
+{
+    static const char *const kEventStrings[] = {
+        "Ip6Send",      // (0)  OT_PACKET_TRACE_EVENT_IP6_SEND
+        "Enqueue",      // (1)  OT_PACKET_TRACE_EVENT_ENQUEUE
+        "AddressQuery", // (2)  OT_PACKET_TRACE_EVENT_ADDRESS_QUERY
+        "Route",        // (3)  OT_PACKET_TRACE_EVENT_ROUTE
+        "IndirectHold", // (4)  OT_PACKET_TRACE_EVENT_INDIRECT_HOLD
+        "Frame",        // (5)  OT_PACKET_TRACE_EVENT_FRAME
+        "Fragment",     // (6)  OT_PACKET_TRACE_EVENT_FRAGMENT
+        "CsmaBackoff",  // (7)  OT_PACKET_TRACE_EVENT_CSMA_BACKOFF
+        "TxStart",      // (8)  OT_PACKET_TRACE_EVENT_TX_START
+        "AckWait",      // (9)  OT_PACKET_TRACE_EVENT_ACK_WAIT
+        "Retry",        // (10) OT_PACKET_TRACE_EVENT_RETRY
+        "TxDone",       // (11) OT_PACKET_TRACE_EVENT_TX_DONE
+        "Dequeue",      // (12) OT_PACKET_TRACE_EVENT_DEQUEUE
+        "Drop",         // (13) OT_PACKET_TRACE_EVENT_DROP
+        "RxFrame",      // (14) OT_PACKET_TRACE_EVENT_RX_FRAME
+        "RxDatagram",   // (15) OT_PACKET_TRACE_EVENT_RX_DATAGRAM
+    };
+
+    static_assert(OT_PACKET_TRACE_EVENT_RX_DATAGRAM == OT_ARRAY_LENGTH(kEventStrings) - 1,
+                  "kEventStrings is not in sync with otPacketTraceEventType");
+
+    return (aEvent < OT_ARRAY_LENGTH(kEventStrings)) ? kEventStrings[aEvent] : "Unknown";
+}
+
+void PacketTraceWriter::Init(otInstance *aInstance, const char *aPath)
+{
+    mInstance = aInstance;
+    mLength   = 0;
+    mOffset   = 0;
+    mFd       = open(aPath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    VerifyOrDie(mFd != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(fcntl(mFd, F_SETFL, fcntl(mFd, F_GETFL) | O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+
+    Append("[\n");
+
+    Mainloop::Manager::Get().Add(*this);
+}
+
+void PacketTraceWriter::Deinit(void)
+{
+    VerifyOrExit(mFd != -1);
+
+    Mainloop::Manager::Get().Remove(*this);
+
+    VerifyOrDie(fcntl(mFd, F_SETFL, fcntl(mFd, F_GETFL) & ~O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+
+    while (mOffset < mLength)
+    {
+        Flush();
+    }
+
+    // The trace event format tolerates a trailing comma before the closing bracket.
+    mLength = 0;
+    mOffset = 0;
+    Append("]\n");
+
+    while (mOffset < mLength)
+    {
+        Flush();
+    }
+
+    close(mFd);
+    mFd       = -1;
+    mInstance = nullptr;
+
+exit:
+    return;
+}
+
+void PacketTraceWriter::Update(otSysMainloopContext &aContext)
+{
+    Fill();
+
+    VerifyOrExit(mOffset < mLength);
+
+    FD_SET(mFd, &aContext.mWriteFdSet);
+
+    if (aContext.mMaxFd < mFd)
+    {
+        aContext.mMaxFd = mFd;
+    }
+
+exit:
+    return;
+}
+
+void PacketTraceWriter::Process(const otSysMainloopContext &aContext)
+{
+    if (FD_ISSET(mFd, &aContext.mWriteFdSet))
+    {
+        Flush();
+    }
+}
+
+void PacketTraceWriter::Fill(void)
+{
+    otPacketTraceEvent event;
+
+    if (mOffset == mLength)
+    {
+        mLength = 0;
+        mOffset = 0;
+    }
+
+    while ((kBufferSize - mLength >= kMaxEventLength) && (otPacketTraceRead(mInstance, &event, 1) == 1))
+    {
+        AppendEvent(event);
+    }
+}
+
+void PacketTraceWriter::AppendEvent(const otPacketTraceEvent &aEvent)
+{
+    const char *name = EventToString(aEvent.mEvent);
+
+    if (aEvent.mMessage == nullptr)
+    {
+        Append("{\"name\":\"%s\",\"cat\":\"mac\",\"ph\":\"i\",\"s\":\"p\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":1},\n",
+               name, aEvent.mTimestamp);
+        ExitNow();
+    }
+
+    if (aEvent.mEvent == OT_PACKET_TRACE_EVENT_ENQUEUE)
+    {
+        Append("{\"name\":\"Message\",\"cat\":\"msg\",\"ph\":\"b\",\"id\":\"%p\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":1},\n",
+               aEvent.mMessage, aEvent.mTimestamp);
+    }
+
+    Append("{\"name\":\"%s\",\"cat\":\"msg\",\"ph\":\"n\",\"id\":\"%p\",\"ts\":%" PRIu64
+           ",\"pid\":1,\"tid\":1,\"args\":{\"queueDepth\":%u}},\n",
+           name, aEvent.mMessage, aEvent.mTimestamp, aEvent.mQueueDepth);
+
+    switch (aEvent.mEvent)
+    {
+    case OT_PACKET_TRACE_EVENT_DEQUEUE:
+    case OT_PACKET_TRACE_EVENT_DROP:
+        Append("{\"name\":\"Message\",\"cat\":\"msg\",\"ph\":\"e\",\"id\":\"%p\",\"ts\":%" PRIu64 ",\"pid\":1,\"tid\":1},\n",
+               aEvent.mMessage, aEvent.mTimestamp);
+
+        OT_FALL_THROUGH;
+
+    case OT_PACKET_TRACE_EVENT_ENQUEUE:
+        Append("{\"name\":\"SendQueue\",\"ph\":\"C\",\"ts\":%" PRIu64 ",\"pid\":1,\"args\":{\"depth\":%u}},\n",
+               aEvent.mTimestamp, aEvent.mQueueDepth);
+        break;
+
+    case OT_PACKET_TRACE_EVENT_IP6_SEND:
+        Append("{\"name\":\"Ip6SendQueue\",\"ph\":\"C\",\"ts\":%" PRIu64 ",\"pid\":1,\"args\":{\"depth\":%u}},\n",
+               aEvent.mTimestamp, aEvent.mQueueDepth);
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void PacketTraceWriter::Append(const char *aFormat, ...)
+{
+    va_list args;
+    int     rval;
+
+    va_start(args, aFormat);
+    rval = vsnprintf(&mBuffer[mLength], kBufferSize - mLength, aFormat, args);
+    va_end(args);
+
+    VerifyOrExit(rval > 0);
+    mLength += static_cast<uint16_t>(OT_MIN(static_cast<uint16_t>(rval), kBufferSize - mLength - 1));
+
+exit:
+    return;
+}
+
+void PacketTraceWriter::Flush(void)
+{
+    ssize_t rval;
+
+    VerifyOrExit(mOffset < mLength);
+
+    rval = write(mFd, &mBuffer[mOffset], mLength - mOffset);
+
+    if (rval > 0)
+    {
+        mOffset += static_cast<uint16_t>(rval);
+    }
+    else if (rval == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+
+exit:
+    return;
+}
+
+PacketTraceWriter &PacketTraceWriter::Get(void)
+{
+    static PacketTraceWriter sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the packet trace file writer.
+ */
+
+#ifndef OT_POSIX_PLATFORM_PACKET_TRACE_WRITER_HPP_
+#define OT_POSIX_PLATFORM_PACKET_TRACE_WRITER_HPP_
+
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/packet_trace.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class drains the packet trace events into a file in the Chrome trace event (JSON array) format, which can be
+ * loaded in `chrome://tracing` or Perfetto.
+ *
+ * Each message is shown as an async span from the time it is queued in the mesh forwarder until it is dequeued or
+ * dropped, with the intermediate events (route resolution, fragmentation, CSMA backoff, ack wait, retries, etc.) as
+ * instant events within the span. Queue depths are shown as counters.
+ *
+ */
+class PacketTraceWriter : public Mainloop::Source, private NonCopyable
+{
+public:
+    /**
+     * This method opens the trace file and registers the writer in the mainloop.
+     *
+     * @param[in]  aInstance  The OpenThread instance.
+     * @param[in]  aPath      The path of the trace file.
+     *
+     */
+    void Init(otInstance *aInstance, const char *aPath);
+
+    /**
+     * This method flushes pending output and closes the trace file.
+     *
+     * As this is called after the OpenThread instance is finalized, events still in the instance ring buffer are not
+     * written.
+     *
+     */
+    void Deinit(void);
+
+    void Update(otSysMainloopContext &aContext) override;
+    void Process(const otSysMainloopContext &aContext) override;
+
+    /**
+     * This function returns the packet trace writer singleton.
+     *
+     * @returns A reference to the packet trace writer singleton.
+     *
+     */
+    static PacketTraceWriter &Get(void);
+
+private:
+    enum : uint16_t
+    {
+        kBufferSize     = 4096,
+        kMaxEventLength = 512, // Max output length for a single trace event (an instant, a span end and a counter).
+    };
+
+    void Fill(void);
+    void AppendEvent(const otPacketTraceEvent &aEvent);
+    void Append(const char *aFormat, ...);
+    void Flush(void);
+
+    otInstance *mInstance = nullptr;
+    int         mFd       = -1;
+    uint16_t    mLength;
+    uint16_t    mOffset;
+    char        mBuffer[kBufferSize];
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+
+#endif // OT_POSIX_PLATFORM_PACKET_TRACE_WRITER_HPP_
@@ -0,0 +1,217 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the PSKc generation worker.
+ */
+
+#include "openthread-posix-config.h"
+#include "platform-posix.h"
+
+#if OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <openthread/commissioner.h>
+#include <openthread/dataset.h>
+#include <openthread/platform/pskc.h>
+
+#include "common/code_utils.hpp"
+#include "common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class derives the PSKc in a worker thread.
+ *
+ * PBKDF2 with 16384 iterations takes long enough to stall the mainloop, so each request is computed by a dedicated
+ * thread working on a private copy of the inputs. Completion is signaled through a pipe which is watched by the
+ * mainloop, and the result is reported with `otPlatPskcGenerateDone()` from the mainloop context.
+ *
+ */
+class PskcWorker : public Mainloop::Source, private NonCopyable
+{
+public:
+    otError Start(otInstance *           aInstance,
+                  const char *           aPassPhrase,
+                  const otNetworkName &  aNetworkName,
+                  const otExtendedPanId &aExtPanId);
+
+    void Update(otSysMainloopContext &aContext) override;
+    void Process(const otSysMainloopContext &aContext) override;
+
+    static PskcWorker &Get(void);
+
+private:
+    enum
+    {
+        kMaxPassPhraseLength = OT_COMMISSIONING_PASSPHRASE_MAX_SIZE,
+    };
+
+    static void *Run(void *aWorker);
+    void         Run(void);
+    void         OpenPipe(void);
+
+    otInstance *    mInstance = nullptr;
+    bool            mRunning  = false;
+    int             mPipe[2]  = {-1, -1};
+    pthread_t       mThread;
+    char            mPassPhrase[kMaxPassPhraseLength + 1];
+    otNetworkName   mNetworkName;
+    otExtendedPanId mExtPanId;
+    otError         mError;
+    otPskc          mPskc;
+};
+
+otError PskcWorker::Start(otInstance *           aInstance,
+                          const char *           aPassPhrase,
+                          const otNetworkName &  aNetworkName,
+                          const otExtendedPanId &aExtPanId)
+{
+    otError error = OT_ERROR_NONE;
+    size_t  length;
+
+    VerifyOrExit(!mRunning, error = OT_ERROR_BUSY);
+
+    length = strnlen(aPassPhrase, sizeof(mPassPhrase));
+    VerifyOrExit(length < sizeof(mPassPhrase), error = OT_ERROR_INVALID_ARGS);
+
+    if (mPipe[0] == -1)
+    {
+        OpenPipe();
+    }
+
+    memcpy(mPassPhrase, aPassPhrase, length + 1);
+    mNetworkName = aNetworkName;
+    mExtPanId    = aExtPanId;
+    mInstance    = aInstance;
+
+    VerifyOrExit(pthread_create(&mThread, nullptr, &PskcWorker::Run, this) == 0, error = OT_ERROR_FAILED);
+
+    mRunning = true;
+    Mainloop::Manager::Get().Add(*this);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        memset(mPassPhrase, 0, sizeof(mPassPhrase));
+    }
+
+    return error;
+}
+
+void PskcWorker::OpenPipe(void)
+{
+    VerifyOrDie(pipe(mPipe) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int fd : mPipe)
+    {
+        VerifyOrDie(fcntl(fd, F_SETFD, FD_CLOEXEC) != -1, OT_EXIT_ERROR_ERRNO);
+    }
+}
+
+void *PskcWorker::Run(void *aWorker)
+{
+    static_cast<PskcWorker *>(aWorker)->Run();
+
+    return nullptr;
+}
+
+void PskcWorker::Run(void)
+{
+    const uint8_t done = 1;
+
+    mError = otDatasetGeneratePskc(mPassPhrase, &mNetworkName, &mExtPanId, &mPskc);
+    memset(mPassPhrase, 0, sizeof(mPassPhrase));
+
+    // The write publishes the result to the mainloop thread.
+    while (write(mPipe[1], &done, sizeof(done)) == -1)
+    {
+        VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+    }
+}
+
+void PskcWorker::Update(otSysMainloopContext &aContext)
+{
+    FD_SET(mPipe[0], &aContext.mReadFdSet);
+
+    if (aContext.mMaxFd < mPipe[0])
+    {
+        aContext.mMaxFd = mPipe[0];
+    }
+}
+
+void PskcWorker::Process(const otSysMainloopContext &aContext)
+{
+    uint8_t done;
+
+    VerifyOrExit(FD_ISSET(mPipe[0], &aContext.mReadFdSet));
+
+    if (read(mPipe[0], &done, sizeof(done)) == -1)
+    {
+        VerifyOrDie(errno == EINTR || errno == EAGAIN, OT_EXIT_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    VerifyOrDie(pthread_join(mThread, nullptr) == 0, OT_EXIT_FAILURE);
+
+    mRunning = false;
+    Mainloop::Manager::Get().Remove(*this);
+
+    otPlatPskcGenerateDone(mInstance, mError, (mError == OT_ERROR_NONE) ? &mPskc : nullptr);
+
+exit:
+    return;
+}
+
+PskcWorker &PskcWorker::Get(void)
+{
+    static PskcWorker sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+otError otPlatPskcGenerate(otInstance *           aInstance,
+                           const char *           aPassPhrase,
+                           const otNetworkName *  aNetworkName,
+                           const otExtendedPanId *aExtPanId)
+{
+    return ot::Posix::PskcWorker::Get().Start(aInstance, aPassPhrase, *aNetworkName, *aExtPanId);
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_PSKC_GENERATE_ENABLE
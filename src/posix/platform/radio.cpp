@@ -402,6 +402,12 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
     return sRadioSpinel.EnergyScan(aScanChannel, aScanDuration);
 }
 
+otError otPlatRadioMultiChannelEnergyScan(otInstance *aInstance, uint32_t aScanChannels, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.MultiChannelEnergyScan(aScanChannels, aScanDuration);
+}
+
 otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
 {
     OT_UNUSED_VARIABLE(aInstance);
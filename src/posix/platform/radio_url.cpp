@@ -61,7 +61,8 @@ const char *otSysGetRadioUrlHelpString(void)
     "    spi-align-allowance[=n]       Specify the maximum number of 0xFF bytes to clip from start of\n"       \
     "                                  MISO frame. Max value is 16.\n"                                         \
     "    spi-small-packet=[n]          Specify the smallest packet we can receive in a single transaction.\n"  \
-    "                                  (larger packets will require two transactions). Default value is 32.\n"
+    "                                  (larger packets will require two transactions, the size is adapted\n"   \
+    "                                  to the recently received packets). Default value is 32.\n"
 
 #else
 
@@ -73,6 +73,7 @@ SpiInterface::SpiInterface(SpinelInterface::ReceiveFrameCallback aCallback,
     , mSpiDevFd(-1)
     , mResetGpioValueFd(-1)
     , mIntGpioValueFd(-1)
+    , mIntGpioIsLineEvent(false)
     , mSlaveResetCount(0)
     , mSpiFrameCount(0)
     , mSpiValidFrameCount(0)
@@ -84,21 +85,29 @@ SpiInterface::SpiInterface(SpinelInterface::ReceiveFrameCallback aCallback,
     , mSpiTxFrameCount(0)
     , mSpiTxFrameByteCount(0)
     , mSpiTxIsReady(false)
+    , mSpiTxIsPacked(false)
     , mSpiTxRefusedCount(0)
     , mSpiTxPayloadSize(0)
     , mDidPrintRateLimitLog(false)
     , mSpiSlaveDataLen(0)
+    , mSpiSlaveAcceptLen(0)
+    , mSlaveSupportsMultiFrame(false)
+    , mIsHandlingRxFrames(false)
 {
 }
 
 void SpiInterface::OnRcpReset(void)
 {
-    mSpiValidFrameCount   = 0;
-    mSpiTxIsReady         = false;
-    mSpiTxRefusedCount    = 0;
-    mSpiTxPayloadSize     = 0;
-    mDidPrintRateLimitLog = false;
-    mSpiSlaveDataLen      = 0;
+    mSpiValidFrameCount      = 0;
+    mSpiTxIsReady            = false;
+    mSpiTxIsPacked           = false;
+    mSpiTxRefusedCount       = 0;
+    mSpiTxPayloadSize        = 0;
+    mDidPrintRateLimitLog    = false;
+    mSpiSlaveDataLen         = 0;
+    mSpiSlaveAcceptLen       = 0;
+    mSlaveSupportsMultiFrame = false;
+    mSpiRxTransferSize       = mSpiSmallPacketSize;
     memset(mSpiTxFrameBuffer, 0, sizeof(mSpiTxFrameBuffer));
 
     TriggerReset();
@@ -121,7 +130,7 @@ otError SpiInterface::Init(const Url::Url &aRadioUrl)
 
     spiGpioIntDevice   = aRadioUrl.GetValue("gpio-int-device");
     spiGpioResetDevice = aRadioUrl.GetValue("gpio-reset-device");
-    if (!spiGpioIntDevice || !spiGpioResetDevice)
+    if (!spiGpioResetDevice)
     {
         DieNow(OT_EXIT_INVALID_ARGUMENTS);
     }
@@ -130,7 +139,7 @@ otError SpiInterface::Init(const Url::Url &aRadioUrl)
     {
         spiGpioIntLine = static_cast<uint8_t>(atoi(value));
     }
-    else
+    else if (spiGpioIntDevice != nullptr)
     {
         DieNow(OT_EXIT_INVALID_ARGUMENTS);
     }
@@ -172,6 +181,7 @@ otError SpiInterface::Init(const Url::Url &aRadioUrl)
     mSpiResetDelay      = spiResetDelay;
     mSpiCsDelayUs       = spiCsDelay;
     mSpiSmallPacketSize = spiSmallPacketSize;
+    mSpiRxTransferSize  = spiSmallPacketSize;
     mSpiAlignAllowance  = spiAlignAllowance;
 
     if (spiGpioIntDevice != nullptr)
@@ -278,6 +288,81 @@ uint8_t SpiInterface::GetGpioValue(int aFd)
     return data.values[0];
 }
 
+#ifdef GPIO_V2_GET_LINE_IOCTL
+int SpiInterface::SetupGpioLineEvent(int aFd, uint8_t aLine, const char *aLabel)
+{
+    struct gpio_v2_line_request req;
+
+    assert(strlen(aLabel) < sizeof(req.consumer));
+
+    memset(&req, 0, sizeof(req));
+    req.offsets[0]   = aLine;
+    req.num_lines    = 1;
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    snprintf(req.consumer, sizeof(req.consumer), "%s", aLabel);
+
+    if (ioctl(aFd, GPIO_V2_GET_LINE_IOCTL, &req) == -1)
+    {
+        // The kernel does not support the v2 GPIO character device ABI.
+        otLogInfoPlat("GPIO v2 line request failed: %s", strerror(errno));
+        req.fd = -1;
+    }
+
+    return req.fd;
+}
+
+uint8_t SpiInterface::GetGpioLineValue(int aFd)
+{
+    struct gpio_v2_line_values values;
+
+    values.bits = 0;
+    values.mask = 1;
+    VerifyOrDie(ioctl(aFd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) != -1, OT_EXIT_ERROR_ERRNO);
+    return static_cast<uint8_t>(values.bits & 1);
+}
+#else
+int SpiInterface::SetupGpioLineEvent(int aFd, uint8_t aLine, const char *aLabel)
+{
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aLine);
+    OT_UNUSED_VARIABLE(aLabel);
+
+    return -1;
+}
+
+uint8_t SpiInterface::GetGpioLineValue(int aFd)
+{
+    OT_UNUSED_VARIABLE(aFd);
+
+    return 0;
+}
+#endif // GPIO_V2_GET_LINE_IOCTL
+
+uint8_t SpiInterface::GetIntGpioValue(void)
+{
+    return mIntGpioIsLineEvent ? GetGpioLineValue(mIntGpioValueFd) : GetGpioValue(mIntGpioValueFd);
+}
+
+void SpiInterface::ClearIntEvents(void)
+{
+    if (mIntGpioIsLineEvent)
+    {
+#ifdef GPIO_V2_GET_LINE_IOCTL
+        struct gpio_v2_line_event events[kGpioEventBatchSize];
+
+        // Read all queued events at once to clear interrupt.
+        VerifyOrDie(read(mIntGpioValueFd, events, sizeof(events)) != -1, OT_EXIT_ERROR_ERRNO);
+#endif
+    }
+    else
+    {
+        struct gpioevent_data event;
+
+        // Read event data to clear interrupt.
+        VerifyOrDie(read(mIntGpioValueFd, &event, sizeof(event)) != -1, OT_EXIT_ERROR_ERRNO);
+    }
+}
+
 void SpiInterface::InitResetPin(const char *aCharDev, uint8_t aLine)
 {
     char label[] = "SOC_THREAD_RESET";
@@ -302,7 +387,15 @@ void SpiInterface::InitIntPin(const char *aCharDev, uint8_t aLine)
     VerifyOrDie((aCharDev != nullptr) && (aLine < GPIOHANDLES_MAX), OT_EXIT_INVALID_ARGUMENTS);
     VerifyOrDie((fd = open(aCharDev, O_RDWR)) != -1, OT_EXIT_ERROR_ERRNO);
 
-    mIntGpioValueFd = SetupGpioEvent(fd, aLine, GPIOHANDLE_REQUEST_INPUT, GPIOEVENT_REQUEST_FALLING_EDGE, label);
+    // Prefer the v2 GPIO character device ABI, which reports the line value and queued edge events through a single
+    // file descriptor. Fall back to the v1 ABI on older kernels.
+    mIntGpioValueFd     = SetupGpioLineEvent(fd, aLine, label);
+    mIntGpioIsLineEvent = (mIntGpioValueFd >= 0);
+
+    if (!mIntGpioIsLineEvent)
+    {
+        mIntGpioValueFd = SetupGpioEvent(fd, aLine, GPIOHANDLE_REQUEST_INPUT, GPIOEVENT_REQUEST_FALLING_EDGE, label);
+    }
 
     close(fd);
 }
@@ -430,6 +523,9 @@ otError SpiInterface::PushPullSpi(void)
         txFrame.SetHeaderFlagByte(false);
     }
 
+    // With no data, the multi-frame flag tells our slave that we can receive packed frames.
+    txFrame.SetHeaderMultiFrameFlag(mSpiTxIsReady ? mSpiTxIsPacked : true);
+
     // Zero out our rx_accept and our data_len for now.
     txFrame.SetHeaderAcceptLen(0);
     txFrame.SetHeaderDataLen(0);
@@ -460,21 +556,32 @@ otError SpiInterface::PushPullSpi(void)
             spiTransferBytes = mSpiSlaveDataLen;
         }
     }
-    else
+
+    // Set skip length to make MultiFrameBuffer to reserve a space in front of the frame buffer.
+    SuccessOrExit(error = mRxFrameBuffer.SetSkipLength(kSpiFrameHeaderSize));
+
+    if (mSpiSlaveDataLen == 0)
     {
-        // Set up a minimum transfer size to allow small frames the slave wants to send us to be handled in a
-        // single transaction.
-        if (spiTransferBytes < mSpiSmallPacketSize)
+        // Set up a minimum transfer size to allow the frames the slave wants to send us to be handled in a single
+        // transaction. The size adapts to the amount of data recently received from the slave, but is limited to
+        // the space left in the frame buffer.
+        uint16_t rxTransferSize = mSpiRxTransferSize;
+
+        if (rxTransferSize + mSpiAlignAllowance > mRxFrameBuffer.GetFrameMaxLength())
         {
-            spiTransferBytes = mSpiSmallPacketSize;
+            rxTransferSize = (mRxFrameBuffer.GetFrameMaxLength() > mSpiAlignAllowance)
+                                 ? mRxFrameBuffer.GetFrameMaxLength() - mSpiAlignAllowance
+                                 : 0;
+        }
+
+        if (spiTransferBytes < rxTransferSize)
+        {
+            spiTransferBytes = rxTransferSize;
         }
     }
 
     txFrame.SetHeaderAcceptLen(spiTransferBytes);
 
-    // Set skip length to make MultiFrameBuffer to reserve a space in front of the frame buffer.
-    SuccessOrExit(error = mRxFrameBuffer.SetSkipLength(kSpiFrameHeaderSize));
-
     // Check whether the remaining frame buffer has enough space to store the data to be received.
     VerifyOrExit(mRxFrameBuffer.GetFrameMaxLength() >= spiTransferBytes + mSpiAlignAllowance);
 
@@ -566,61 +673,88 @@ otError SpiInterface::PushPullSpi(void)
 
         if (rxFrame.IsResetFlagSet())
         {
+            // A slave that has reset needs to advertise again that it can receive packed frames.
+            mSlaveSupportsMultiFrame = false;
             mSlaveResetCount++;
 
             otLogNotePlat("Slave did reset (%" PRIu64 " resets so far)", mSlaveResetCount);
             LogStats();
         }
 
+        if (rxFrame.IsMultiFrameFlagSet())
+        {
+            mSlaveSupportsMultiFrame = true;
+        }
+
+        mSpiSlaveAcceptLen = slaveAcceptLen;
+
+        // Handle transmitted packet, if any. This is done before passing the received frames to the upper layer,
+        // which may send new frames from the callback.
+        if (mSpiTxIsReady && (mSpiTxPayloadSize == txFrame.GetHeaderDataLen()))
+        {
+            if (txFrame.GetHeaderDataLen() <= slaveAcceptLen)
+            {
+                // Our outbound packet has been successfully transmitted. Clear mSpiTxPayloadSize and mSpiTxIsReady
+                // so that uplayer can pull another packet for us to send.
+                successfulExchanges++;
+
+                mSpiTxFrameCount++;
+                mSpiTxFrameByteCount += mSpiTxPayloadSize;
+
+                mSpiTxIsReady      = false;
+                mSpiTxIsPacked     = false;
+                mSpiTxPayloadSize  = 0;
+                mSpiTxRefusedCount = 0;
+            }
+            else
+            {
+                // The slave wasn't ready for what we had to send them. Incrementing this counter will turn on rate
+                // limiting so that we don't waste a ton of CPU bombarding them with useless SPI transfers.
+                mSpiTxRefusedCount++;
+            }
+        }
+
+        if (!mSpiTxIsReady)
+        {
+            mSpiTxRefusedCount = 0;
+        }
+
         // Handle received packet, if any.
         if ((mSpiSlaveDataLen != 0) && (mSpiSlaveDataLen <= txFrame.GetHeaderAcceptLen()))
         {
+            UpdateRxTransferSize(mSpiSlaveDataLen);
+
             mSpiRxFrameByteCount += mSpiSlaveDataLen;
             mSpiSlaveDataLen = 0;
-            mSpiRxFrameCount++;
             successfulExchanges++;
 
             // Set the skip length to skip align bytes and SPI frame header.
             SuccessOrExit(error = mRxFrameBuffer.SetSkipLength(skipAlignAllowanceLength + kSpiFrameHeaderSize));
-            // Set the received frame length.
-            SuccessOrExit(error = mRxFrameBuffer.SetLength(rxFrame.GetHeaderDataLen()));
 
             // Upper layer will free the frame buffer.
             discardRxFrame = false;
 
-            mReceiveFrameCallback(mReceiveFrameContext);
-        }
-    }
-
-    // Handle transmitted packet, if any.
-    if (mSpiTxIsReady && (mSpiTxPayloadSize == txFrame.GetHeaderDataLen()))
-    {
-        if (txFrame.GetHeaderDataLen() <= slaveAcceptLen)
-        {
-            // Our outbound packet has been successfully transmitted. Clear mSpiTxPayloadSize and mSpiTxIsReady so
-            // that uplayer can pull another packet for us to send.
-            successfulExchanges++;
-
-            mSpiTxFrameCount++;
-            mSpiTxFrameByteCount += mSpiTxPayloadSize;
+            if (rxFrame.IsMultiFrameFlagSet())
+            {
+                HandlePackedRxData(rxFrame.GetData(), rxFrame.GetHeaderDataLen());
+            }
+            else
+            {
+                // Set the received frame length.
+                SuccessOrExit(error = mRxFrameBuffer.SetLength(rxFrame.GetHeaderDataLen()));
 
-            mSpiTxIsReady      = false;
-            mSpiTxPayloadSize  = 0;
-            mSpiTxRefusedCount = 0;
+                mSpiRxFrameCount++;
+                mReceiveFrameCallback(mReceiveFrameContext);
+            }
         }
-        else
+        else if (mSpiSlaveDataLen != 0)
         {
-            // The slave wasn't ready for what we had to send them. Incrementing this counter will turn on rate
-            // limiting so that we don't waste a ton of CPU bombarding them with useless SPI transfers.
-            mSpiTxRefusedCount++;
+            // The slave has more data than we offered to receive. Grow the transfer size so that similar amounts of
+            // data fit in a single transaction.
+            UpdateRxTransferSize(mSpiSlaveDataLen);
         }
     }
 
-    if (!mSpiTxIsReady)
-    {
-        mSpiTxRefusedCount = 0;
-    }
-
     if (successfulExchanges == 2)
     {
         mSpiDuplexFrameCount++;
@@ -635,9 +769,79 @@ exit:
     return error;
 }
 
+void SpiInterface::HandlePackedRxData(uint8_t *aData, uint16_t aLength)
+{
+    // The data is packed as a sequence of frames, each preceded by its length. Each frame is passed to the upper layer
+    // in place, by setting the skip length of the current frame in `mRxFrameBuffer` so that the frame starts right
+    // after its length. If the upper layer saves a frame, the next frame (and its header) starts right after it, so
+    // the remaining data is moved forward to make room for the header.
+
+    uint8_t savedBytes[SpinelInterface::RxFrameBuffer::kFrameHeaderSize];
+
+    mIsHandlingRxFrames = true;
+
+    while (aLength >= kPackedLengthSize)
+    {
+        uint8_t *start       = mRxFrameBuffer.GetFrame() - mRxFrameBuffer.GetSkipLength();
+        uint16_t frameLength = Encoding::LittleEndian::ReadUint16(aData);
+        uint16_t savedLength;
+
+        VerifyOrExit(frameLength <= aLength - kPackedLengthSize, otLogWarnPlat("Garbage in packed data"));
+
+        if (aData < start)
+        {
+            VerifyOrExit(aLength <= mRxFrameBuffer.GetFrameMaxLength() + mRxFrameBuffer.GetSkipLength());
+            memmove(start, aData, aLength);
+            aData = start;
+        }
+
+        SuccessOrExit(mRxFrameBuffer.SetSkipLength(static_cast<uint16_t>(aData - start) + kPackedLengthSize));
+        SuccessOrExit(mRxFrameBuffer.SetLength(frameLength));
+
+        aData += kPackedLengthSize + frameLength;
+        aLength -= kPackedLengthSize + frameLength;
+
+        // Saving the frame writes the header of the next frame over the start of the remaining data.
+        savedLength = (aLength < sizeof(savedBytes)) ? aLength : sizeof(savedBytes);
+        memcpy(savedBytes, aData, savedLength);
+
+        // Upper layer will free the frame buffer.
+        mSpiRxFrameCount++;
+        mReceiveFrameCallback(mReceiveFrameContext);
+
+        memcpy(aData, savedBytes, savedLength);
+    }
+
+exit:
+    mIsHandlingRxFrames = false;
+
+    // Drop any data left over. The frames passed to the upper layer have already been saved or discarded.
+    mRxFrameBuffer.DiscardFrame();
+}
+
+void SpiInterface::UpdateRxTransferSize(uint16_t aDataLength)
+{
+    if (aDataLength > mSpiRxTransferSize)
+    {
+        mSpiRxTransferSize = aDataLength;
+    }
+    else
+    {
+        // Decay slowly towards the amount of data received, but never below the configured small packet size.
+        uint32_t size = static_cast<uint32_t>(mSpiRxTransferSize) * kRxTransferSizeDecay + aDataLength;
+
+        mSpiRxTransferSize = static_cast<uint16_t>(size / (kRxTransferSizeDecay + 1));
+    }
+
+    if (mSpiRxTransferSize < mSpiSmallPacketSize)
+    {
+        mSpiRxTransferSize = mSpiSmallPacketSize;
+    }
+}
+
 bool SpiInterface::CheckInterrupt(void)
 {
-    return (mIntGpioValueFd >= 0) ? (GetGpioValue(mIntGpioValueFd) == kGpioIntAssertState) : true;
+    return (mIntGpioValueFd >= 0) ? (GetIntGpioValue() == kGpioIntAssertState) : true;
 }
 
 void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMaxFd, struct timeval &aTimeout)
@@ -675,6 +879,12 @@ void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMa
             FD_SET(mIntGpioValueFd, &aReadFdSet);
         }
     }
+    else if (mSpiSlaveDataLen != 0)
+    {
+        // The slave indicated it has data to send, poll it immediately.
+        timeout.tv_sec  = 0;
+        timeout.tv_usec = 0;
+    }
     else if (timercmp(&pollingTimeout, &timeout, <))
     {
         // In this case we don't have an interrupt, so we revert to SPI polling.
@@ -740,22 +950,30 @@ void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMa
 
 void SpiInterface::Process(const RadioProcessContext &aContext)
 {
-    if (FD_ISSET(mIntGpioValueFd, aContext.mReadFdSet))
+    if ((mIntGpioValueFd >= 0) && FD_ISSET(mIntGpioValueFd, aContext.mReadFdSet))
     {
-        struct gpioevent_data event;
-
         otLogDebgPlat("Process(): Interrupt.");
-
-        // Read event data to clear interrupt.
-        VerifyOrDie(read(mIntGpioValueFd, &event, sizeof(event)) != -1, OT_EXIT_ERROR_ERRNO);
+        ClearIntEvents();
     }
 
     // Service the SPI port if we can receive a packet or we have a packet to be sent.
-    if (mSpiTxIsReady || CheckInterrupt())
+    VerifyOrExit(mSpiTxIsReady || CheckInterrupt());
+
+    // We guard this with the above check because we don't want to overwrite any previously received frames. As long
+    // as there is more to exchange, the transactions are performed back to back instead of waiting for the next
+    // main loop iteration.
+    for (uint8_t count = 0; count < kMaxBurstTransfers; count++)
     {
-        // We guard this with the above check because we don't want to overwrite any previously received frames.
-        IgnoreError(PushPullSpi());
+        SuccessOrExit(PushPullSpi());
+
+        // Stop when the slave is rate limiting us, and otherwise continue while we have a frame to send, the slave
+        // has indicated it has data to send, or the slave keeps asserting the interrupt.
+        VerifyOrExit(mSpiTxRefusedCount == 0);
+        VerifyOrExit(mSpiTxIsReady || (mSpiSlaveDataLen != 0) || ((mIntGpioValueFd >= 0) && CheckInterrupt()));
     }
+
+exit:
+    return;
 }
 
 otError SpiInterface::WaitForFrame(uint64_t aTimeoutUs)
@@ -789,9 +1007,11 @@ otError SpiInterface::WaitForFrame(uint64_t aTimeoutUs)
     }
     else
     {
-        // In this case we don't have an interrupt, so we revert to SPI polling.
+        // In this case we don't have an interrupt, so we revert to SPI polling. The slave is polled immediately if it
+        // indicated it has data to send.
         spiTimeout.tv_sec  = 0;
-        spiTimeout.tv_usec = kSpiPollPeriodUs;
+        spiTimeout.tv_usec = (mSpiSlaveDataLen != 0) ? 0 : kSpiPollPeriodUs;
+        isDataReady        = true;
     }
 
     if (timercmp(&spiTimeout, &timeout, <))
@@ -801,12 +1021,9 @@ otError SpiInterface::WaitForFrame(uint64_t aTimeoutUs)
 
     ret = select(mIntGpioValueFd + 1, &readFdSet, nullptr, nullptr, &timeout);
 
-    if (ret > 0 && FD_ISSET(mIntGpioValueFd, &readFdSet))
+    if (ret > 0 && (mIntGpioValueFd >= 0) && FD_ISSET(mIntGpioValueFd, &readFdSet))
     {
-        struct gpioevent_data event;
-
-        // Read event data to clear interrupt.
-        VerifyOrDie(read(mIntGpioValueFd, &event, sizeof(event)) != -1, OT_EXIT_FAILURE);
+        ClearIntEvents();
         isDataReady = true;
     }
 
@@ -832,14 +1049,36 @@ otError SpiInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aLength < (kMaxFrameSize - kSpiFrameHeaderSize), error = OT_ERROR_NO_BUFS);
-    VerifyOrExit(!mSpiTxIsReady, error = OT_ERROR_BUSY);
 
-    memcpy(&mSpiTxFrameBuffer[kSpiFrameHeaderSize], aFrame, aLength);
+    if (mSpiTxIsReady)
+    {
+        // Pack the frame along with the pending ones if the slave can accept all of them in a single transaction.
+        VerifyOrExit(mSpiTxIsPacked && (mSpiTxPayloadSize + kPackedLengthSize + aLength <= mSpiSlaveAcceptLen),
+                     error = OT_ERROR_BUSY);
+    }
+    else
+    {
+        mSpiTxPayloadSize = 0;
+        mSpiTxIsPacked    = mSlaveSupportsMultiFrame && (kPackedLengthSize + aLength <= mSpiSlaveAcceptLen);
+    }
+
+    if (mSpiTxIsPacked)
+    {
+        Encoding::LittleEndian::WriteUint16(aLength, &mSpiTxFrameBuffer[kSpiFrameHeaderSize + mSpiTxPayloadSize]);
+        mSpiTxPayloadSize += kPackedLengthSize;
+    }
 
-    mSpiTxIsReady     = true;
-    mSpiTxPayloadSize = aLength;
+    memcpy(&mSpiTxFrameBuffer[kSpiFrameHeaderSize + mSpiTxPayloadSize], aFrame, aLength);
 
-    IgnoreError(PushPullSpi());
+    mSpiTxIsReady = true;
+    mSpiTxPayloadSize += aLength;
+
+    // While packed frames are being passed to the upper layer, a transaction would overwrite the ones not passed yet.
+    // The frame is then sent from `Process()`.
+    if (!mIsHandlingRxFrames)
+    {
+        IgnoreError(PushPullSpi());
+    }
 
 exit:
     return error;
@@ -157,6 +157,10 @@ private:
     int     SetupGpioEvent(int aFd, uint8_t aLine, uint32_t aHandleFlags, uint32_t aEventFlags, const char *aLabel);
     void    SetGpioValue(int aFd, uint8_t aValue);
     uint8_t GetGpioValue(int aFd);
+    int     SetupGpioLineEvent(int aFd, uint8_t aLine, const char *aLabel);
+    uint8_t GetGpioLineValue(int aFd);
+    uint8_t GetIntGpioValue(void);
+    void    ClearIntEvents(void);
 
     void InitResetPin(const char *aCharDev, uint8_t aLine);
     void InitIntPin(const char *aCharDev, uint8_t aLine);
@@ -166,6 +170,8 @@ private:
     uint8_t *GetRealRxFrameStart(uint8_t *aSpiRxFrameBuffer, uint8_t aAlignAllowance, uint16_t &aSkipLength);
     otError  DoSpiTransfer(uint8_t *aSpiRxFrameBuffer, uint32_t aTransferLength);
     otError  PushPullSpi(void);
+    void     HandlePackedRxData(uint8_t *aData, uint16_t aLength);
+    void     UpdateRxTransferSize(uint16_t aDataLength);
 
     bool CheckInterrupt(void);
     void LogStats(void);
@@ -177,6 +183,7 @@ private:
         kSpiModeMax           = 3,
         kSpiAlignAllowanceMax = 16,
         kSpiFrameHeaderSize   = 5,
+        kPackedLengthSize     = Ncp::SpiFrame::kPackedLengthSize,
         kSpiBitsPerWord       = 8,
         kSpiTxRefuseWarnCount = 30,
         kSpiTxRefuseExitCount = 100,
@@ -185,6 +192,9 @@ private:
         kDebugBytesPerLine    = 16,
         kGpioIntAssertState   = 0,
         kGpioResetAssertState = 0,
+        kGpioEventBatchSize   = 16,
+        kMaxBurstTransfers    = 8,
+        kRxTransferSizeDecay  = 8,
     };
 
     enum
@@ -208,15 +218,17 @@ private:
     void *                                        mReceiveFrameContext;
     Spinel::SpinelInterface::RxFrameBuffer &      mRxFrameBuffer;
 
-    int mSpiDevFd;
-    int mResetGpioValueFd;
-    int mIntGpioValueFd;
+    int  mSpiDevFd;
+    int  mResetGpioValueFd;
+    int  mIntGpioValueFd;
+    bool mIntGpioIsLineEvent;
 
     uint8_t  mSpiMode;
     uint8_t  mSpiAlignAllowance;
     uint32_t mSpiResetDelay;
     uint16_t mSpiCsDelayUs;
     uint16_t mSpiSmallPacketSize;
+    uint16_t mSpiRxTransferSize;
     uint32_t mSpiSpeedHz;
 
     uint64_t mSlaveResetCount;
@@ -231,12 +243,16 @@ private:
     uint64_t mSpiTxFrameByteCount;
 
     bool     mSpiTxIsReady;
+    bool     mSpiTxIsPacked;
     uint16_t mSpiTxRefusedCount;
     uint16_t mSpiTxPayloadSize;
     uint8_t  mSpiTxFrameBuffer[kMaxFrameSize + kSpiAlignAllowanceMax];
 
     bool     mDidPrintRateLimitLog;
     uint16_t mSpiSlaveDataLen;
+    uint16_t mSpiSlaveAcceptLen;
+    bool     mSlaveSupportsMultiFrame;
+    bool     mIsHandlingRxFrames;
 
     // Non-copyable, intentionally not implemented.
     SpiInterface(const SpiInterface &);
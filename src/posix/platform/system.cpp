@@ -47,9 +47,11 @@
 #include <openthread/platform/radio.h>
 
 #include "common/code_utils.hpp"
+#include "posix/platform/binary_log_writer.hpp"
 #include "posix/platform/daemon.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
+#include "posix/platform/packet_trace_writer.hpp"
 #include "posix/platform/radio_url.hpp"
 #include "posix/platform/udp.hpp"
 
@@ -126,9 +128,17 @@ otInstance *otSysInit(otPlatformConfig *aPlatformConfig)
 #endif
     platformRandomInit();
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    ot::Posix::BinaryLogWriter::Get().Init(OPENTHREAD_POSIX_CONFIG_BINARY_LOG_FILE);
+#endif
+
     instance = otInstanceInitSingle();
     assert(instance != nullptr);
 
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+    ot::Posix::PacketTraceWriter::Get().Init(instance, OPENTHREAD_POSIX_CONFIG_PACKET_TRACE_FILE);
+#endif
+
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     platformBackboneInit(instance, aPlatformConfig->mBackboneInterfaceName);
 #endif
@@ -177,6 +187,14 @@ void otSysDeinit(void)
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     ot::Posix::InfraNetif::Get().Deinit();
 #endif
+
+#if OPENTHREAD_CONFIG_PACKET_TRACE_ENABLE
+    ot::Posix::PacketTraceWriter::Get().Deinit();
+#endif
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    ot::Posix::BinaryLogWriter::Get().Deinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -61,8 +61,9 @@
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
-#define TREL_MAX_PACKET_SIZE 1400
+#define TREL_MAX_PACKET_SIZE 1500
 #define TREL_PACKET_POOL_SIZE 5
+#define TREL_SOCKET_BATCH_SIZE OPENTHREAD_POSIX_CONFIG_SOCKET_BATCH_SIZE
 
 #define USEC_PER_MSEC 1000u
 #define TREL_SOCKET_BIND_MAX_WAIT_TIME_MSEC 4000u
@@ -78,8 +79,7 @@ typedef struct TxPacket
     otIp6Address     mDestAddress;
 } TxPacket;
 
-static uint8_t      sRxPacketBuffer[TREL_MAX_PACKET_SIZE];
-static uint16_t     sRxPacketLength;
+static uint8_t      sRxPacketBuffers[TREL_SOCKET_BATCH_SIZE][TREL_MAX_PACKET_SIZE];
 static TxPacket     sTxPacketPool[TREL_PACKET_POOL_SIZE];
 static TxPacket *   sFreeTxPacketHead;  // A singly linked list of free/available `TxPacket` from pool.
 static TxPacket *   sTxPacketQueueTail; // A circular linked list for queued tx packets.
@@ -375,30 +375,73 @@ exit:
     return error;
 }
 
-static void ReceivePacket(int aSocket, otInstance *aInstance)
+static void ReceivePackets(int aSocket, otInstance *aInstance)
 {
-    struct sockaddr_in6 sockAddr;
-    socklen_t           sockAddrLen = sizeof(sockAddr);
-    ssize_t             ret;
+    // Reads up to `TREL_SOCKET_BATCH_SIZE` pending packets without
+    // blocking, then hands them to the core. All packets are read
+    // before any is processed since processing a packet may update
+    // the TREL address and re-create the socket.
 
-    memset(&sockAddr, 0, sizeof(sockAddr));
+    struct sockaddr_in6 sockAddrs[TREL_SOCKET_BATCH_SIZE];
+    uint16_t            lengths[TREL_SOCKET_BATCH_SIZE];
+    uint16_t            count = 0;
+
+    memset(sockAddrs, 0, sizeof(sockAddrs));
+
+#ifdef __linux__
+    {
+        struct mmsghdr msgs[TREL_SOCKET_BATCH_SIZE];
+        struct iovec   iovs[TREL_SOCKET_BATCH_SIZE];
+        int            ret;
+
+        memset(msgs, 0, sizeof(msgs));
+
+        for (uint16_t index = 0; index < TREL_SOCKET_BATCH_SIZE; index++)
+        {
+            iovs[index].iov_base = sRxPacketBuffers[index];
+            iovs[index].iov_len  = sizeof(sRxPacketBuffers[index]);
 
-    ret = recvfrom(aSocket, (char *)sRxPacketBuffer, sizeof(sRxPacketBuffer), 0, (struct sockaddr *)&sockAddr,
-                   &sockAddrLen);
-    VerifyOrDie(ret >= 0, OT_EXIT_ERROR_ERRNO);
+            msgs[index].msg_hdr.msg_name    = &sockAddrs[index];
+            msgs[index].msg_hdr.msg_namelen = sizeof(sockAddrs[index]);
+            msgs[index].msg_hdr.msg_iov     = &iovs[index];
+            msgs[index].msg_hdr.msg_iovlen  = 1;
+        }
 
-    sRxPacketLength = (uint16_t)(ret);
+        ret = recvmmsg(aSocket, msgs, TREL_SOCKET_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        VerifyOrDie((ret >= 0) || (errno == EAGAIN) || (errno == EWOULDBLOCK), OT_EXIT_ERROR_ERRNO);
 
-    if (sRxPacketLength > sizeof(sRxPacketBuffer))
+        for (; (int)(count) < ret; count++)
+        {
+            lengths[count] = (uint16_t)(msgs[count].msg_len);
+        }
+    }
+#else
+    while (count < TREL_SOCKET_BATCH_SIZE)
     {
-        sRxPacketLength = sizeof(sRxPacketLength);
+        socklen_t sockAddrLen = sizeof(sockAddrs[count]);
+        ssize_t   ret;
+
+        ret = recvfrom(aSocket, (char *)sRxPacketBuffers[count], sizeof(sRxPacketBuffers[count]), MSG_DONTWAIT,
+                       (struct sockaddr *)&sockAddrs[count], &sockAddrLen);
+
+        if (ret < 0)
+        {
+            VerifyOrDie((errno == EAGAIN) || (errno == EWOULDBLOCK), OT_EXIT_ERROR_ERRNO);
+            break;
+        }
+
+        lengths[count++] = (uint16_t)(ret);
     }
+#endif
 
-    otLogDebgPlat("[trel] ReceivePacket() - received from %s port:%d, id:%d, pkt:%s",
-                  Ip6AddrToString(&sockAddr.sin6_addr), ntohs(sockAddr.sin6_port), sockAddr.sin6_scope_id,
-                  BufferToString(sRxPacketBuffer, sRxPacketLength));
+    for (uint16_t index = 0; index < count; index++)
+    {
+        otLogDebgPlat("[trel] ReceivePackets() - received from %s port:%d, id:%d, pkt:%s",
+                      Ip6AddrToString(&sockAddrs[index].sin6_addr), ntohs(sockAddrs[index].sin6_port),
+                      sockAddrs[index].sin6_scope_id, BufferToString(sRxPacketBuffers[index], lengths[index]));
 
-    otPlatTrelUdp6HandleReceived(aInstance, sRxPacketBuffer, sRxPacketLength);
+        otPlatTrelUdp6HandleReceived(aInstance, sRxPacketBuffers[index], lengths[index]);
+    }
 }
 
 static void InitPacketQueue(void)
@@ -417,37 +460,115 @@ static void InitPacketQueue(void)
     }
 }
 
+static void DequeuePacket(void)
+{
+    TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+
+    // Remove the head `packet` from the packet queue (circular
+    // linked list).
+
+    if (packet == sTxPacketQueueTail)
+    {
+        sTxPacketQueueTail = NULL;
+    }
+    else
+    {
+        sTxPacketQueueTail->mNext = packet->mNext;
+    }
+
+    // Add the `packet` to the free packet singly linked list.
+
+    packet->mNext     = sFreeTxPacketHead;
+    sFreeTxPacketHead = packet;
+}
+
+#ifdef __linux__
+
 static void SendQueuedPackets(void)
 {
+    // Sends the queued packets in batches of up to
+    // `TREL_SOCKET_BATCH_SIZE` with a single `sendmmsg()` call.
+
+    struct mmsghdr      msgs[TREL_SOCKET_BATCH_SIZE];
+    struct iovec        iovs[TREL_SOCKET_BATCH_SIZE];
+    struct sockaddr_in6 sockAddrs[TREL_SOCKET_BATCH_SIZE];
+
+    VerifyOrExit(sSocket >= 0);
+
     while (sTxPacketQueueTail != NULL)
     {
-        TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+        TxPacket *packet = sTxPacketQueueTail->mNext;
+        uint16_t  count  = 0;
+        int       ret;
 
-        if (SendPacket(packet->mBuffer, packet->mLength, &packet->mDestAddress) == OT_ERROR_INVALID_STATE)
+        memset(msgs, 0, sizeof(msgs));
+        memset(sockAddrs, 0, sizeof(sockAddrs));
+
+        do
         {
-            otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
-            break;
-        }
+            sockAddrs[count].sin6_family = AF_INET6;
+            sockAddrs[count].sin6_port   = htons(sUdpPort);
+            memcpy(&sockAddrs[count].sin6_addr, &packet->mDestAddress, sizeof(otIp6Address));
+
+            iovs[count].iov_base = packet->mBuffer;
+            iovs[count].iov_len  = packet->mLength;
 
-        // Remove the `packet` from the packet queue (circular
-        // linked list).
+            msgs[count].msg_hdr.msg_name    = &sockAddrs[count];
+            msgs[count].msg_hdr.msg_namelen = sizeof(sockAddrs[count]);
+            msgs[count].msg_hdr.msg_iov     = &iovs[count];
+            msgs[count].msg_hdr.msg_iovlen  = 1;
 
-        if (packet == sTxPacketQueueTail)
+            count++;
+            packet = packet->mNext;
+        } while ((count < TREL_SOCKET_BATCH_SIZE) && (packet != sTxPacketQueueTail->mNext));
+
+        ret = sendmmsg(sSocket, msgs, count, 0);
+
+        if (ret < 0)
         {
-            sTxPacketQueueTail = NULL;
+            // The first packet failed. If the network is unreachable
+            // the packet is dropped (same as `SendPacket()` returning
+            // `OT_ERROR_ABORT`), otherwise the send would block and
+            // we try again when the socket becomes writable.
+
+            otLogDebgPlat("[trel] SendQueuedPackets() -- sendmmsg() failed errno %d", errno);
+
+            VerifyOrExit((errno == ENETUNREACH) || (errno == ENETDOWN) || (errno == EHOSTUNREACH));
+            ret = 1;
         }
-        else
+
+        otLogDebgPlat("[trel] SendQueuedPackets() - sent %d of %d packets", ret, count);
+
+        for (int index = 0; index < ret; index++)
         {
-            sTxPacketQueueTail->mNext = packet->mNext;
+            DequeuePacket();
         }
+    }
 
-        // Add the `packet` to the free packet singly linked list.
+exit:
+    return;
+}
 
-        packet->mNext     = sFreeTxPacketHead;
-        sFreeTxPacketHead = packet;
+#else // __linux__
+
+static void SendQueuedPackets(void)
+{
+    while (sTxPacketQueueTail != NULL)
+    {
+        TxPacket *packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+
+        if (SendPacket(packet->mBuffer, packet->mLength, &packet->mDestAddress) == OT_ERROR_INVALID_STATE)
+        {
+            otLogDebgPlat("[trel] SendQueuedPackets() - SendPacket() would block");
+            break;
+        }
+
+        DequeuePacket();
     }
 }
 
+#endif // __linux__
+
 static otError EnqueuePacket(const uint8_t *aBuffer, uint16_t aLength, const otIp6Address *aDestAddress)
 {
     otError   error = OT_ERROR_NONE;
@@ -602,9 +723,10 @@ otError otPlatTrelUdp6SendTo(otInstance *        aInstance,
     // the send operation would block (e.g., socket is not yet ready
     // or is out of buffer) we get `OT_ERROR_INVALID_STATE`. In that
     // case we enqueue the packet to send it later when socket becomes
-    // ready.
+    // ready. While earlier packets are still queued, the new packet
+    // is queued behind them to preserve the tx order.
 
-    error = SendPacket(aBuffer, aLength, aDestAddress);
+    error = (sTxPacketQueueTail == NULL) ? SendPacket(aBuffer, aLength, aDestAddress) : OT_ERROR_INVALID_STATE;
 
     if (error == OT_ERROR_INVALID_STATE)
     {
@@ -705,12 +827,12 @@ void platformTrelProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
 
     if (FD_ISSET(sSocket, aReadFdSet))
     {
-        ReceivePacket(sSocket, aInstance);
+        ReceivePackets(sSocket, aInstance);
     }
 
     if (FD_ISSET(sMulticastSocket, aReadFdSet))
     {
-        ReceivePacket(sMulticastSocket, aInstance);
+        ReceivePackets(sMulticastSocket, aInstance);
     }
 
 exit:
@@ -177,57 +177,127 @@ exit:
     return error;
 }
 
-otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+struct RxPacket
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+#ifdef __APPLE__
+    // use fixed value for CMSG_SPACE is not a constant expression on macOS
+    static constexpr size_t kControlSize = 128;
+#else
+    static constexpr size_t kControlSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+#endif
 
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
+    void Prepare(struct msghdr &aMsg)
+    {
+        mIov.iov_base = mPayload;
+        mIov.iov_len  = sizeof(mPayload);
+
+        aMsg.msg_name       = &mPeerAddr;
+        aMsg.msg_namelen    = sizeof(mPeerAddr);
+        aMsg.msg_control    = mControl;
+        aMsg.msg_controllen = sizeof(mControl);
+        aMsg.msg_iov        = &mIov;
+        aMsg.msg_iovlen     = 1;
+        aMsg.msg_flags      = 0;
+    }
 
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    void Parse(struct msghdr &aMsg, size_t aLength)
     {
-        if (cmsg->cmsg_level == IPPROTO_IPV6)
+        mLength = static_cast<uint16_t>(aLength);
+        memset(&mMessageInfo, 0, sizeof(mMessageInfo));
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aMsg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&aMsg, cmsg))
         {
-            if (cmsg->cmsg_type == IPV6_HOPLIMIT)
+            if (cmsg->cmsg_level == IPPROTO_IPV6)
             {
-                int hoplimit;
-
-                memcpy(&hoplimit, CMSG_DATA(cmsg), sizeof(hoplimit));
-                aMessageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
+                if (cmsg->cmsg_type == IPV6_HOPLIMIT)
+                {
+                    int hoplimit;
+
+                    memcpy(&hoplimit, CMSG_DATA(cmsg), sizeof(hoplimit));
+                    mMessageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
+                }
+                else if (cmsg->cmsg_type == IPV6_PKTINFO)
+                {
+                    struct in6_pktinfo pktinfo;
+
+                    memcpy(&pktinfo, CMSG_DATA(cmsg), sizeof(pktinfo));
+
+                    mMessageInfo.mIsHostInterface = (pktinfo.ipi6_ifindex != gNetifIndex);
+                    memcpy(&mMessageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(mMessageInfo.mSockAddr));
+                }
             }
-            else if (cmsg->cmsg_type == IPV6_PKTINFO)
-            {
-                struct in6_pktinfo pktinfo;
+        }
 
-                memcpy(&pktinfo, CMSG_DATA(cmsg), sizeof(pktinfo));
+        mMessageInfo.mPeerPort = ntohs(mPeerAddr.sin6_port);
+        memcpy(&mMessageInfo.mPeerAddr, &mPeerAddr.sin6_addr, sizeof(mMessageInfo.mPeerAddr));
+    }
 
-                aMessageInfo.mIsHostInterface = (pktinfo.ipi6_ifindex != gNetifIndex);
-                memcpy(&aMessageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(aMessageInfo.mSockAddr));
-            }
-        }
+    uint8_t             mPayload[kMaxUdpSize];
+    uint8_t             mControl[kControlSize];
+    struct sockaddr_in6 mPeerAddr;
+    struct iovec        mIov;
+    uint16_t            mLength;
+    otMessageInfo       mMessageInfo;
+};
+
+constexpr uint16_t kMaxRxBatchSize = OPENTHREAD_POSIX_CONFIG_SOCKET_BATCH_SIZE;
+
+RxPacket sRxPackets[kMaxRxBatchSize];
+
+// Receives up to `kMaxRxBatchSize` pending datagrams from `aFd` into `sRxPackets` without blocking, and returns the
+// number of datagrams received. Zero-length datagrams are returned with `mLength` of zero.
+uint16_t receivePackets(int aFd)
+{
+    uint16_t count = 0;
+
+#ifdef __linux__
+    struct mmsghdr msgs[kMaxRxBatchSize];
+    int            rval;
+
+    memset(msgs, 0, sizeof(msgs));
+
+    for (uint16_t i = 0; i < kMaxRxBatchSize; i++)
+    {
+        sRxPackets[i].Prepare(msgs[i].msg_hdr);
     }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+    rval = recvmmsg(aFd, msgs, kMaxRxBatchSize, MSG_DONTWAIT, nullptr);
+
+    if (rval < 0)
+    {
+        VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, perror("recvmmsg"));
+        ExitNow();
+    }
+
+    for (int i = 0; i < rval; i++)
+    {
+        sRxPackets[i].Parse(msgs[i].msg_hdr, msgs[i].msg_len);
+    }
+
+    count = static_cast<uint16_t>(rval);
+#else
+    while (count < kMaxRxBatchSize)
+    {
+        struct msghdr msg;
+        ssize_t       rval;
+
+        sRxPackets[count].Prepare(msg);
+
+        rval = recvmsg(aFd, &msg, MSG_DONTWAIT);
+
+        if (rval < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, perror("recvmsg"));
+            ExitNow();
+        }
+
+        sRxPackets[count].Parse(msg, static_cast<size_t>(rval));
+        count++;
+    }
+#endif
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return count;
 }
 
 } // namespace
@@ -619,34 +689,47 @@ void Udp::Process(const otSysMainloopContext &aContext)
 
         if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
         {
-            otMessageInfo messageInfo;
-            otMessage *   message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+            uint16_t count = receivePackets(fd);
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
-
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
+            if (count == 0)
             {
                 continue;
             }
 
-            message = otUdpNewMessage(mInstance, &msgSettings);
-
-            if (message == nullptr)
-            {
-                continue;
-            }
-
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
+            for (uint16_t i = 0; i < count; i++)
             {
+                RxPacket & packet  = sRxPackets[i];
+                otMessage *message = nullptr;
+
+                // The handler may close or re-create the socket, drop the rest of the batch in that case.
+                if (socket->mHandle != FdToHandle(fd))
+                {
+                    break;
+                }
+
+                if (packet.mLength == 0)
+                {
+                    continue;
+                }
+
+                message = otUdpNewMessage(mInstance, &msgSettings);
+
+                if (message == nullptr)
+                {
+                    continue;
+                }
+
+                if (otMessageAppend(message, packet.mPayload, packet.mLength) != OT_ERROR_NONE)
+                {
+                    otMessageFree(message);
+                    continue;
+                }
+
+                packet.mMessageInfo.mSockPort = socket->mSockName.mPort;
+                socket->mHandler(socket->mContext, message, &packet.mMessageInfo);
                 otMessageFree(message);
-                continue;
             }
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
             // only process one socket a time
             break;
         }
@@ -0,0 +1,794 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements an end-to-end mesh throughput and latency benchmark on the in-process simulation.
+ *
+ *   Usage: ot-nexus-bench-mesh [--topology line|star|grid|sed] [--traffic udp|icmp] [--nodes N] [--size BYTES]
+ *                              [--rate PACKETS_PER_SEC] [--count PACKETS_PER_FLOW] [--seed SEED]
+ *
+ *   Without `--topology` (or `--traffic`) all topologies (or traffic types) are run. The results are written to
+ *   stdout, one JSON object per run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/icmp6.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/udp.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+class Bench
+{
+public:
+    enum Topology : uint8_t
+    {
+        kTopologyLine, // A chain of routers, traffic between the two ends.
+        kTopologyStar, // A center node with leaves, traffic between the leaves.
+        kTopologyGrid, // A grid of routers, traffic between two opposite corners.
+        kTopologySed,  // A few routers with many sleepy children, traffic to and from every child.
+        kNumTopologies,
+    };
+
+    enum Traffic : uint8_t
+    {
+        kTrafficUdp,  // UDP datagrams, one-way latency.
+        kTrafficIcmp, // ICMPv6 Echo Requests, round trip latency.
+        kNumTraffics,
+    };
+
+    struct Config
+    {
+        Topology mTopology;
+        Traffic  mTraffic;
+        uint16_t mNumNodes;
+        uint16_t mSize;
+        uint16_t mRate;
+        uint16_t mCount;
+        uint32_t mSeed;
+    };
+
+    static const char *TopologyToString(Topology aTopology);
+    static const char *TrafficToString(Traffic aTraffic);
+    static uint16_t    GetDefaultNumNodes(Topology aTopology);
+
+    bool Run(const Config &aConfig);
+
+private:
+    enum : uint16_t
+    {
+        kMaxNodes     = 256,
+        kMaxFlows     = 128,
+        kUdpPort      = 0xf0b1,
+        kHeaderLength = 14, // Flow index (2), sequence (4) and transmission time (8).
+    };
+
+    enum : uint32_t
+    {
+        kMaxSamples    = 65536,
+        kJoinInterval  = 100,        // Interval between starting two nodes (in msec).
+        kAttachTimeout = 600 * 1000, // Time to wait for all nodes to attach (in msec).
+        kSettleTime    = 60 * 1000,  // Time for the routes to converge once all nodes are attached (in msec).
+        kDrainTime     = 10 * 1000,  // Time to wait for the packets in flight after the last one is sent (in msec).
+        kSedPollPeriod = 250,        // Poll period of the sleepy children (in msec).
+        kNumSedRouters = 3,          // Number of routers in the SED-heavy topology.
+        kRouterJitter  = 1,          // Router selection jitter (in sec), to speed up the set up.
+        kUsecPerSec    = 1000 * 1000,
+    };
+
+    struct Flow
+    {
+        Node *   mSource;
+        Node *   mDestination;
+        uint32_t mSent;
+        uint32_t mReceived;
+    };
+
+    struct Counters
+    {
+        uint64_t mMacTxFrames;
+        uint64_t mMacTxRetries;
+        uint64_t mMacTxErrors;
+        uint64_t mIpTxFailures;
+        uint64_t mIpRxFailures;
+    };
+
+    Error Build(void);
+    void  AddFlow(uint16_t aSourceId, uint16_t aDestinationId);
+    bool  WaitForNetwork(void);
+    void  Send(uint16_t aFlowIndex);
+    void  HandleReceive(const otMessage &aMessage);
+    void  ReadCounters(Counters &aCounters) const;
+    void  UpdatePoolHighWaterMark(void);
+    void  Report(const Counters &aStart, const Counters &aEnd, uint64_t aCpuTime, uint64_t aDuration);
+    Node &GetNode(uint16_t aId) { return *Core::Get().GetNode(aId); }
+
+    static void     HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    static void     HandleIcmpReceive(void *               aContext,
+                                      otMessage *          aMessage,
+                                      const otMessageInfo *aMessageInfo,
+                                      const otIcmp6Header *aIcmpHeader);
+    static int      CompareSamples(const void *aFirst, const void *aSecond);
+    static uint64_t GetCpuTime(void);
+
+    Config         mConfig;
+    Flow           mFlows[kMaxFlows];
+    uint16_t       mNumFlows;
+    otUdpSocket    mSockets[kMaxNodes];
+    otIcmp6Handler mIcmpHandlers[kMaxNodes];
+    uint32_t       mSamples[kMaxSamples];
+    uint32_t       mNumSamples;
+    uint64_t       mReceivedBytes;
+    uint64_t       mLastReceiveTime;
+    uint16_t       mPoolHighWaterMark;
+};
+
+const char *Bench::TopologyToString(Topology aTopology)
+{
+    static const char *const kTopologyStrings[] = {"line", "star", "grid", "sed"};
+
+    return kTopologyStrings[aTopology];
+}
+
+const char *Bench::TrafficToString(Traffic aTraffic)
+{
+    static const char *const kTrafficStrings[] = {"udp", "icmp"};
+
+    return kTrafficStrings[aTraffic];
+}
+
+uint16_t Bench::GetDefaultNumNodes(Topology aTopology)
+{
+    static const uint16_t kDefaultNumNodes[] = {8, 9, 25, 16};
+
+    return kDefaultNumNodes[aTopology];
+}
+
+bool Bench::Run(const Config &aConfig)
+{
+    Core &   core = Core::Get();
+    Counters start;
+    Counters end;
+    uint64_t cpuTime;
+    uint64_t cpuStart;
+    uint64_t startTime;
+    uint32_t interval;
+    bool     success = false;
+
+    mConfig            = aConfig;
+    mNumFlows          = 0;
+    mNumSamples        = 0;
+    mReceivedBytes     = 0;
+    mLastReceiveTime   = 0;
+    mPoolHighWaterMark = 0;
+
+    if ((mConfig.mNumNodes < 2) || (mConfig.mNumNodes > kMaxNodes) || (mConfig.mSize < kHeaderLength) ||
+        (mConfig.mRate == 0))
+    {
+        fprintf(stderr, "Invalid configuration\n");
+        ExitNow();
+    }
+
+    core.Reset();
+    core.SetRandomSeed(mConfig.mSeed);
+
+    if (Build() != kErrorNone)
+    {
+        fprintf(stderr, "FAILED - could not start the %s network\n", TopologyToString(mConfig.mTopology));
+        ExitNow();
+    }
+
+    if (!WaitForNetwork())
+    {
+        fprintf(stderr, "FAILED - %s network did not converge in %u seconds\n", TopologyToString(mConfig.mTopology),
+                kAttachTimeout / 1000);
+        ExitNow();
+    }
+
+    for (uint16_t id = 1; id <= core.GetNumNodes(); id++)
+    {
+        otInstance *instance = &GetNode(id).GetInstance();
+
+        if (mConfig.mTraffic == kTrafficUdp)
+        {
+            otSockAddr sockAddr;
+
+            memset(&sockAddr, 0, sizeof(sockAddr));
+            sockAddr.mPort = kUdpPort;
+
+            SuccessOrExit(otUdpOpen(instance, &mSockets[id - 1], HandleUdpReceive, this));
+            SuccessOrExit(otUdpBind(instance, &mSockets[id - 1], &sockAddr));
+        }
+        else
+        {
+            memset(&mIcmpHandlers[id - 1], 0, sizeof(otIcmp6Handler));
+            mIcmpHandlers[id - 1].mReceiveCallback = HandleIcmpReceive;
+            mIcmpHandlers[id - 1].mContext         = this;
+
+            SuccessOrExit(otIcmp6RegisterHandler(instance, &mIcmpHandlers[id - 1]));
+        }
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+        otMessageResetPoolStats(instance);
+#endif
+    }
+
+    ReadCounters(start);
+    startTime = core.GetNow();
+    cpuTime   = 0;
+    interval  = OT_MAX(1000 / mConfig.mRate, 1);
+
+    for (uint16_t count = 0; count < mConfig.mCount; count++)
+    {
+        // The flows are spread evenly over the interval. Time advances one millisecond at a time to sample the
+        // message pool occupancy, which is excluded from the CPU time.
+        for (uint32_t elapsed = 0; elapsed < interval; elapsed++)
+        {
+            cpuStart = GetCpuTime();
+
+            for (uint16_t flow = 0; flow < mNumFlows; flow++)
+            {
+                if (flow * interval / mNumFlows == elapsed)
+                {
+                    Send(flow);
+                }
+            }
+
+            core.AdvanceTime(1);
+            cpuTime += GetCpuTime() - cpuStart;
+
+            UpdatePoolHighWaterMark();
+        }
+    }
+
+    cpuStart = GetCpuTime();
+    core.AdvanceTime(kDrainTime);
+    cpuTime += GetCpuTime() - cpuStart;
+
+    UpdatePoolHighWaterMark();
+    ReadCounters(end);
+
+    Report(start, end, cpuTime, ((mLastReceiveTime > startTime) ? mLastReceiveTime - startTime : 0));
+    success = true;
+
+exit:
+    return success;
+}
+
+Error Bench::Build(void)
+{
+    Error    error    = kErrorNone;
+    Core &   core     = Core::Get();
+    uint16_t numNodes = mConfig.mNumNodes;
+    uint16_t columns  = 1;
+
+    while (columns * columns < numNodes)
+    {
+        columns++;
+    }
+
+    for (uint16_t id = 1; id <= numNodes; id++)
+    {
+        core.CreateNode();
+    }
+
+    switch (mConfig.mTopology)
+    {
+    case kTopologyLine:
+        for (uint16_t id = 2; id <= numNodes; id++)
+        {
+            core.Connect(GetNode(id - 1), GetNode(id));
+        }
+
+        AddFlow(numNodes, 1);
+        break;
+
+    case kTopologyStar:
+        for (uint16_t id = 2; id <= numNodes; id++)
+        {
+            core.Connect(GetNode(1), GetNode(id));
+        }
+
+        for (uint16_t id = 2; id <= numNodes; id++)
+        {
+            AddFlow(id, (id == numNodes) ? 2 : id + 1);
+        }
+
+        break;
+
+    case kTopologyGrid:
+        for (uint16_t i = 0; i < numNodes; i++)
+        {
+            for (uint16_t j = 0; j < i; j++)
+            {
+                int dx = (i % columns) - (j % columns);
+                int dy = (i / columns) - (j / columns);
+
+                // Each node hears its eight surrounding neighbors.
+                if ((dx * dx <= 1) && (dy * dy <= 1))
+                {
+                    core.Connect(GetNode(i + 1), GetNode(j + 1));
+                }
+            }
+        }
+
+        AddFlow(numNodes, 1);
+        break;
+
+    case kTopologySed:
+        for (uint16_t id = 2; id <= numNodes; id++)
+        {
+            for (uint16_t router = 1; router < OT_MIN(id, static_cast<uint16_t>(kNumSedRouters + 1)); router++)
+            {
+                core.Connect(GetNode(router), GetNode(id));
+            }
+        }
+
+        for (uint16_t id = kNumSedRouters + 1; id <= numNodes; id++)
+        {
+            AddFlow(id, 1);
+            AddFlow(1, id);
+        }
+
+        break;
+
+    case kNumTopologies:
+        break;
+    }
+
+    for (uint16_t id = 1; id <= numNodes; id++)
+    {
+        otInstance *instance = &GetNode(id).GetInstance();
+
+        otThreadSetRouterSelectionJitter(instance, kRouterJitter);
+
+        if (id == 1)
+        {
+            SuccessOrExit(error = GetNode(id).Form());
+        }
+        else
+        {
+            bool isSed = (mConfig.mTopology == kTopologySed) && (id > kNumSedRouters);
+
+            if (isSed)
+            {
+                otLinkSetPollPeriod(instance, kSedPollPeriod);
+            }
+
+            SuccessOrExit(error = GetNode(id).Join(GetNode(1), isSed ? Node::kAsSed : Node::kAsFtd));
+        }
+
+        core.AdvanceTime(kJoinInterval);
+    }
+
+exit:
+    return error;
+}
+
+void Bench::AddFlow(uint16_t aSourceId, uint16_t aDestinationId)
+{
+    Flow *flow;
+
+    VerifyOrExit(mNumFlows < kMaxFlows);
+
+    flow               = &mFlows[mNumFlows++];
+    flow->mSource      = &GetNode(aSourceId);
+    flow->mDestination = &GetNode(aDestinationId);
+    flow->mSent        = 0;
+    flow->mReceived    = 0;
+
+exit:
+    return;
+}
+
+bool Bench::WaitForNetwork(void)
+{
+    Core &   core    = Core::Get();
+    uint32_t elapsed = 0;
+    bool     ready   = false;
+
+    // All nodes must be attached to a single partition. Partitions merge only when a router hears a better
+    // partition, which may take a while when the neighbors at a partition boundary are all end devices.
+
+    while (!ready && (elapsed < kAttachTimeout))
+    {
+        uint32_t partitionId = otThreadGetPartitionId(&GetNode(1).GetInstance());
+
+        ready = true;
+
+        for (uint16_t id = 1; id <= core.GetNumNodes(); id++)
+        {
+            otInstance * instance = &GetNode(id).GetInstance();
+            otDeviceRole role     = otThreadGetDeviceRole(instance);
+
+            if (((role != OT_DEVICE_ROLE_CHILD) && (role != OT_DEVICE_ROLE_ROUTER) && (role != OT_DEVICE_ROLE_LEADER)) ||
+                (otThreadGetPartitionId(instance) != partitionId))
+            {
+                ready = false;
+                break;
+            }
+        }
+
+        core.AdvanceTime(1000);
+        elapsed += 1000;
+    }
+
+    if (ready)
+    {
+        core.AdvanceTime(kSettleTime);
+    }
+
+    return ready;
+}
+
+void Bench::Send(uint16_t aFlowIndex)
+{
+    Flow &        flow     = mFlows[aFlowIndex];
+    otInstance *  instance = &flow.mSource->GetInstance();
+    otMessage *   message  = nullptr;
+    otMessageInfo messageInfo;
+    uint8_t       header[kHeaderLength];
+    uint64_t      now = Core::Get().GetNow();
+    otError       error;
+
+    memcpy(&header[0], &aFlowIndex, sizeof(uint16_t));
+    memcpy(&header[2], &flow.mSent, sizeof(uint32_t));
+    memcpy(&header[6], &now, sizeof(uint64_t));
+
+    flow.mSent++;
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = *otThreadGetMeshLocalEid(&flow.mDestination->GetInstance());
+    messageInfo.mPeerPort = kUdpPort;
+
+    if (mConfig.mTraffic == kTrafficUdp)
+    {
+        message = otUdpNewMessage(instance, nullptr);
+    }
+    else
+    {
+        message = otIp6NewMessage(instance, nullptr);
+    }
+
+    VerifyOrExit(message != nullptr);
+
+    SuccessOrExit(error = otMessageAppend(message, header, sizeof(header)));
+    SuccessOrExit(error = otMessageSetLength(message, otMessageGetLength(message) + mConfig.mSize - kHeaderLength));
+
+    if (mConfig.mTraffic == kTrafficUdp)
+    {
+        error = otUdpSend(instance, &mSockets[flow.mSource->GetId() - 1], message, &messageInfo);
+    }
+    else
+    {
+        error = otIcmp6SendEchoRequest(instance, message, &messageInfo, aFlowIndex + 1);
+    }
+
+    SuccessOrExit(error);
+    message = nullptr;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+}
+
+void Bench::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    static_cast<Bench *>(aContext)->HandleReceive(*aMessage);
+}
+
+void Bench::HandleIcmpReceive(void *               aContext,
+                              otMessage *          aMessage,
+                              const otMessageInfo *aMessageInfo,
+                              const otIcmp6Header *aIcmpHeader)
+{
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrExit(aIcmpHeader->mType == OT_ICMP6_TYPE_ECHO_REPLY);
+    static_cast<Bench *>(aContext)->HandleReceive(*aMessage);
+
+exit:
+    return;
+}
+
+void Bench::HandleReceive(const otMessage &aMessage)
+{
+    uint8_t  header[kHeaderLength];
+    uint16_t flowIndex;
+    uint64_t txTime;
+    uint64_t now = Core::Get().GetNow();
+
+    VerifyOrExit(otMessageGetLength(&aMessage) - otMessageGetOffset(&aMessage) == mConfig.mSize);
+    VerifyOrExit(otMessageRead(&aMessage, otMessageGetOffset(&aMessage), header, sizeof(header)) == sizeof(header));
+
+    memcpy(&flowIndex, &header[0], sizeof(uint16_t));
+    memcpy(&txTime, &header[6], sizeof(uint64_t));
+    VerifyOrExit(flowIndex < mNumFlows);
+
+    mFlows[flowIndex].mReceived++;
+    mReceivedBytes += mConfig.mSize;
+    mLastReceiveTime = now;
+
+    if (mNumSamples < kMaxSamples)
+    {
+        mSamples[mNumSamples++] = static_cast<uint32_t>(now - txTime);
+    }
+
+exit:
+    return;
+}
+
+void Bench::ReadCounters(Counters &aCounters) const
+{
+    Core &core = Core::Get();
+
+    memset(&aCounters, 0, sizeof(aCounters));
+
+    for (uint16_t id = 1; id <= core.GetNumNodes(); id++)
+    {
+        otInstance *         instance   = &core.GetNode(id)->GetInstance();
+        const otMacCounters *macCounters = otLinkGetCounters(instance);
+        const otIpCounters * ipCounters  = otThreadGetIp6Counters(instance);
+
+        aCounters.mMacTxFrames += macCounters->mTxTotal;
+        aCounters.mMacTxRetries += macCounters->mTxRetry;
+        aCounters.mMacTxErrors += macCounters->mTxErrAbort + macCounters->mTxErrBusyChannel +
+                                  macCounters->mTxDirectMaxRetryExpiry + macCounters->mTxIndirectMaxRetryExpiry;
+        aCounters.mIpTxFailures += ipCounters->mTxFailure;
+        aCounters.mIpRxFailures += ipCounters->mRxFailure;
+    }
+}
+
+void Bench::UpdatePoolHighWaterMark(void)
+{
+    Core &core = Core::Get();
+
+    for (uint16_t id = 1; id <= core.GetNumNodes(); id++)
+    {
+        uint16_t inUse;
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+        otMessagePoolStats stats;
+
+        otMessageGetPoolStats(&core.GetNode(id)->GetInstance(), &stats);
+        inUse = stats.mMaxBuffersInUse;
+#else
+        otBufferInfo bufferInfo;
+
+        otMessageGetBufferInfo(&core.GetNode(id)->GetInstance(), &bufferInfo);
+        inUse = bufferInfo.mTotalBuffers - bufferInfo.mFreeBuffers;
+#endif
+
+        mPoolHighWaterMark = OT_MAX(mPoolHighWaterMark, inUse);
+    }
+}
+
+void Bench::Report(const Counters &aStart, const Counters &aEnd, uint64_t aCpuTime, uint64_t aDuration)
+{
+    uint32_t sent     = 0;
+    uint32_t received = 0;
+    uint32_t p50      = 0;
+    uint32_t p99      = 0;
+    uint64_t goodput  = 0;
+
+    for (uint16_t flow = 0; flow < mNumFlows; flow++)
+    {
+        sent += mFlows[flow].mSent;
+        received += mFlows[flow].mReceived;
+    }
+
+    if (mNumSamples > 0)
+    {
+        qsort(mSamples, mNumSamples, sizeof(mSamples[0]), CompareSamples);
+        p50 = mSamples[(mNumSamples - 1) * 50 / 100];
+        p99 = mSamples[(mNumSamples - 1) * 99 / 100];
+    }
+
+    if (aDuration > 0)
+    {
+        goodput = mReceivedBytes * 8 * kUsecPerSec / aDuration;
+    }
+
+    printf("{\"topology\":\"%s\",\"traffic\":\"%s\",\"nodes\":%u,\"flows\":%u,\"size\":%u,\"rate\":%u,\"seed\":%u,"
+           "\"sent\":%u,\"received\":%u,\"dropped\":%u,\"goodput_bps\":%llu,\"latency_p50_us\":%u,"
+           "\"latency_p99_us\":%u,\"mac_tx_frames\":%llu,\"mac_tx_retries\":%llu,\"mac_tx_errors\":%llu,"
+           "\"ip_tx_failures\":%llu,\"ip_rx_failures\":%llu,\"pool_max_buffers\":%u,\"cpu_us_per_packet\":%llu}\n",
+           TopologyToString(mConfig.mTopology), TrafficToString(mConfig.mTraffic), mConfig.mNumNodes, mNumFlows,
+           mConfig.mSize, mConfig.mRate, mConfig.mSeed, sent, received, sent - received,
+           static_cast<unsigned long long>(goodput), p50, p99,
+           static_cast<unsigned long long>(aEnd.mMacTxFrames - aStart.mMacTxFrames),
+           static_cast<unsigned long long>(aEnd.mMacTxRetries - aStart.mMacTxRetries),
+           static_cast<unsigned long long>(aEnd.mMacTxErrors - aStart.mMacTxErrors),
+           static_cast<unsigned long long>(aEnd.mIpTxFailures - aStart.mIpTxFailures),
+           static_cast<unsigned long long>(aEnd.mIpRxFailures - aStart.mIpRxFailures), mPoolHighWaterMark,
+           static_cast<unsigned long long>((sent > 0) ? aCpuTime / sent : 0));
+    fflush(stdout);
+}
+
+int Bench::CompareSamples(const void *aFirst, const void *aSecond)
+{
+    uint32_t first  = *static_cast<const uint32_t *>(aFirst);
+    uint32_t second = *static_cast<const uint32_t *>(aSecond);
+
+    return (first < second) ? -1 : ((first > second) ? 1 : 0);
+}
+
+uint64_t Bench::GetCpuTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * kUsecPerSec + static_cast<uint64_t>(now.tv_nsec / 1000);
+}
+
+static Bench sBench;
+
+} // namespace Nexus
+} // namespace ot
+
+using ot::Nexus::Bench;
+
+static void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [--topology line|star|grid|sed] [--traffic udp|icmp] [--nodes N] [--size BYTES]\n"
+            "          [--rate PACKETS_PER_SEC] [--count PACKETS_PER_FLOW] [--seed SEED]\n",
+            aProgram);
+}
+
+int main(int argc, char *argv[])
+{
+    Bench::Config config;
+    int           topology = -1;
+    int           traffic  = -1;
+    uint16_t      numNodes = 0;
+    int           status   = EXIT_SUCCESS;
+
+    config.mSize  = 64;
+    config.mRate  = 2;
+    config.mCount = 50;
+    config.mSeed  = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if (value == nullptr)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (strcmp(argv[i], "--topology") == 0)
+        {
+            for (topology = Bench::kNumTopologies - 1; topology >= 0; topology--)
+            {
+                if (strcmp(value, Bench::TopologyToString(static_cast<Bench::Topology>(topology))) == 0)
+                {
+                    break;
+                }
+            }
+
+            if (topology < 0)
+            {
+                PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--traffic") == 0)
+        {
+            for (traffic = Bench::kNumTraffics - 1; traffic >= 0; traffic--)
+            {
+                if (strcmp(value, Bench::TrafficToString(static_cast<Bench::Traffic>(traffic))) == 0)
+                {
+                    break;
+                }
+            }
+
+            if (traffic < 0)
+            {
+                PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--nodes") == 0)
+        {
+            numNodes = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (strcmp(argv[i], "--size") == 0)
+        {
+            config.mSize = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (strcmp(argv[i], "--rate") == 0)
+        {
+            config.mRate = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (strcmp(argv[i], "--count") == 0)
+        {
+            config.mCount = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (strcmp(argv[i], "--seed") == 0)
+        {
+            config.mSeed = static_cast<uint32_t>(strtoul(value, nullptr, 0));
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        i++;
+    }
+
+    ot::Nexus::Core::Get().SetLogEnabled(getenv("NEXUS_LOG") != nullptr);
+
+    for (int t = 0; t < Bench::kNumTopologies; t++)
+    {
+        if ((topology >= 0) && (t != topology))
+        {
+            continue;
+        }
+
+        for (int f = 0; f < Bench::kNumTraffics; f++)
+        {
+            if ((traffic >= 0) && (f != traffic))
+            {
+                continue;
+            }
+
+            config.mTopology = static_cast<Bench::Topology>(t);
+            config.mTraffic  = static_cast<Bench::Traffic>(f);
+            config.mNumNodes = (numNodes != 0) ? numNodes : Bench::GetDefaultNumNodes(config.mTopology);
+
+            if (!ot::Nexus::sBench.Run(config))
+            {
+                status = EXIT_FAILURE;
+            }
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,431 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the in-process simulation core.
+ */
+
+#include "nexus_core.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventHeap
+
+EventHeap::EventHeap(void)
+    : mEvents(nullptr)
+    , mSize(0)
+    , mCapacity(0)
+    , mSequence(0)
+{
+}
+
+EventHeap::~EventHeap(void)
+{
+    free(mEvents);
+}
+
+void EventHeap::Schedule(Event &aEvent, uint64_t aTime)
+{
+    Cancel(aEvent);
+
+    if (mSize == mCapacity)
+    {
+        mCapacity = (mCapacity == 0) ? 64 : 2 * mCapacity;
+        mEvents   = static_cast<Event **>(realloc(mEvents, mCapacity * sizeof(Event *)));
+        OT_ASSERT(mEvents != nullptr);
+    }
+
+    aEvent.mTime     = aTime;
+    aEvent.mSequence = mSequence++;
+    Place(aEvent, mSize++);
+    SiftUp(aEvent.mHeapIndex);
+}
+
+void EventHeap::Cancel(Event &aEvent)
+{
+    uint32_t index = aEvent.mHeapIndex;
+    Event *  last;
+
+    VerifyOrExit(aEvent.IsScheduled());
+
+    aEvent.mHeapIndex = Event::kNotScheduled;
+    last              = mEvents[--mSize];
+
+    VerifyOrExit(last != &aEvent);
+
+    Place(*last, index);
+    SiftUp(index);
+    SiftDown(last->mHeapIndex);
+
+exit:
+    return;
+}
+
+void EventHeap::Place(Event &aEvent, uint32_t aIndex)
+{
+    mEvents[aIndex]   = &aEvent;
+    aEvent.mHeapIndex = aIndex;
+}
+
+void EventHeap::SiftUp(uint32_t aIndex)
+{
+    Event &event = *mEvents[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint32_t parent = (aIndex - 1) / 2;
+
+        if (!event.IsBefore(*mEvents[parent]))
+        {
+            break;
+        }
+
+        Place(*mEvents[parent], aIndex);
+        aIndex = parent;
+    }
+
+    Place(event, aIndex);
+}
+
+void EventHeap::SiftDown(uint32_t aIndex)
+{
+    Event &event = *mEvents[aIndex];
+
+    while (true)
+    {
+        uint32_t child = 2 * aIndex + 1;
+
+        if (child >= mSize)
+        {
+            break;
+        }
+
+        if ((child + 1 < mSize) && mEvents[child + 1]->IsBefore(*mEvents[child]))
+        {
+            child++;
+        }
+
+        if (!mEvents[child]->IsBefore(event))
+        {
+            break;
+        }
+
+        Place(*mEvents[child], aIndex);
+        aIndex = child;
+    }
+
+    Place(event, aIndex);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Core
+
+Core::Core(void)
+    : mNow(0)
+    , mNodes(nullptr)
+    , mNumNodes(0)
+    , mNodesCapacity(0)
+    , mPendingHead(nullptr)
+    , mPendingTail(nullptr)
+    , mCurrentNode(nullptr)
+    , mRandomState(1)
+    , mLogEnabled(false)
+{
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+Core &Core::Get(void)
+{
+    static Core sCore;
+
+    return sCore;
+}
+
+Node &Core::CreateNode(void)
+{
+    Node *node;
+
+    if (mNumNodes == mNodesCapacity)
+    {
+        mNodesCapacity = (mNodesCapacity == 0) ? 16 : 2 * mNodesCapacity;
+        mNodes         = static_cast<Node **>(realloc(mNodes, mNodesCapacity * sizeof(Node *)));
+        OT_ASSERT(mNodes != nullptr);
+    }
+
+    node              = new Node(mNumNodes + 1);
+    mNodes[mNumNodes] = node;
+    mNumNodes++;
+
+    mCurrentNode = node;
+    node->Init();
+    mCurrentNode = nullptr;
+
+    return *node;
+}
+
+void Core::Reset(void)
+{
+    for (uint16_t i = 0; i < mNumNodes; i++)
+    {
+        mCurrentNode = mNodes[i];
+        delete mNodes[i];
+    }
+
+    OT_ASSERT(mEvents.GetTop() == nullptr);
+
+    mNumNodes    = 0;
+    mNow         = 0;
+    mPendingHead = nullptr;
+    mPendingTail = nullptr;
+    mCurrentNode = nullptr;
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+Node *Core::GetNode(uint16_t aId) const
+{
+    return ((aId >= 1) && (aId <= mNumNodes)) ? mNodes[aId - 1] : nullptr;
+}
+
+void Core::SetLink(Node &aFrom, Node &aTo, int8_t aRssi, uint8_t aLossPercent)
+{
+    Node::Link *link = aFrom.FindLink(aTo);
+
+    OT_ASSERT(&aFrom != &aTo);
+
+    if (link == nullptr)
+    {
+        link         = new Node::Link;
+        link->mNext  = aFrom.mLinks;
+        link->mPeer  = &aTo;
+        aFrom.mLinks = link;
+    }
+
+    link->mRssi        = aRssi;
+    link->mLossPercent = aLossPercent;
+}
+
+void Core::Connect(Node &aNode1, Node &aNode2, int8_t aRssi, uint8_t aLossPercent)
+{
+    SetLink(aNode1, aNode2, aRssi, aLossPercent);
+    SetLink(aNode2, aNode1, aRssi, aLossPercent);
+}
+
+void Core::Disconnect(Node &aNode1, Node &aNode2)
+{
+    Node *nodes[][2] = {{&aNode1, &aNode2}, {&aNode2, &aNode1}};
+
+    for (Node **pair : nodes)
+    {
+        for (Node::Link **link = &pair[0]->mLinks; *link != nullptr; link = &(*link)->mNext)
+        {
+            if ((*link)->mPeer == pair[1])
+            {
+                Node::Link *removed = *link;
+
+                *link = removed->mNext;
+                delete removed;
+                break;
+            }
+        }
+    }
+}
+
+void Core::AdvanceTime(uint32_t aDuration)
+{
+    uint64_t until = mNow + static_cast<uint64_t>(aDuration) * 1000;
+    Event *  event;
+
+    while (true)
+    {
+        ProcessTasklets();
+
+        event = mEvents.GetTop();
+
+        if ((event == nullptr) || (event->GetTime() > until))
+        {
+            break;
+        }
+
+        mNow = event->GetTime();
+        mEvents.Cancel(*event);
+        HandleEvent(*event);
+    }
+
+    mNow = until;
+}
+
+void Core::HandleEvent(Event &aEvent)
+{
+    mCounters.mEventsHandled++;
+
+    mCurrentNode = &aEvent.GetNode();
+    aEvent.GetNode().HandleEvent(aEvent);
+    mCurrentNode = nullptr;
+}
+
+void Core::SignalTaskletsPending(Node &aNode)
+{
+    VerifyOrExit(!aNode.mTaskletsPending);
+
+    aNode.mTaskletsPending = true;
+    aNode.mNextPending     = nullptr;
+
+    if (mPendingTail == nullptr)
+    {
+        mPendingHead = &aNode;
+    }
+    else
+    {
+        mPendingTail->mNextPending = &aNode;
+    }
+
+    mPendingTail = &aNode;
+
+exit:
+    return;
+}
+
+Node *Core::PopPendingNode(void)
+{
+    Node *node = mPendingHead;
+
+    VerifyOrExit(node != nullptr);
+
+    mPendingHead = node->mNextPending;
+
+    if (mPendingHead == nullptr)
+    {
+        mPendingTail = nullptr;
+    }
+
+    node->mTaskletsPending = false;
+
+exit:
+    return node;
+}
+
+void Core::ProcessTasklets(void)
+{
+    Node *node;
+
+    // Only nodes which signaled pending tasklets are visited, so the
+    // cost does not grow with the number of idle nodes.
+
+    while ((node = PopPendingNode()) != nullptr)
+    {
+        mCurrentNode = node;
+        otTaskletsProcess(&node->GetInstance());
+        mCurrentNode = nullptr;
+
+        if (otTaskletsArePending(&node->GetInstance()))
+        {
+            SignalTaskletsPending(*node);
+        }
+    }
+}
+
+bool Core::DeliverFrame(Node &aSender, const otRadioFrame &aFrame, otRadioFrame &aAckFrame)
+{
+    bool acked = false;
+
+    mCounters.mTxFrames++;
+
+    for (const Node::Link *link = aSender.mLinks; link != nullptr; link = link->mNext)
+    {
+        Node &receiver = *link->mPeer;
+
+        if ((receiver.mRadioState != OT_RADIO_STATE_RECEIVE) || (receiver.mChannel != aFrame.mChannel))
+        {
+            mCounters.mOffChannel++;
+            continue;
+        }
+
+        if (IsLost(link->mLossPercent))
+        {
+            mCounters.mLostFrames++;
+            continue;
+        }
+
+        mCounters.mRxFrames++;
+
+        mCurrentNode = &receiver;
+
+        if (receiver.HandleFrame(aFrame, link->mRssi, aAckFrame))
+        {
+            const Node::Link *reverse = receiver.FindLink(aSender);
+
+            // The acknowledgment goes over the reverse link.
+            acked = (reverse != nullptr) && !IsLost(reverse->mLossPercent);
+
+            if (acked)
+            {
+                aAckFrame.mInfo.mRxInfo.mRssi = reverse->mRssi;
+            }
+        }
+
+        mCurrentNode = &aSender;
+    }
+
+    return acked;
+}
+
+bool Core::IsLost(uint8_t aLossPercent)
+{
+    return (aLossPercent != 0) && ((GetRandom() % 100) < aLossPercent);
+}
+
+uint32_t Core::GetRandom(void)
+{
+    // xorshift32
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+
+    return mRandomState;
+}
+
+void Core::SetRandomSeed(uint32_t aSeed)
+{
+    mRandomState = (aSeed == 0) ? 1 : aSeed;
+}
+
+} // namespace Nexus
+} // namespace ot
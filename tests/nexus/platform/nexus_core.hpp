@@ -0,0 +1,409 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the in-process simulation core (event scheduler and radio medium).
+ */
+
+#ifndef NEXUS_CORE_HPP_
+#define NEXUS_CORE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/platform/radio.h>
+
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Nexus {
+
+class Node;
+
+/**
+ * This class represents an event on the virtual time line.
+ *
+ * Events are owned by the `Node`s. An event is either scheduled (in the `Core` event heap) or idle.
+ *
+ */
+class Event : private NonCopyable
+{
+    friend class EventHeap;
+
+public:
+    enum Type : uint8_t
+    {
+        kTypeAlarmMilli, ///< The millisecond alarm of a node fires.
+        kTypeAlarmMicro, ///< The microsecond alarm of a node fires.
+        kTypeRadio,      ///< The radio of a node finishes its current operation.
+        kTypeReset,      ///< A node resets (requested through `otPlatReset()`).
+    };
+
+    /**
+     * This constructor initializes the event.
+     *
+     * @param[in] aNode  The node owning the event.
+     * @param[in] aType  The event type.
+     *
+     */
+    Event(Node &aNode, Type aType)
+        : mTime(0)
+        , mSequence(0)
+        , mHeapIndex(kNotScheduled)
+        , mNode(aNode)
+        , mType(aType)
+    {
+    }
+
+    /**
+     * This method indicates whether the event is scheduled.
+     *
+     * @retval TRUE   The event is scheduled.
+     * @retval FALSE  The event is idle.
+     *
+     */
+    bool IsScheduled(void) const { return mHeapIndex != kNotScheduled; }
+
+    /**
+     * This method returns the virtual time of the event (in microseconds).
+     *
+     * @returns The event time.
+     *
+     */
+    uint64_t GetTime(void) const { return mTime; }
+
+    /**
+     * This method returns the node owning the event.
+     *
+     * @returns The node.
+     *
+     */
+    Node &GetNode(void) const { return mNode; }
+
+    /**
+     * This method returns the event type.
+     *
+     * @returns The event type.
+     *
+     */
+    Type GetType(void) const { return mType; }
+
+private:
+    static constexpr uint32_t kNotScheduled = 0xffffffff;
+
+    bool IsBefore(const Event &aOther) const
+    {
+        return (mTime < aOther.mTime) || ((mTime == aOther.mTime) && (mSequence < aOther.mSequence));
+    }
+
+    uint64_t mTime;
+    uint32_t mSequence;
+    uint32_t mHeapIndex;
+    Node &   mNode;
+    Type     mType;
+};
+
+/**
+ * This class implements an indexed binary min-heap of events, ordered by time and then by scheduling order.
+ *
+ * Each event records its index in the heap, so an event can be rescheduled or canceled in O(log n).
+ *
+ */
+class EventHeap : private NonCopyable
+{
+public:
+    EventHeap(void);
+    ~EventHeap(void);
+
+    /**
+     * This method schedules (or reschedules) an event.
+     *
+     * @param[in] aEvent  The event.
+     * @param[in] aTime   The virtual time (in microseconds).
+     *
+     */
+    void Schedule(Event &aEvent, uint64_t aTime);
+
+    /**
+     * This method cancels an event. It is a no-op if the event is not scheduled.
+     *
+     * @param[in] aEvent  The event.
+     *
+     */
+    void Cancel(Event &aEvent);
+
+    /**
+     * This method returns the earliest event.
+     *
+     * @returns A pointer to the earliest event, or `nullptr` if no event is scheduled.
+     *
+     */
+    Event *GetTop(void) const { return (mSize > 0) ? mEvents[0] : nullptr; }
+
+private:
+    void Place(Event &aEvent, uint32_t aIndex);
+    void SiftUp(uint32_t aIndex);
+    void SiftDown(uint32_t aIndex);
+
+    Event ** mEvents;
+    uint32_t mSize;
+    uint32_t mCapacity;
+    uint32_t mSequence;
+};
+
+/**
+ * This class implements the simulation core.
+ *
+ * The core owns the nodes, the virtual clock shared by all nodes, the event scheduler and the radio medium. The radio
+ * medium only delivers a frame over a link between two nodes, when the receiver is listening on the channel of the
+ * frame. Each link is directional and has its own RSSI and frame loss probability.
+ *
+ */
+class Core : private NonCopyable
+{
+public:
+    /**
+     * This structure holds the radio medium counters.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mTxFrames;      ///< Number of frames transmitted.
+        uint64_t mRxFrames;      ///< Number of frames delivered to a receiver.
+        uint64_t mLostFrames;    ///< Number of frames dropped because of link loss.
+        uint64_t mOffChannel;    ///< Number of frames not received as the neighbor was not listening on the channel.
+        uint64_t mEventsHandled; ///< Number of events handled.
+    };
+
+    /**
+     * This static method returns the simulation core.
+     *
+     * @returns A reference to the simulation core.
+     *
+     */
+    static Core &Get(void);
+
+    /**
+     * This method creates a new node. Node IDs start at 1 and are assigned in creation order.
+     *
+     * @returns A reference to the new node.
+     *
+     */
+    Node &CreateNode(void);
+
+    /**
+     * This method removes all nodes and restarts the virtual time and the counters from zero.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method returns a node by its ID.
+     *
+     * @param[in] aId  The node ID.
+     *
+     * @returns A pointer to the node, or `nullptr` if there is no such node.
+     *
+     */
+    Node *GetNode(uint16_t aId) const;
+
+    /**
+     * This method returns the number of nodes.
+     *
+     * @returns The number of nodes.
+     *
+     */
+    uint16_t GetNumNodes(void) const { return mNumNodes; }
+
+    /**
+     * This method adds (or updates) a directional link.
+     *
+     * @param[in] aFrom         The transmitting node.
+     * @param[in] aTo           The receiving node.
+     * @param[in] aRssi         The RSSI of the frames received over the link.
+     * @param[in] aLossPercent  The probability (in percent) of a frame being lost over the link.
+     *
+     */
+    void SetLink(Node &aFrom, Node &aTo, int8_t aRssi = kDefaultRssi, uint8_t aLossPercent = 0);
+
+    /**
+     * This method adds (or updates) links in both directions between two nodes.
+     *
+     * @param[in] aNode1        The first node.
+     * @param[in] aNode2        The second node.
+     * @param[in] aRssi         The RSSI of the frames received over the links.
+     * @param[in] aLossPercent  The probability (in percent) of a frame being lost over each link.
+     *
+     */
+    void Connect(Node &aNode1, Node &aNode2, int8_t aRssi = kDefaultRssi, uint8_t aLossPercent = 0);
+
+    /**
+     * This method removes the links in both directions between two nodes.
+     *
+     * @param[in] aNode1  The first node.
+     * @param[in] aNode2  The second node.
+     *
+     */
+    void Disconnect(Node &aNode1, Node &aNode2);
+
+    /**
+     * This method advances the virtual time, processing all tasklets and events which are due.
+     *
+     * @param[in] aDuration  The duration (in milliseconds).
+     *
+     */
+    void AdvanceTime(uint32_t aDuration);
+
+    /**
+     * This method returns the current virtual time (in microseconds).
+     *
+     * @returns The current virtual time.
+     *
+     */
+    uint64_t GetNow(void) const { return mNow; }
+
+    /**
+     * This method returns the node on behalf of which OpenThread code is currently running.
+     *
+     * @returns A pointer to the current node, or `nullptr` if none.
+     *
+     */
+    Node *GetCurrentNode(void) const { return mCurrentNode; }
+
+    /**
+     * This method sets the node on behalf of which OpenThread code is currently running (used for logging).
+     *
+     * @param[in] aNode  A pointer to the node, or `nullptr`.
+     *
+     */
+    void SetCurrentNode(Node *aNode) { mCurrentNode = aNode; }
+
+    /**
+     * This method enables or disables printing of the OpenThread logs.
+     *
+     * @param[in] aEnabled  TRUE to print the logs, FALSE otherwise.
+     *
+     */
+    void SetLogEnabled(bool aEnabled) { mLogEnabled = aEnabled; }
+
+    /**
+     * This method indicates whether printing of the OpenThread logs is enabled.
+     *
+     * @retval TRUE   The logs are printed.
+     * @retval FALSE  The logs are discarded.
+     *
+     */
+    bool IsLogEnabled(void) const { return mLogEnabled; }
+
+    /**
+     * This method returns the radio medium counters.
+     *
+     * @returns The counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method returns a pseudo random number. The sequence is deterministic for a given seed.
+     *
+     * @returns A pseudo random number.
+     *
+     */
+    uint32_t GetRandom(void);
+
+    /**
+     * This method sets the seed of the pseudo random number generator.
+     *
+     * The seed should be set before the first node is created for a simulation run to be reproducible.
+     *
+     * @param[in] aSeed  The seed.
+     *
+     */
+    void SetRandomSeed(uint32_t aSeed);
+
+    /**
+     * This method returns the event scheduler.
+     *
+     * @returns A reference to the event scheduler.
+     *
+     */
+    EventHeap &GetEventHeap(void) { return mEvents; }
+
+    /**
+     * This method marks a node as having pending tasklets.
+     *
+     * @param[in] aNode  The node.
+     *
+     */
+    void SignalTaskletsPending(Node &aNode);
+
+    /**
+     * This method delivers a frame transmitted by a node to all its neighbors listening on the frame channel.
+     *
+     * @param[in]  aSender  The transmitting node.
+     * @param[in]  aFrame   The frame.
+     * @param[out] aAckFrame  A buffer to output the acknowledgment frame.
+     *
+     * @retval TRUE   A neighbor acknowledged the frame and @p aAckFrame is populated.
+     * @retval FALSE  The frame was not acknowledged.
+     *
+     */
+    bool DeliverFrame(Node &aSender, const otRadioFrame &aFrame, otRadioFrame &aAckFrame);
+
+    enum : int8_t
+    {
+        kDefaultRssi = -50, ///< The default RSSI of a link.
+    };
+
+private:
+    Core(void);
+
+    void  ProcessTasklets(void);
+    void  HandleEvent(Event &aEvent);
+    bool  IsLost(uint8_t aLossPercent);
+    Node *PopPendingNode(void);
+
+    uint64_t  mNow;
+    Node **   mNodes;
+    uint16_t  mNumNodes;
+    uint16_t  mNodesCapacity;
+    Node *    mPendingHead;
+    Node *    mPendingTail;
+    Node *    mCurrentNode;
+    EventHeap mEvents;
+    Counters  mCounters;
+    uint32_t  mRandomState;
+    bool      mLogEnabled;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_CORE_HPP_
@@ -0,0 +1,603 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a simulated node.
+ */
+
+#include "nexus_node.hpp"
+
+#include <string.h>
+
+#include <openthread/dataset.h>
+#include <openthread/dataset_ftd.h>
+#include <openthread/ip6.h>
+#include <openthread/thread.h>
+
+#include "common/debug.hpp"
+#include "mac/mac_frame.hpp"
+
+namespace ot {
+namespace Nexus {
+
+Node::Node(uint16_t aId)
+    : mId(aId)
+    , mTaskletsPending(false)
+    , mNextPending(nullptr)
+    , mLinks(nullptr)
+    , mAlarmMilliEvent(*this, Event::kTypeAlarmMilli)
+    , mAlarmMicroEvent(*this, Event::kTypeAlarmMicro)
+    , mRadioEvent(*this, Event::kTypeRadio)
+    , mResetEvent(*this, Event::kTypeReset)
+    , mRadioState(OT_RADIO_STATE_DISABLED)
+    , mRadioOperation(kOperationNone)
+    , mChannel(0)
+    , mPromiscuous(false)
+    , mAcked(false)
+    , mTxError(kErrorNone)
+    , mTxPower(0)
+    , mPanId(0xffff)
+    , mShortAddress(0xfffe)
+    , mSrcMatchEnabled(false)
+    , mNumSrcMatchShort(0)
+    , mNumSrcMatchExt(0)
+{
+    memset(&mExtAddress, 0, sizeof(mExtAddress));
+
+    memset(&mTxFrame, 0, sizeof(mTxFrame));
+    memset(&mRxFrame, 0, sizeof(mRxFrame));
+    memset(&mAckFrame, 0, sizeof(mAckFrame));
+    mTxFrame.mPsdu  = mTxPsdu;
+    mRxFrame.mPsdu  = mRxPsdu;
+    mAckFrame.mPsdu = mAckPsdu;
+
+    memset(mFlash, 0xff, sizeof(mFlash));
+}
+
+Node::~Node(void)
+{
+    EventHeap &events = Core::Get().GetEventHeap();
+
+    Finalize();
+
+    events.Cancel(mAlarmMilliEvent);
+    events.Cancel(mAlarmMicroEvent);
+    events.Cancel(mRadioEvent);
+    events.Cancel(mResetEvent);
+
+    while (mLinks != nullptr)
+    {
+        Link *link = mLinks;
+
+        mLinks = link->mNext;
+        delete link;
+    }
+}
+
+void Node::Init(void)
+{
+    size_t      size     = sizeof(mInstanceRaw);
+    otInstance *instance = otInstanceInit(mInstanceRaw, &size);
+
+    OT_ASSERT(instance == &GetInstance());
+    OT_UNUSED_VARIABLE(instance);
+}
+
+void Node::Finalize(void)
+{
+    // With multiple instances, `otInstanceFinalize()` leaves the instance object in place (its buffer is owned by
+    // the caller), so it is destroyed here. This also releases the shared random number generator state.
+    otInstanceFinalize(&GetInstance());
+    GetInstance().~Instance();
+}
+
+void Node::Reset(void)
+{
+    EventHeap &events = Core::Get().GetEventHeap();
+
+    Finalize();
+
+    events.Cancel(mAlarmMilliEvent);
+    events.Cancel(mAlarmMicroEvent);
+    events.Cancel(mRadioEvent);
+    events.Cancel(mResetEvent);
+    mRadioState     = OT_RADIO_STATE_DISABLED;
+    mRadioOperation = kOperationNone;
+
+    Init();
+}
+
+Error Node::Form(void)
+{
+    Error                error;
+    otOperationalDataset dataset;
+
+    SuccessOrExit(error = otDatasetCreateNewNetwork(&GetInstance(), &dataset));
+    SuccessOrExit(error = otDatasetSetActive(&GetInstance(), &dataset));
+    SuccessOrExit(error = otIp6SetEnabled(&GetInstance(), true));
+    SuccessOrExit(error = otThreadSetEnabled(&GetInstance(), true));
+
+exit:
+    return error;
+}
+
+Error Node::Join(Node &aNode, JoinMode aMode)
+{
+    Error                    error;
+    otOperationalDatasetTlvs dataset;
+    otLinkModeConfig         mode;
+
+    memset(&mode, 0, sizeof(mode));
+
+    switch (aMode)
+    {
+    case kAsFtd:
+        mode.mRxOnWhenIdle = true;
+        mode.mDeviceType   = true;
+        mode.mNetworkData  = true;
+        break;
+
+    case kAsMed:
+        mode.mRxOnWhenIdle = true;
+        break;
+
+    case kAsSed:
+        break;
+    }
+
+    SuccessOrExit(error = otDatasetGetActiveTlvs(&aNode.GetInstance(), &dataset));
+    SuccessOrExit(error = otDatasetSetActiveTlvs(&GetInstance(), &dataset));
+    SuccessOrExit(error = otThreadSetLinkMode(&GetInstance(), mode));
+    SuccessOrExit(error = otIp6SetEnabled(&GetInstance(), true));
+    SuccessOrExit(error = otThreadSetEnabled(&GetInstance(), true));
+
+exit:
+    return error;
+}
+
+Node::Link *Node::FindLink(const Node &aPeer) const
+{
+    Link *link;
+
+    for (link = mLinks; link != nullptr; link = link->mNext)
+    {
+        if (link->mPeer == &aPeer)
+        {
+            break;
+        }
+    }
+
+    return link;
+}
+
+void Node::HandleEvent(Event &aEvent)
+{
+    switch (aEvent.GetType())
+    {
+    case Event::kTypeAlarmMilli:
+        otPlatAlarmMilliFired(&GetInstance());
+        break;
+
+    case Event::kTypeAlarmMicro:
+        otPlatAlarmMicroFired(&GetInstance());
+        break;
+
+    case Event::kTypeRadio:
+        HandleRadioEvent();
+        break;
+
+    case Event::kTypeReset:
+        Reset();
+        break;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Alarm
+
+void Node::StartAlarmMilli(uint32_t aT0, uint32_t aDt)
+{
+    uint64_t now       = Core::Get().GetNow();
+    int32_t  remaining = static_cast<int32_t>(aT0 + aDt - static_cast<uint32_t>(now / 1000));
+
+    Core::Get().GetEventHeap().Schedule(mAlarmMilliEvent,
+                                        (remaining > 0) ? (now / 1000 + static_cast<uint64_t>(remaining)) * 1000 : now);
+}
+
+void Node::StartAlarmMicro(uint32_t aT0, uint32_t aDt)
+{
+    uint64_t now       = Core::Get().GetNow();
+    int32_t  remaining = static_cast<int32_t>(aT0 + aDt - static_cast<uint32_t>(now));
+
+    Core::Get().GetEventHeap().Schedule(mAlarmMicroEvent,
+                                        (remaining > 0) ? now + static_cast<uint64_t>(remaining) : now);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+void Node::GetEui64(uint8_t *aEui64) const
+{
+    static const uint8_t kEui64Prefix[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00};
+
+    memcpy(aEui64, kEui64Prefix, sizeof(kEui64Prefix));
+    aEui64[6] = static_cast<uint8_t>(mId >> 8);
+    aEui64[7] = static_cast<uint8_t>(mId & 0xff);
+}
+
+void Node::SetExtAddress(const otExtAddress &aExtAddress)
+{
+    // The radio is given the address in over-the-air (reversed) byte order.
+    for (uint8_t i = 0; i < sizeof(otExtAddress); i++)
+    {
+        mExtAddress.m8[i] = aExtAddress.m8[sizeof(otExtAddress) - 1 - i];
+    }
+}
+
+Error Node::EnableRadio(void)
+{
+    if (mRadioState == OT_RADIO_STATE_DISABLED)
+    {
+        mRadioState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return kErrorNone;
+}
+
+Error Node::DisableRadio(void)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mRadioState != OT_RADIO_STATE_TRANSMIT, error = kErrorInvalidState);
+    mRadioState = OT_RADIO_STATE_DISABLED;
+
+exit:
+    return error;
+}
+
+Error Node::Sleep(void)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((mRadioState == OT_RADIO_STATE_SLEEP) || (mRadioState == OT_RADIO_STATE_RECEIVE),
+                 error = kErrorInvalidState);
+    mRadioState = OT_RADIO_STATE_SLEEP;
+
+exit:
+    return error;
+}
+
+Error Node::Receive(uint8_t aChannel)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mRadioState != OT_RADIO_STATE_DISABLED, error = kErrorInvalidState);
+
+    // A receive request during a transmission takes effect when the transmission is done.
+    if (mRadioState != OT_RADIO_STATE_TRANSMIT)
+    {
+        mRadioState = OT_RADIO_STATE_RECEIVE;
+    }
+
+    mChannel = aChannel;
+
+exit:
+    return error;
+}
+
+Error Node::Transmit(otRadioFrame &aFrame)
+{
+    Error error = kErrorNone;
+
+    OT_ASSERT(&aFrame == &mTxFrame);
+    VerifyOrExit(mRadioState == OT_RADIO_STATE_RECEIVE, error = kErrorInvalidState);
+
+    mRadioState = OT_RADIO_STATE_TRANSMIT;
+    mChannel    = aFrame.mChannel;
+    mAcked      = false;
+
+    if (aFrame.mInfo.mTxInfo.mCsmaCaEnabled && IsChannelBusy(aFrame.mChannel))
+    {
+        mRadioOperation = kOperationTxDone;
+        mTxError        = kErrorChannelAccessFailure;
+        Core::Get().GetEventHeap().Schedule(mRadioEvent, Core::Get().GetNow() + kCcaTime);
+        ExitNow();
+    }
+
+    mRadioOperation = kOperationTxEnd;
+
+    otPlatRadioTxStarted(&GetInstance(), &aFrame);
+
+    Core::Get().GetEventHeap().Schedule(mRadioEvent, Core::Get().GetNow() + GetAirTime(aFrame.mLength));
+
+exit:
+    return error;
+}
+
+bool Node::IsChannelBusy(uint8_t aChannel) const
+{
+    bool busy = false;
+
+    // The channel is busy if a neighbor with a link towards this node is on air.
+    for (const Link *link = mLinks; link != nullptr; link = link->mNext)
+    {
+        if (link->mPeer->IsOnAir(aChannel) && (link->mPeer->FindLink(*this) != nullptr))
+        {
+            busy = true;
+            break;
+        }
+    }
+
+    return busy;
+}
+
+void Node::HandleRadioEvent(void)
+{
+    const Mac::TxFrame &txFrame = static_cast<const Mac::TxFrame &>(mTxFrame);
+
+    switch (mRadioOperation)
+    {
+    case kOperationTxEnd:
+        mAcked = Core::Get().DeliverFrame(*this, mTxFrame, mAckFrame);
+
+        if (txFrame.GetAckRequest())
+        {
+            uint32_t delay = mAcked ? kTurnaroundTime + GetAirTime(mAckFrame.mLength) : kAckWaitTime;
+
+            mRadioOperation = kOperationTxDone;
+            mTxError        = mAcked ? kErrorNone : kErrorNoAck;
+            Core::Get().GetEventHeap().Schedule(mRadioEvent, Core::Get().GetNow() + delay);
+            break;
+        }
+
+        mAcked   = false;
+        mTxError = kErrorNone;
+
+        OT_FALL_THROUGH;
+
+    case kOperationTxDone:
+        mRadioOperation = kOperationNone;
+        mRadioState     = OT_RADIO_STATE_RECEIVE;
+
+        if (mAcked)
+        {
+            mAckFrame.mChannel                 = mChannel;
+            mAckFrame.mInfo.mRxInfo.mTimestamp = Core::Get().GetNow();
+            mAckFrame.mInfo.mRxInfo.mLqi       = OT_RADIO_LQI_NONE;
+        }
+
+        otPlatRadioTxDone(&GetInstance(), &mTxFrame, mAcked ? &mAckFrame : nullptr, mTxError);
+        break;
+
+    case kOperationNone:
+        break;
+    }
+}
+
+bool Node::HandleFrame(const otRadioFrame &aFrame, int8_t aRssi, otRadioFrame &aAckFrame)
+{
+    Mac::RxFrame &rxFrame = static_cast<Mac::RxFrame &>(mRxFrame);
+    bool          ack     = false;
+
+    mRxFrame.mLength  = aFrame.mLength;
+    mRxFrame.mChannel = aFrame.mChannel;
+    memcpy(mRxPsdu, aFrame.mPsdu, aFrame.mLength);
+
+    mRxFrame.mInfo.mRxInfo.mTimestamp             = Core::Get().GetNow();
+    mRxFrame.mInfo.mRxInfo.mRssi                  = aRssi;
+    mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
+    mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = false;
+    mRxFrame.mInfo.mRxInfo.mAckedWithSecEnhAck    = false;
+
+    if (!mPromiscuous)
+    {
+        Mac::Address dst;
+        Mac::PanId   panId;
+
+        VerifyOrExit(rxFrame.GetDstAddr(dst) == kErrorNone);
+
+        switch (dst.GetType())
+        {
+        case Mac::Address::kTypeShort:
+            VerifyOrExit(dst.IsBroadcast() || (dst.GetShort() == mShortAddress));
+            break;
+
+        case Mac::Address::kTypeExtended:
+            VerifyOrExit(dst.GetExtended() == static_cast<const Mac::ExtAddress &>(mExtAddress));
+            break;
+
+        case Mac::Address::kTypeNone:
+            break;
+        }
+
+        if (rxFrame.GetDstPanId(panId) == kErrorNone)
+        {
+            VerifyOrExit((panId == Mac::kPanIdBroadcast) || (panId == mPanId));
+        }
+
+        if (rxFrame.GetAckRequest())
+        {
+            Mac::TxFrame &ackFrame = static_cast<Mac::TxFrame &>(aAckFrame);
+
+            mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = HasFramePending(mRxFrame);
+
+            if (!rxFrame.IsVersion2015())
+            {
+                ackFrame.GenerateImmAck(rxFrame, mRxFrame.mInfo.mRxInfo.mAckedWithFramePending);
+                ack = true;
+            }
+            else if (!rxFrame.GetSecurityEnabled())
+            {
+                // Secured Enh-ACKs are not supported, as keys are not given to a radio without
+                // `OT_RADIO_CAPS_TRANSMIT_SEC`.
+                ack = (ackFrame.GenerateEnhAck(rxFrame, mRxFrame.mInfo.mRxInfo.mAckedWithFramePending, nullptr, 0) ==
+                       kErrorNone);
+            }
+        }
+    }
+
+    otPlatRadioReceiveDone(&GetInstance(), &mRxFrame, kErrorNone);
+
+exit:
+    return ack;
+}
+
+bool Node::HasFramePending(const otRadioFrame &aFrame) const
+{
+    const Mac::RxFrame &rxFrame = static_cast<const Mac::RxFrame &>(aFrame);
+    bool                pending = false;
+    Mac::Address        src;
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    VerifyOrExit((rxFrame.IsVersion2015() && (rxFrame.GetType() == Mac::Frame::kFcfFrameMacCmd)) ||
+                 (rxFrame.GetType() == Mac::Frame::kFcfFrameData) || rxFrame.IsDataRequestCommand());
+#else
+    VerifyOrExit(rxFrame.IsDataRequestCommand());
+#endif
+
+    VerifyOrExit(mSrcMatchEnabled, pending = true);
+    SuccessOrExit(rxFrame.GetSrcAddr(src));
+
+    if (src.IsShort())
+    {
+        for (uint8_t i = 0; i < mNumSrcMatchShort; i++)
+        {
+            if (mSrcMatchShort[i] == src.GetShort())
+            {
+                ExitNow(pending = true);
+            }
+        }
+    }
+    else if (src.IsExtended())
+    {
+        Mac::ExtAddress extAddress;
+
+        // Source match entries are kept in over-the-air (reversed) byte order.
+        extAddress.Set(src.GetExtended().m8, Mac::ExtAddress::kReverseByteOrder);
+
+        for (uint8_t i = 0; i < mNumSrcMatchExt; i++)
+        {
+            if (extAddress == static_cast<const Mac::ExtAddress &>(mSrcMatchExt[i]))
+            {
+                ExitNow(pending = true);
+            }
+        }
+    }
+
+exit:
+    return pending;
+}
+
+Error Node::AddSrcMatchShortEntry(otShortAddress aShortAddress)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(ClearSrcMatchShortEntry(aShortAddress) == kErrorNone || mNumSrcMatchShort < kMaxSrcMatchEntries,
+                 error = kErrorNoBufs);
+    mSrcMatchShort[mNumSrcMatchShort++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+Error Node::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(ClearSrcMatchExtEntry(aExtAddress) == kErrorNone || mNumSrcMatchExt < kMaxSrcMatchEntries,
+                 error = kErrorNoBufs);
+    mSrcMatchExt[mNumSrcMatchExt++] = aExtAddress;
+
+exit:
+    return error;
+}
+
+Error Node::ClearSrcMatchShortEntry(otShortAddress aShortAddress)
+{
+    Error error = kErrorNotFound;
+
+    for (uint8_t i = 0; i < mNumSrcMatchShort; i++)
+    {
+        if (mSrcMatchShort[i] == aShortAddress)
+        {
+            mSrcMatchShort[i] = mSrcMatchShort[--mNumSrcMatchShort];
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Node::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    Error error = kErrorNotFound;
+
+    for (uint8_t i = 0; i < mNumSrcMatchExt; i++)
+    {
+        if (memcmp(&mSrcMatchExt[i], &aExtAddress, sizeof(otExtAddress)) == 0)
+        {
+            mSrcMatchExt[i] = mSrcMatchExt[--mNumSrcMatchExt];
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Flash
+
+void Node::EraseFlash(uint8_t aSwapIndex)
+{
+    memset(&mFlash[aSwapIndex * kFlashSwapSize], 0xff, kFlashSwapSize);
+}
+
+void Node::ReadFlash(uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize) const
+{
+    OT_ASSERT(aOffset + aSize <= kFlashSwapSize);
+    memcpy(aData, &mFlash[aSwapIndex * kFlashSwapSize + aOffset], aSize);
+}
+
+void Node::WriteFlash(uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
+
+    OT_ASSERT(aOffset + aSize <= kFlashSwapSize);
+
+    // Writing can only clear bits, as with a NOR flash.
+    for (uint32_t i = 0; i < aSize; i++)
+    {
+        mFlash[aSwapIndex * kFlashSwapSize + aOffset + i] &= data[i];
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
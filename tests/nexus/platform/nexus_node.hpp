@@ -0,0 +1,268 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a simulated node.
+ */
+
+#ifndef NEXUS_NODE_HPP_
+#define NEXUS_NODE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/non_copyable.hpp"
+
+#include "nexus_core.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * This class represents a simulated node, i.e. an OpenThread instance along with its simulated platform (alarms,
+ * radio and flash).
+ *
+ */
+class Node : private NonCopyable
+{
+    friend class Core;
+
+public:
+    /**
+     * This enumeration specifies how a node joins a network.
+     *
+     */
+    enum JoinMode : uint8_t
+    {
+        kAsFtd, ///< Join as a Full Thread Device (router eligible).
+        kAsMed, ///< Join as a Minimal End Device (rx-on-when-idle).
+        kAsSed, ///< Join as a Sleepy End Device.
+    };
+
+    /**
+     * This static method returns the node of a given OpenThread instance.
+     *
+     * @param[in] aInstance  A pointer to the OpenThread instance.
+     *
+     * @returns A reference to the node.
+     *
+     */
+    static Node &From(otInstance *aInstance)
+    {
+        // The instance is the first member of `Node`.
+        return *reinterpret_cast<Node *>(aInstance);
+    }
+
+    /**
+     * This method returns the OpenThread instance of the node.
+     *
+     * @returns A reference to the instance.
+     *
+     */
+    Instance &GetInstance(void) { return *reinterpret_cast<Instance *>(mInstanceRaw); }
+
+    /**
+     * This method returns the node ID.
+     *
+     * @returns The node ID.
+     *
+     */
+    uint16_t GetId(void) const { return mId; }
+
+    /**
+     * This method resets the node, keeping the content of its flash (i.e. the persisted settings).
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method requests a reset of the node from within OpenThread code.
+     *
+     * The reset is performed once the current call stack unwinds back to the simulation loop.
+     *
+     */
+    void RequestReset(void) { Core::Get().GetEventHeap().Schedule(mResetEvent, Core::Get().GetNow()); }
+
+    /**
+     * This method creates a new network and starts the node as its leader.
+     *
+     * @retval kErrorNone  Successfully started the node.
+     *
+     */
+    Error Form(void);
+
+    /**
+     * This method configures the node with the Active Dataset of another node and starts it.
+     *
+     * @param[in] aNode  The node to copy the Active Dataset from.
+     * @param[in] aMode  The device mode.
+     *
+     * @retval kErrorNone  Successfully started the node.
+     *
+     */
+    Error Join(Node &aNode, JoinMode aMode = kAsFtd);
+
+    // Platform hooks (called from the `otPlat` APIs).
+
+    void StartAlarmMilli(uint32_t aT0, uint32_t aDt);
+    void StopAlarmMilli(void) { Core::Get().GetEventHeap().Cancel(mAlarmMilliEvent); }
+    void StartAlarmMicro(uint32_t aT0, uint32_t aDt);
+    void StopAlarmMicro(void) { Core::Get().GetEventHeap().Cancel(mAlarmMicroEvent); }
+
+    void GetEui64(uint8_t *aEui64) const;
+    void SetPanId(otPanId aPanId) { mPanId = aPanId; }
+    void SetExtAddress(const otExtAddress &aExtAddress);
+    void SetShortAddress(otShortAddress aShortAddress) { mShortAddress = aShortAddress; }
+    void SetPromiscuous(bool aEnable) { mPromiscuous = aEnable; }
+    bool IsPromiscuous(void) const { return mPromiscuous; }
+
+    otRadioState  GetRadioState(void) const { return mRadioState; }
+    Error         EnableRadio(void);
+    Error         DisableRadio(void);
+    Error         Sleep(void);
+    Error         Receive(uint8_t aChannel);
+    Error         Transmit(otRadioFrame &aFrame);
+    otRadioFrame &GetTxFrame(void) { return mTxFrame; }
+    int8_t        GetTxPower(void) const { return mTxPower; }
+    void          SetTxPower(int8_t aPower) { mTxPower = aPower; }
+
+    void  EnableSrcMatch(bool aEnable) { mSrcMatchEnabled = aEnable; }
+    Error AddSrcMatchShortEntry(otShortAddress aShortAddress);
+    Error AddSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    Error ClearSrcMatchShortEntry(otShortAddress aShortAddress);
+    Error ClearSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    void  ClearSrcMatchShortEntries(void) { mNumSrcMatchShort = 0; }
+    void  ClearSrcMatchExtEntries(void) { mNumSrcMatchExt = 0; }
+
+    uint32_t GetFlashSwapSize(void) const { return kFlashSwapSize; }
+    void     EraseFlash(uint8_t aSwapIndex);
+    void     ReadFlash(uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize) const;
+    void     WriteFlash(uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize);
+
+private:
+    enum : uint8_t
+    {
+        kMaxSrcMatchEntries = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    };
+
+    enum : uint16_t
+    {
+        kFlashSwapSize = 4096,
+    };
+
+    enum : uint32_t
+    {
+        kSymbolTime     = 16,               // Time of an O-QPSK symbol (in usec).
+        kByteTime       = 2 * kSymbolTime,  // Time of a byte (in usec).
+        kPhyHeaderSize  = 6,                // Preamble, SFD and PHR (in bytes).
+        kTurnaroundTime = 12 * kSymbolTime, // aTurnaroundTime (in usec).
+        kAckWaitTime    = 54 * kSymbolTime, // macAckWaitDuration (in usec).
+        kCcaTime        = 8 * kSymbolTime,  // CCA detection time (in usec).
+    };
+
+    enum RadioOperation : uint8_t
+    {
+        kOperationNone,
+        kOperationTxEnd,  // The frame has been sent on air.
+        kOperationTxDone, // The acknowledgment has been received or the wait for it timed out.
+    };
+
+    struct Link
+    {
+        Link *  mNext;
+        Node *  mPeer;
+        int8_t  mRssi;
+        uint8_t mLossPercent;
+    };
+
+    explicit Node(uint16_t aId);
+    ~Node(void);
+
+    void  Init(void);
+    void  Finalize(void);
+    Link *FindLink(const Node &aPeer) const;
+    void  HandleEvent(Event &aEvent);
+    void  HandleRadioEvent(void);
+    bool  HandleFrame(const otRadioFrame &aFrame, int8_t aRssi, otRadioFrame &aAckFrame);
+    bool  HasFramePending(const otRadioFrame &aFrame) const;
+    bool  IsChannelBusy(uint8_t aChannel) const;
+    bool  IsOnAir(uint8_t aChannel) const { return (mRadioOperation == kOperationTxEnd) && (mChannel == aChannel); }
+
+    static uint32_t GetAirTime(uint8_t aLength) { return (kPhyHeaderSize + aLength) * kByteTime; }
+
+    // The instance must be the first member, see `From()`.
+    OT_DEFINE_ALIGNED_VAR(mInstanceRaw, sizeof(Instance), uint64_t);
+
+    uint16_t mId;
+    bool     mTaskletsPending;
+    Node *   mNextPending;
+    Link *   mLinks;
+
+    Event mAlarmMilliEvent;
+    Event mAlarmMicroEvent;
+    Event mRadioEvent;
+    Event mResetEvent;
+
+    otRadioState   mRadioState;
+    RadioOperation mRadioOperation;
+    uint8_t        mChannel;
+    bool           mPromiscuous;
+    bool           mAcked;
+    Error          mTxError;
+    int8_t         mTxPower;
+    otPanId        mPanId;
+    otShortAddress mShortAddress;
+    otExtAddress   mExtAddress;
+
+    otRadioFrame mTxFrame;
+    otRadioFrame mRxFrame;
+    otRadioFrame mAckFrame;
+    uint8_t      mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+
+    bool           mSrcMatchEnabled;
+    uint8_t        mNumSrcMatchShort;
+    uint8_t        mNumSrcMatchExt;
+    otShortAddress mSrcMatchShort[kMaxSrcMatchEntries];
+    otExtAddress   mSrcMatchExt[kMaxSrcMatchEntries];
+
+    uint8_t mFlash[2 * kFlashSwapSize];
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_NODE_HPP_
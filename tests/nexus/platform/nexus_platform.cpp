@@ -0,0 +1,399 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform abstraction on top of the simulated nodes.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/entropy.h>
+#include <openthread/platform/flash.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+using ot::Nexus::Core;
+using ot::Nexus::Node;
+
+extern "C" {
+
+//---------------------------------------------------------------------------------------------------------------------
+// Tasklets
+
+void otTaskletsSignalPending(otInstance *aInstance)
+{
+    Core::Get().SignalTaskletsPending(Node::From(aInstance));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Alarm
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return static_cast<uint32_t>(Core::Get().GetNow() / 1000);
+}
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    Node::From(aInstance).StartAlarmMilli(aT0, aDt);
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance)
+{
+    Node::From(aInstance).StopAlarmMilli();
+}
+
+uint32_t otPlatAlarmMicroGetNow(void)
+{
+    return static_cast<uint32_t>(Core::Get().GetNow());
+}
+
+void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    Node::From(aInstance).StartAlarmMicro(aT0, aDt);
+}
+
+void otPlatAlarmMicroStop(otInstance *aInstance)
+{
+    Node::From(aInstance).StopAlarmMicro();
+}
+
+uint64_t otPlatTimeGet(void)
+{
+    return Core::Get().GetNow();
+}
+
+uint16_t otPlatTimeGetXtalAccuracy(void)
+{
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_RADIO_CAPS_NONE;
+}
+
+const char *otPlatRadioGetVersionString(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return "NEXUS";
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    Node::From(aInstance).GetEui64(aIeeeEui64);
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId)
+{
+    Node::From(aInstance).SetPanId(aPanId);
+}
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    Node::From(aInstance).SetExtAddress(*aExtAddress);
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    Node::From(aInstance).SetShortAddress(aShortAddress);
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance)
+{
+    return Node::From(aInstance).IsPromiscuous();
+}
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    Node::From(aInstance).SetPromiscuous(aEnable);
+}
+
+otRadioState otPlatRadioGetState(otInstance *aInstance)
+{
+    return Node::From(aInstance).GetRadioState();
+}
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return Node::From(aInstance).GetRadioState() != OT_RADIO_STATE_DISABLED;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    return Node::From(aInstance).EnableRadio();
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    return Node::From(aInstance).DisableRadio();
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    return Node::From(aInstance).Sleep();
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    return Node::From(aInstance).Receive(aChannel);
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    return &Node::From(aInstance).GetTxFrame();
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    return Node::From(aInstance).Transmit(*aFrame);
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    *aPower = Node::From(aInstance).GetTxPower();
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
+{
+    Node::From(aInstance).SetTxPower(aPower);
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t *aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannel);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    Node::From(aInstance).EnableSrcMatch(aEnable);
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return Node::From(aInstance).AddSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return Node::From(aInstance).AddSrcMatchExtEntry(*aExtAddress);
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return Node::From(aInstance).ClearSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return Node::From(aInstance).ClearSrcMatchExtEntry(*aExtAddress);
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    Node::From(aInstance).ClearSrcMatchShortEntries();
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    Node::From(aInstance).ClearSrcMatchExtEntries();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Flash
+
+void otPlatFlashInit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+uint32_t otPlatFlashGetSwapSize(otInstance *aInstance)
+{
+    return Node::From(aInstance).GetFlashSwapSize();
+}
+
+void otPlatFlashErase(otInstance *aInstance, uint8_t aSwapIndex)
+{
+    Node::From(aInstance).EraseFlash(aSwapIndex);
+}
+
+void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize)
+{
+    Node::From(aInstance).ReadFlash(aSwapIndex, aOffset, aData, aSize);
+}
+
+void otPlatFlashWrite(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
+{
+    Node::From(aInstance).WriteFlash(aSwapIndex, aOffset, aData, aSize);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Entropy
+
+otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
+{
+    // A deterministic source keeps the runs reproducible for a given seed.
+    for (uint16_t i = 0; i < aOutputLength; i++)
+    {
+        aOutput[i] = static_cast<uint8_t>(Core::Get().GetRandom());
+    }
+
+    return OT_ERROR_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Logging
+
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    Core &  core = Core::Get();
+    Node *  node = core.GetCurrentNode();
+    va_list args;
+
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    VerifyOrExit(core.IsLogEnabled());
+
+    printf("%02u:%02u:%02u.%06u ", static_cast<unsigned>(core.GetNow() / 3600000000ull),
+           static_cast<unsigned>((core.GetNow() / 60000000ull) % 60),
+           static_cast<unsigned>((core.GetNow() / 1000000ull) % 60), static_cast<unsigned>(core.GetNow() % 1000000));
+
+    if (node != nullptr)
+    {
+        printf("[%u] ", node->GetId());
+    }
+    else
+    {
+        printf("[-] ");
+    }
+
+    va_start(args, aFormat);
+    vprintf(aFormat, args);
+    va_end(args);
+
+    printf("\n");
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Misc
+
+void otPlatReset(otInstance *aInstance)
+{
+    Node::From(aInstance).RequestReset();
+}
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_RESET_REASON_POWER_ON;
+}
+
+void otPlatWakeHost(void)
+{
+}
+
+otError otPlatSetMcuPowerState(otInstance *aInstance, otPlatMcuPowerState aState)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aState);
+
+    return OT_ERROR_NONE;
+}
+
+otPlatMcuPowerState otPlatGetMcuPowerState(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_MCU_POWER_STATE_ON;
+}
+
+void otPlatAssertFail(const char *aFilename, int aLineNumber)
+{
+    fprintf(stderr, "assert failed at %s:%d\n", aFilename, aLineNumber);
+    abort();
+}
+
+} // extern "C"
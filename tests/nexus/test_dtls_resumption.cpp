@@ -0,0 +1,222 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file checks that a DTLS client reconnecting to a DTLS server resumes the previous EC-JPAKE session.
+ *
+ *   Usage: ot-nexus-test-dtls-resumption
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <openthread/thread.h>
+
+#include "coap/coap_secure.hpp"
+#include "common/locator_getters.hpp"
+#include "thread/mle.hpp"
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+#if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE && OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+
+enum : uint16_t
+{
+    kServerPort = 5684,
+    kClientPort = 5685,
+};
+
+enum : uint32_t
+{
+    kAttachTime    = 2 * 60 * 1000, // Time to wait for the nodes to attach (in msec).
+    kHandshakeTime = 20 * 1000,     // Time to wait for a handshake to complete (in msec).
+    kCloseTime     = 5 * 1000,      // Time to wait for both sides to close a session (in msec).
+};
+
+static const uint8_t kPsk[]      = {'J', '0', 'I', 'N', 'M', 'E'};
+static const uint8_t kOtherPsk[] = {'R', 'E', 'J', 'O', 'I', 'N'};
+
+static Coap::CoapSecure &GetCoapSecure(Node &aNode)
+{
+    return aNode.GetInstance().GetApplicationCoapSecure();
+}
+
+static const MeshCoP::Dtls::HandshakeCounters &GetCounters(Node &aNode)
+{
+    return GetCoapSecure(aNode).GetDtls().GetHandshakeCounters();
+}
+
+static bool Connect(Node &aClient, Node &aServer, double &aCpuTime)
+{
+    Core &        core = Core::Get();
+    Ip6::SockAddr sockAddr(aServer.GetInstance().Get<Mle::Mle>().GetMeshLocal64(), kServerPort);
+    clock_t       start;
+    bool          connected;
+
+    start = clock();
+
+    connected = (GetCoapSecure(aClient).Connect(sockAddr, nullptr, nullptr) == kErrorNone);
+    core.AdvanceTime(kHandshakeTime);
+    connected = connected && GetCoapSecure(aClient).IsConnected() && GetCoapSecure(aServer).IsConnected();
+
+    aCpuTime = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    GetCoapSecure(aClient).Disconnect();
+    core.AdvanceTime(kCloseTime);
+
+    return connected;
+}
+
+static bool CheckCounters(Node &aNode, const char *aName, uint32_t aFull, uint32_t aResumed)
+{
+    const MeshCoP::Dtls::HandshakeCounters &counters = GetCounters(aNode);
+    bool                                    matches  = (counters.mFull == aFull) && (counters.mResumed == aResumed);
+
+    if (!matches)
+    {
+        fprintf(stderr, "FAILED - %s handshakes: full %u, resumed %u (expected full %u, resumed %u)\n", aName,
+                counters.mFull, counters.mResumed, aFull, aResumed);
+    }
+
+    return matches;
+}
+
+static bool Reconnect(Node &      aClient,
+                      Node &      aServer,
+                      const char *aStep,
+                      uint32_t    aFull,
+                      uint32_t    aResumed,
+                      double &    aCpuTime)
+{
+    bool passed = Connect(aClient, aServer, aCpuTime);
+
+    if (!passed)
+    {
+        fprintf(stderr, "FAILED - %s: not connected\n", aStep);
+    }
+
+    passed = passed && CheckCounters(aServer, "server", aFull, aResumed);
+    passed = passed && CheckCounters(aClient, "client", aFull, aResumed);
+
+    return passed;
+}
+
+static int TestDtlsResumption(void)
+{
+    Core & core   = Core::Get();
+    Node & server = core.CreateNode();
+    Node & client = core.CreateNode();
+    double fullCpuTime;
+    double resumedCpuTime;
+    double cpuTime;
+
+    core.Connect(server, client, -40);
+
+    if ((server.Form() != kErrorNone) || (client.Join(server) != kErrorNone))
+    {
+        fprintf(stderr, "FAILED - could not form the network\n");
+        return EXIT_FAILURE;
+    }
+
+    core.AdvanceTime(kAttachTime);
+
+    if (otThreadGetDeviceRole(&client.GetInstance()) == OT_DEVICE_ROLE_DETACHED)
+    {
+        fprintf(stderr, "FAILED - client did not attach\n");
+        return EXIT_FAILURE;
+    }
+
+    if ((GetCoapSecure(server).Start(kServerPort) != kErrorNone) ||
+        (GetCoapSecure(server).SetPsk(kPsk, sizeof(kPsk)) != kErrorNone) ||
+        (GetCoapSecure(client).Start(kClientPort) != kErrorNone) ||
+        (GetCoapSecure(client).SetPsk(kPsk, sizeof(kPsk)) != kErrorNone))
+    {
+        fprintf(stderr, "FAILED - could not start the secure CoAP agents\n");
+        return EXIT_FAILURE;
+    }
+
+    // The first session runs a full EC-JPAKE handshake, reconnecting with
+    // the same PSK resumes it.
+
+    if (!Reconnect(client, server, "first connection", 1, 0, fullCpuTime) ||
+        !Reconnect(client, server, "second connection", 1, 1, resumedCpuTime))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // A session is never resumed with another PSK.
+
+    IgnoreError(GetCoapSecure(server).SetPsk(kOtherPsk, sizeof(kOtherPsk)));
+    IgnoreError(GetCoapSecure(client).SetPsk(kOtherPsk, sizeof(kOtherPsk)));
+
+    if (!Reconnect(client, server, "connection with another PSK", 2, 1, cpuTime))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Without a cached session on the server, the handshake is a full one.
+
+    GetCoapSecure(server).GetDtls().ClearSessionCache();
+
+    if (!Reconnect(client, server, "connection after clearing the server cache", 3, 1, cpuTime))
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("DTLS session resumption passed (cpu time: full handshake %.3f s, resumed handshake %.3f s)\n",
+           fullCpuTime, resumedCpuTime);
+
+    return EXIT_SUCCESS;
+}
+
+#else
+
+static int TestDtlsResumption(void)
+{
+    printf("DTLS session cache is not enabled\n");
+
+    return EXIT_SUCCESS;
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE && OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_ENABLE
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::Core::Get().SetLogEnabled(getenv("NEXUS_LOG") != nullptr);
+
+    return ot::Nexus::TestDtlsResumption();
+}
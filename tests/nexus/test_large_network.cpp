@@ -0,0 +1,227 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file runs a large grid network in the in-process simulation and checks that all nodes attach.
+ *
+ *   A partition has at most 32 routers, so larger grids form several partitions.
+ *
+ *   Usage: ot-nexus-test-large-network [number of nodes] [random seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/thread.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+enum : uint16_t
+{
+    kDefaultNumNodes = 64,
+};
+
+enum : int
+{
+    kRadioRange = 2, // Radio range (in grid units).
+};
+
+enum : uint32_t
+{
+    kDefaultSeed   = 1,
+    kJoinInterval  = 200,            // Interval between starting two nodes (in msec).
+    kAttachTimeout = 30 * 60 * 1000, // Time to wait for all nodes to attach (in msec).
+    kCheckInterval = 10 * 1000,      // Interval between two checks of the network state (in msec).
+};
+
+static bool IsAttached(Node &aNode)
+{
+    otDeviceRole role = otThreadGetDeviceRole(&aNode.GetInstance());
+
+    return (role == OT_DEVICE_ROLE_CHILD) || (role == OT_DEVICE_ROLE_ROUTER) || (role == OT_DEVICE_ROLE_LEADER);
+}
+
+static bool AreAllAttached(Core &aCore)
+{
+    bool attached = true;
+
+    for (uint16_t id = 1; id <= aCore.GetNumNodes(); id++)
+    {
+        if (!IsAttached(*aCore.GetNode(id)))
+        {
+            attached = false;
+            break;
+        }
+    }
+
+    return attached;
+}
+
+static void PrintNodes(Core &aCore)
+{
+    for (uint16_t id = 1; id <= aCore.GetNumNodes(); id++)
+    {
+        otInstance *instance = &aCore.GetNode(id)->GetInstance();
+
+        fprintf(stderr, "  node %u: role %d, partition 0x%08x, rloc16 0x%04x\n", id,
+                static_cast<int>(otThreadGetDeviceRole(instance)), otThreadGetPartitionId(instance),
+                otThreadGetRloc16(instance));
+    }
+}
+
+static int TestLargeNetwork(uint16_t aNumNodes, uint32_t aSeed)
+{
+    Core &   core    = Core::Get();
+    uint16_t columns = 1;
+    uint32_t elapsed = 0;
+    uint16_t numRouters;
+    uint16_t numLeaders;
+
+    while (columns * columns < aNumNodes)
+    {
+        columns++;
+    }
+
+    printf("Creating %u nodes in a grid with %u columns (seed %u)\n", aNumNodes, columns, aSeed);
+
+    core.SetRandomSeed(aSeed);
+
+    for (uint16_t i = 0; i < aNumNodes; i++)
+    {
+        Node &node = core.CreateNode();
+
+        // Each node hears the nodes within `kRadioRange` grid units, with a weaker signal for farther nodes.
+        for (uint16_t j = 0; j < i; j++)
+        {
+            int dx       = (i % columns) - (j % columns);
+            int dy       = (i / columns) - (j / columns);
+            int distance = dx * dx + dy * dy; // Squared distance.
+
+            if (distance <= kRadioRange * kRadioRange)
+            {
+                core.Connect(node, *core.GetNode(j + 1), static_cast<int8_t>(-40 - 10 * distance));
+            }
+        }
+    }
+
+    if (core.GetNode(1)->Form() != kErrorNone)
+    {
+        fprintf(stderr, "FAILED - leader could not form the network\n");
+        return EXIT_FAILURE;
+    }
+
+    for (uint16_t id = 2; id <= aNumNodes; id++)
+    {
+        core.AdvanceTime(kJoinInterval);
+        elapsed += kJoinInterval;
+
+        if (core.GetNode(id)->Join(*core.GetNode(1)) != kErrorNone)
+        {
+            fprintf(stderr, "FAILED - node %u could not join\n", id);
+            return EXIT_FAILURE;
+        }
+    }
+
+    while (!AreAllAttached(core))
+    {
+        if (elapsed >= kAttachTimeout)
+        {
+            fprintf(stderr, "FAILED - network did not converge in %u seconds\n", kAttachTimeout / 1000);
+            PrintNodes(core);
+            return EXIT_FAILURE;
+        }
+
+        core.AdvanceTime(kCheckInterval);
+        elapsed += kCheckInterval;
+    }
+
+    numRouters = 0;
+    numLeaders = 0;
+
+    for (uint16_t id = 1; id <= aNumNodes; id++)
+    {
+        switch (otThreadGetDeviceRole(&core.GetNode(id)->GetInstance()))
+        {
+        case OT_DEVICE_ROLE_LEADER:
+            numLeaders++;
+            OT_FALL_THROUGH;
+
+        case OT_DEVICE_ROLE_ROUTER:
+            numRouters++;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    printf("All %u nodes attached after %u seconds of virtual time (%u partitions, %u routers)\n", aNumNodes,
+           elapsed / 1000, numLeaders, numRouters);
+    printf("Frames: tx %llu, rx %llu, lost %llu, off-channel %llu, events %llu\n",
+           static_cast<unsigned long long>(core.GetCounters().mTxFrames),
+           static_cast<unsigned long long>(core.GetCounters().mRxFrames),
+           static_cast<unsigned long long>(core.GetCounters().mLostFrames),
+           static_cast<unsigned long long>(core.GetCounters().mOffChannel),
+           static_cast<unsigned long long>(core.GetCounters().mEventsHandled));
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    uint16_t numNodes = ot::Nexus::kDefaultNumNodes;
+    uint32_t seed     = ot::Nexus::kDefaultSeed;
+
+    if (argc > 1)
+    {
+        numNodes = static_cast<uint16_t>(strtoul(argv[1], nullptr, 0));
+    }
+
+    if (argc > 2)
+    {
+        seed = static_cast<uint32_t>(strtoul(argv[2], nullptr, 0));
+    }
+
+    if (numNodes == 0)
+    {
+        fprintf(stderr, "Usage: %s [number of nodes] [random seed]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ot::Nexus::Core::Get().SetLogEnabled(getenv("NEXUS_LOG") != nullptr);
+
+    return ot::Nexus::TestLargeNetwork(numNodes, seed);
+}
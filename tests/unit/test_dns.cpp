@@ -731,6 +731,126 @@ void TestDnsCompressedName(void)
     testFreeInstance(instance);
 }
 
+void TestDnsCompressionDictionary(void)
+{
+    enum
+    {
+        kHeaderOffset = 8,
+        kGuardSize    = 300, // Pushes the names over several message buffers.
+        kNameSize     = 256,
+    };
+
+    static const char    kServiceName[]             = "_test._udp.default.service.arpa.";
+    static const char    kInstance1[]               = "inst1._test._udp.default.service.arpa.";
+    static const char    kInstance2[]               = "Human.Readable._test._udp.default.service.arpa.";
+    static const char    kHostName[]                = "host.default.service.arpa.";
+    static const char    kOtherName[]               = "other.example.com.";
+    static const uint8_t kInstance2FirstLabelLength = sizeof("Human.Readable") - 1;
+
+    struct TestName
+    {
+        const char *mName;
+        uint8_t     mFirstLabelLength;
+        uint16_t    mEncodedSize;
+        uint16_t    mOffset;
+    };
+
+    // Expected sizes: a name with no known suffix is encoded in full,
+    // otherwise its new labels are followed by a 2-byte pointer.
+
+    TestName testNames[] = {
+        {kServiceName, 0, sizeof(kServiceName), 0},
+        {kInstance1, 0, sizeof("inst1") + 2, 0},
+        {kInstance2, kInstance2FirstLabelLength, sizeof("Human.Readable") + 2, 0},
+        {kHostName, 0, sizeof("host") + 2, 0},
+        {kServiceName, 0, 2, 0},
+        {kInstance2, kInstance2FirstLabelLength, 2, 0},
+        {kOtherName, 0, sizeof(kOtherName), 0},
+    };
+
+    Instance *                       instance;
+    MessagePool *                    messagePool;
+    Message *                        message;
+    Dns::Name::CompressionDictionary dictionary;
+    Dns::Name::CompressionDictionary rebuiltDictionary;
+    uint16_t                         offset;
+    char                             name[kNameSize];
+
+    printf("================================================================\n");
+    printf("TestDnsCompressionDictionary()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+
+    for (uint16_t index = 0; index < kHeaderOffset + kGuardSize; index++)
+    {
+        uint8_t value = static_cast<uint8_t>(index);
+
+        SuccessOrQuit(message->Append(value), "Message::Append() failed");
+    }
+
+    message->SetOffset(kHeaderOffset);
+
+    for (TestName &testName : testNames)
+    {
+        testName.mOffset = message->GetLength();
+        SuccessOrQuit(dictionary.AppendName(testName.mName, testName.mFirstLabelLength, *message),
+                      "CompressionDictionary::AppendName() failed");
+
+        printf("\"%s\" encoded in %u bytes\n", testName.mName, message->GetLength() - testName.mOffset);
+        VerifyOrQuit(message->GetLength() - testName.mOffset == testName.mEncodedSize,
+                     "CompressionDictionary::AppendName() did not compress as expected");
+    }
+
+    for (const TestName &testName : testNames)
+    {
+        offset = testName.mOffset;
+        SuccessOrQuit(Dns::Name::ParseName(*message, offset), "Name::ParseName() failed");
+        VerifyOrQuit(offset == testName.mOffset + testName.mEncodedSize, "Name::ParseName() returned incorrect offset");
+
+        offset = testName.mOffset;
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, testName.mName), "Name::CompareName() failed");
+
+        if (testName.mFirstLabelLength == 0)
+        {
+            offset = testName.mOffset;
+            SuccessOrQuit(Dns::Name::ReadName(*message, offset, name, sizeof(name)), "Name::ReadName() failed");
+            VerifyOrQuit(strcmp(name, testName.mName) == 0, "Name::ReadName() did not return expected name");
+        }
+    }
+
+    // A dictionary rebuilt from names in the message compresses the
+    // same way as the one used to write them.
+
+    rebuiltDictionary.AddName(*message, testNames[0].mOffset);
+    rebuiltDictionary.AddName(*message, testNames[2].mOffset);
+
+    offset = message->GetLength();
+    SuccessOrQuit(rebuiltDictionary.AppendName(kInstance2, kInstance2FirstLabelLength, *message),
+                  "CompressionDictionary::AppendName() failed");
+    VerifyOrQuit(message->GetLength() - offset == 2, "Rebuilt dictionary did not compress instance name");
+
+    offset = message->GetLength();
+    SuccessOrQuit(rebuiltDictionary.AppendName(kHostName, *message), "CompressionDictionary::AppendName() failed");
+    VerifyOrQuit(message->GetLength() - offset == sizeof("host") + 2, "Rebuilt dictionary did not compress host");
+
+    VerifyOrQuit(dictionary.AppendName("bad..name", *message) == kErrorInvalidArgs,
+                 "CompressionDictionary::AppendName() accepted an invalid name");
+
+    // A pointer label must refer to a prior offset, so a pointer to
+    // itself is rejected instead of looping.
+
+    offset = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendPointerLabel(offset - kHeaderOffset, *message), "AppendPointerLabel() failed");
+    VerifyOrQuit(Dns::Name::ParseName(*message, offset) == kErrorParse, "Name::ParseName() accepted pointer loop");
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 void TestHeaderAndResourceRecords(void)
 {
     enum
@@ -1350,6 +1470,7 @@ int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestDnsCompressionDictionary();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
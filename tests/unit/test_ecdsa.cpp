@@ -175,6 +175,69 @@ void TestEdsaKeyGenerationSignAndVerify(void)
     testFreeInstance(instance);
 }
 
+void TestEcdsaPreparedPublicKey(void)
+{
+    Instance *instance = testInitInstance();
+
+    const char *kMessage = "Prepared once, verified many times.";
+
+    Ecdsa::P256::KeyPair           keyPair;
+    Ecdsa::P256::PublicKey         publicKey;
+    Ecdsa::P256::PublicKey         otherPublicKey;
+    Ecdsa::P256::Signature         signature;
+    Ecdsa::P256::PreparedPublicKey preparedKey;
+    Sha256                         sha256;
+    Sha256::Hash                   hash;
+    Sha256::Hash                   otherHash;
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    printf("\n===========================================================================\n");
+    printf("Test ECDSA verification with a prepared public key\n");
+
+    SuccessOrQuit(keyPair.Generate(), "KeyPair::Generate() failed");
+    SuccessOrQuit(keyPair.GetPublicKey(publicKey), "KeyPair::GetPublicKey() failed");
+
+    sha256.Start();
+    sha256.Update(kMessage, static_cast<uint16_t>(strlen(kMessage)));
+    sha256.Finish(hash);
+
+    sha256.Start();
+    sha256.Update(kMessage, static_cast<uint16_t>(strlen(kMessage)) - 1);
+    sha256.Finish(otherHash);
+
+    SuccessOrQuit(keyPair.Sign(hash, signature), "KeyPair::Sign() failed");
+
+    VerifyOrQuit(!preparedKey.IsPreparedFor(publicKey), "Empty PreparedPublicKey reported as prepared");
+    VerifyOrQuit(preparedKey.Verify(hash, signature) == kErrorInvalidState,
+                 "PreparedPublicKey::Verify() did not fail when empty");
+
+    SuccessOrQuit(preparedKey.Prepare(publicKey), "PreparedPublicKey::Prepare() failed");
+    VerifyOrQuit(preparedKey.IsPreparedFor(publicKey), "PreparedPublicKey::IsPreparedFor() failed");
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        SuccessOrQuit(preparedKey.Verify(hash, signature), "PreparedPublicKey::Verify() failed");
+    }
+
+    VerifyOrQuit(preparedKey.Verify(otherHash, signature) != kErrorNone,
+                 "PreparedPublicKey::Verify() passed for invalid signature");
+
+    // A point which is not on the curve must be rejected.
+    memset(&otherPublicKey, 0x55, sizeof(otherPublicKey));
+    VerifyOrQuit(!preparedKey.IsPreparedFor(otherPublicKey), "PreparedPublicKey::IsPreparedFor() matched other key");
+    VerifyOrQuit(preparedKey.Prepare(otherPublicKey) == kErrorInvalidArgs,
+                 "PreparedPublicKey::Prepare() accepted an invalid point");
+    VerifyOrQuit(!preparedKey.IsPreparedFor(publicKey), "PreparedPublicKey kept stale key after failed Prepare()");
+
+    preparedKey.Clear();
+    VerifyOrQuit(!preparedKey.IsPreparedFor(publicKey), "PreparedPublicKey::Clear() failed");
+
+    printf("\nPrepared public key verification passed.\n\n");
+
+    testFreeInstance(instance);
+}
+
 } // namespace Crypto
 } // namespace ot
 
@@ -185,6 +248,7 @@ int main(void)
 #if OPENTHREAD_CONFIG_ECDSA_ENABLE
     ot::Crypto::TestEcdsaVector();
     ot::Crypto::TestEdsaKeyGenerationSignAndVerify();
+    ot::Crypto::TestEcdsaPreparedPublicKey();
     printf("All tests passed\n");
 #else
     printf("ECDSA feature is not enabled\n");
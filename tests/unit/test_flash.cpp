@@ -148,6 +148,35 @@ void TestFlash(void)
     VerifyOrQuit(flash.Delete(0, 0) == kErrorNotFound, "Delete() failed");
     VerifyOrQuit(flash.Get(0, 0, nullptr, nullptr) == kErrorNotFound, "Get() failed");
 
+    // Deleting a replaced value also deletes the older values
+
+    SuccessOrQuit(flash.Set(0, writeBuffer, 1), "Set() failed");
+    SuccessOrQuit(flash.Set(0, writeBuffer, 2), "Set() failed");
+    SuccessOrQuit(flash.Delete(0, 0), "Delete() failed");
+    VerifyOrQuit(flash.Get(0, 0, nullptr, nullptr) == kErrorNotFound, "Get() failed");
+
+    // More records than the RAM index can hold
+
+    for (uint16_t key = 0; key < 128; key++)
+    {
+        SuccessOrQuit(flash.Add(key, writeBuffer, key & 0x3), "Add() failed");
+    }
+
+    for (uint16_t key = 0; key < 128; key++)
+    {
+        uint16_t length = sizeof(readBuffer);
+
+        SuccessOrQuit(flash.Get(key, 0, readBuffer, &length), "Get() failed");
+        VerifyOrQuit(length == (key & 0x3), "Get() did not return expected length");
+        VerifyOrQuit(flash.Get(key, 1, nullptr, nullptr) == kErrorNotFound, "Get() failed");
+    }
+
+    for (uint16_t key = 0; key < 128; key++)
+    {
+        SuccessOrQuit(flash.Delete(key, -1), "Delete() failed");
+        VerifyOrQuit(flash.Get(key, 0, nullptr, nullptr) == kErrorNotFound, "Get() failed");
+    }
+
     // Wipe()
 
     for (uint16_t key = 0; key < 16; key++)
@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/indexed_min_heap.hpp"
+
+#include "test_util.h"
+
+enum : uint16_t
+{
+    kHeapSize = 13,
+};
+
+typedef ot::IndexedMinHeap<uint32_t, kHeapSize> Heap;
+
+void VerifyHeap(const Heap &aHeap, const uint32_t *aKeys, const bool *aPresent)
+{
+    uint16_t size   = 0;
+    uint32_t minKey = 0;
+
+    for (uint16_t index = 0; index < kHeapSize; index++)
+    {
+        VerifyOrQuit(aHeap.Contains(index) == aPresent[index], "IndexedMinHeap::Contains() failed");
+
+        if (!aPresent[index])
+        {
+            continue;
+        }
+
+        VerifyOrQuit(aHeap.GetKey(index) == aKeys[index], "IndexedMinHeap::GetKey() failed");
+
+        if ((size == 0) || (aKeys[index] < minKey))
+        {
+            minKey = aKeys[index];
+        }
+
+        size++;
+    }
+
+    VerifyOrQuit(!aHeap.Contains(kHeapSize), "IndexedMinHeap::Contains() succeeded for out of range index");
+    VerifyOrQuit(aHeap.GetSize() == size, "IndexedMinHeap::GetSize() failed");
+    VerifyOrQuit(aHeap.IsEmpty() == (size == 0), "IndexedMinHeap::IsEmpty() failed");
+
+    if (size != 0)
+    {
+        VerifyOrQuit(aHeap.GetKey(aHeap.GetTop()) == minKey, "IndexedMinHeap::GetTop() is not the minimum");
+    }
+}
+
+void TestIndexedMinHeap(void)
+{
+    Heap     heap;
+    uint32_t keys[kHeapSize];
+    bool     present[kHeapSize];
+    uint32_t seed = 0x1234;
+
+    memset(present, 0, sizeof(present));
+
+    VerifyHeap(heap, keys, present);
+
+    // Insert all entries in decreasing key order.
+
+    for (uint16_t index = 0; index < kHeapSize; index++)
+    {
+        keys[index]    = 1000 - index * 10;
+        present[index] = true;
+        heap.Update(index, keys[index]);
+        VerifyHeap(heap, keys, present);
+    }
+
+    VerifyOrQuit(heap.GetTop() == kHeapSize - 1, "IndexedMinHeap::GetTop() failed");
+
+    // Pop all entries, which must come out in increasing key order.
+
+    for (uint16_t count = 0; count < kHeapSize; count++)
+    {
+        uint16_t top = heap.GetTop();
+
+        VerifyOrQuit(top == kHeapSize - 1 - count, "IndexedMinHeap entries are not removed in key order");
+        heap.Remove(top);
+        present[top] = false;
+        VerifyHeap(heap, keys, present);
+    }
+
+    // Removing an entry which is not in the heap is a no-op.
+
+    heap.Remove(0);
+    VerifyHeap(heap, keys, present);
+
+    // Randomly insert, update (increase and decrease) and remove entries.
+
+    for (uint16_t iter = 0; iter < 2000; iter++)
+    {
+        uint16_t index;
+
+        seed  = seed * 1103515245 + 12345;
+        index = static_cast<uint16_t>((seed >> 16) % kHeapSize);
+
+        if (present[index] && ((seed & 3) == 0))
+        {
+            heap.Remove(index);
+            present[index] = false;
+        }
+        else
+        {
+            keys[index]    = (seed >> 8) % 100;
+            present[index] = true;
+            heap.Update(index, keys[index]);
+        }
+
+        VerifyHeap(heap, keys, present);
+    }
+
+    heap.Clear();
+    memset(present, 0, sizeof(present));
+    VerifyHeap(heap, keys, present);
+
+    printf("TestIndexedMinHeap() passed\n");
+}
+
+int main(void)
+{
+    TestIndexedMinHeap();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -151,6 +151,27 @@ void TestMacAddress(void)
     VerifyOrQuit(!addr.IsBroadcast(), "Address:IsBroadcast() failed");
     VerifyOrQuit(addr.IsShortAddrInvalid(), "Address:IsShortAddrInvalid() failed");
 
+    {
+        Mac::Address other;
+
+        addr.SetNone();
+        VerifyOrQuit(addr == other, "Address::operator==() failed");
+
+        addr.SetShort(kShortAddr);
+        VerifyOrQuit(addr != other, "Address::operator!=() failed");
+        other.SetShort(kShortAddr);
+        VerifyOrQuit(addr == other, "Address::operator==() failed");
+        other.SetShort(kShortAddr + 1);
+        VerifyOrQuit(addr != other, "Address::operator!=() failed");
+
+        addr.SetExtended(extAddr);
+        VerifyOrQuit(addr != other, "Address::operator!=() failed");
+        other.SetExtended(extAddr);
+        VerifyOrQuit(addr == other, "Address::operator==() failed");
+        other.GetExtended().ToggleLocal();
+        VerifyOrQuit(addr != other, "Address::operator!=() failed");
+    }
+
     testFreeInstance(instance);
 }
 
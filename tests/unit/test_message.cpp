@@ -131,6 +131,24 @@ void TestMessage(void)
 
     VerifyOrQuit(message->GetLength() == kMaxSize, "Message::GetLength failed");
 
+    // Verify `GetContiguousBytes()` gives direct access to the whole message content from any offset.
+
+    for (uint16_t offset = 0; offset <= kMaxSize; offset++)
+    {
+        uint16_t       readOffset = offset;
+        uint16_t       length;
+        const uint8_t *data;
+
+        while ((length = message->GetContiguousBytes(readOffset, data)) > 0)
+        {
+            VerifyOrQuit(length <= kMaxSize - readOffset, "Message::GetContiguousBytes() returned longer length");
+            VerifyOrQuit(memcmp(data, &writeBuffer[readOffset], length) == 0, "Message compare failed");
+            readOffset += length;
+        }
+
+        VerifyOrQuit(readOffset == kMaxSize, "Message::GetContiguousBytes() failed");
+    }
+
     // Test `Message::CopyTo()` behavior.
 
     VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
@@ -243,11 +261,70 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+void TestMessagePoolStats(void)
+{
+    Instance *         instance;
+    MessagePool *      messagePool;
+    Message *          message;
+    uint8_t            bufferCount;
+    otMessagePoolStats before;
+    otMessagePoolStats stats;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+    messagePool->ResetStats();
+    messagePool->GetStats(before);
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeOther, 0)) != nullptr, "Message::New failed");
+    message->SetSubType(Message::kSubTypeMleGeneral);
+    SuccessOrQuit(message->SetLength(kBufferSize * 2), "Message::SetLength failed");
+    bufferCount = message->GetBufferCount();
+
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mMessagesInUse == before.mMessagesInUse + 1, "MessagesInUse is incorrect");
+    VerifyOrQuit(stats.mBuffersInUse == before.mBuffersInUse + bufferCount, "BuffersInUse is incorrect");
+    VerifyOrQuit(stats.mMaxBuffersInUse >= stats.mBuffersInUse, "MaxBuffersInUse is incorrect");
+    VerifyOrQuit(stats.mTypeMessages[Message::kTypeOther] == before.mTypeMessages[Message::kTypeOther] + 1,
+                 "TypeMessages is incorrect");
+    VerifyOrQuit(stats.mSubTypeMessages[Message::kSubTypeMleGeneral] ==
+                     before.mSubTypeMessages[Message::kSubTypeMleGeneral] + 1,
+                 "SubTypeMessages is incorrect");
+    VerifyOrQuit(stats.mSubTypeMessages[Message::kSubTypeNone] == before.mSubTypeMessages[Message::kSubTypeNone],
+                 "SubTypeMessages is incorrect after SetSubType()");
+
+    message->Free();
+
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mMessagesInUse == before.mMessagesInUse, "MessagesInUse is incorrect after Free()");
+    VerifyOrQuit(stats.mBuffersInUse == before.mBuffersInUse, "BuffersInUse is incorrect after Free()");
+    VerifyOrQuit(stats.mMaxMessagesInUse == before.mMessagesInUse + 1, "MaxMessagesInUse is incorrect");
+    VerifyOrQuit(stats.mMaxSubTypeMessages[Message::kSubTypeMleGeneral] ==
+                     before.mSubTypeMessages[Message::kSubTypeMleGeneral] + 1,
+                 "MaxSubTypeMessages is incorrect");
+    VerifyOrQuit(stats.mBufferCountHistogram[bufferCount - 1] == before.mBufferCountHistogram[bufferCount - 1] + 1,
+                 "BufferCountHistogram is incorrect");
+    VerifyOrQuit(stats.mLifetimeHistogram[0] == before.mLifetimeHistogram[0] + 1, "LifetimeHistogram is incorrect");
+
+    messagePool->ResetStats();
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mMaxMessagesInUse == stats.mMessagesInUse, "MaxMessagesInUse is incorrect after reset");
+    VerifyOrQuit(stats.mLifetimeHistogram[0] == 0, "LifetimeHistogram is incorrect after reset");
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_STATS_ENABLE
+    ot::TestMessagePoolStats();
+#endif
     printf("All tests passed\n");
     return 0;
 }
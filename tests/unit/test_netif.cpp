@@ -205,11 +205,72 @@ void TestNetifMulticastAddresses(void)
     }
 }
 
+void TestNetifUnicastAddresses(void)
+{
+    // More addresses than the netif address set can hold, so that
+    // both the hashed lookup and the fallback list search are used.
+    const uint8_t kNumAddresses = OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_SET_SIZE + 8;
+
+    Instance *               instance = testInitInstance();
+    TestNetif                netif(*instance);
+    Ip6::NetifUnicastAddress netifAddresses[kNumAddresses];
+    Ip6::Address             address;
+
+    for (uint8_t i = 0; i < kNumAddresses; i++)
+    {
+        netifAddresses[i].InitAsSlaacOrigin(64, /* aPreferred */ true);
+        IgnoreError(netifAddresses[i].GetAddress().FromString("fd00:1234::1"));
+        netifAddresses[i].GetAddress().mFields.m8[15] = i;
+    }
+
+    IgnoreError(address.FromString("fd00:1234::ff"));
+
+    for (uint8_t numAdded = 0; numAdded <= kNumAddresses; numAdded++)
+    {
+        for (uint8_t i = 0; i < kNumAddresses; i++)
+        {
+            VerifyOrQuit(netif.HasUnicastAddress(netifAddresses[i].GetAddress()) == (i < numAdded),
+                         "HasUnicastAddress() failed");
+        }
+
+        VerifyOrQuit(!netif.HasUnicastAddress(address), "HasUnicastAddress() succeeded for a missing address");
+
+        if (numAdded < kNumAddresses)
+        {
+            netif.AddUnicastAddress(netifAddresses[numAdded]);
+        }
+    }
+
+    for (uint8_t numRemoved = 0; numRemoved <= kNumAddresses; numRemoved++)
+    {
+        for (uint8_t i = 0; i < kNumAddresses; i++)
+        {
+            VerifyOrQuit(netif.HasUnicastAddress(netifAddresses[i].GetAddress()) == (i >= numRemoved),
+                         "HasUnicastAddress() failed");
+        }
+
+        if (numRemoved < kNumAddresses)
+        {
+            netif.RemoveUnicastAddress(netifAddresses[numRemoved]);
+        }
+    }
+
+    SuccessOrQuit(netif.AddExternalUnicastAddress(netifAddresses[0]), "AddExternalUnicastAddress() failed");
+    VerifyOrQuit(netif.HasUnicastAddress(netifAddresses[0].GetAddress()), "HasUnicastAddress() failed");
+
+    SuccessOrQuit(netif.RemoveExternalUnicastAddress(netifAddresses[0].GetAddress()),
+                  "RemoveExternalUnicastAddress() failed");
+    VerifyOrQuit(!netif.HasUnicastAddress(netifAddresses[0].GetAddress()), "HasUnicastAddress() failed");
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestNetifMulticastAddresses();
+    ot::TestNetifUnicastAddresses();
     printf("All tests passed\n");
     return 0;
 }
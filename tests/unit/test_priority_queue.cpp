@@ -51,6 +51,7 @@ void VerifyPriorityQueueContent(ot::PriorityQueue &aPriorityQueue, int aExpected
     // Check the `GetInfo`
     aPriorityQueue.GetInfo(msgCount, bufCount);
     VerifyOrQuit(msgCount == aExpectedLength, "GetInfo() result does not match expected len.");
+    VerifyOrQuit(aPriorityQueue.GetNumMessages() == aExpectedLength, "GetNumMessages() does not match expected len.");
 
     va_start(args, aExpectedLength);
 
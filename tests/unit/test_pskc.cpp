@@ -27,6 +27,9 @@
  */
 #include <openthread/config.h>
 
+#include <openthread/dataset.h>
+#include <openthread/tasklet.h>
+
 #include "common/logging.hpp"
 #include "meshcop/commissioner.hpp"
 #include "meshcop/meshcop.hpp"
@@ -98,11 +101,78 @@ void TestExampleInSpec(void)
     testFreeInstance(instance);
 }
 
+static uint8_t  sCallbackCount;
+static otError  sCallbackError;
+static ot::Pskc sCallbackPskc;
+
+static void HandlePskcGenerated(otError aError, const otPskc *aPskc, void *aContext)
+{
+    VerifyOrQuit(aContext == &sCallbackCount, "HandlePskcGenerated got wrong context");
+
+    sCallbackCount++;
+    sCallbackError = aError;
+
+    if (aError == OT_ERROR_NONE)
+    {
+        sCallbackPskc = *static_cast<const ot::Pskc *>(aPskc);
+    }
+}
+
+void TestGeneratePskcAsync(void)
+{
+    const uint8_t         expectedPskc[] = {0xc3, 0xf5, 0x93, 0x68, 0x44, 0x5a, 0x1b, 0x61,
+                                    0x06, 0xbe, 0x42, 0x0a, 0x70, 0x6d, 0x4c, 0xc9};
+    const otExtendedPanId xpanid         = {{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07}};
+    const char            passphrase[]   = "12SECRETPASSWORD34";
+    const otNetworkName * networkName    = reinterpret_cast<const otNetworkName *>("Test Network");
+    otInstance *          instance       = testInitInstance();
+
+    // The callback is always invoked after `otDatasetGeneratePskcAsync()` returns.
+    sCallbackCount = 0;
+    SuccessOrQuit(otDatasetGeneratePskcAsync(instance, passphrase, networkName, &xpanid, HandlePskcGenerated,
+                                             &sCallbackCount),
+                  "TestGeneratePskcAsync failed to start");
+    VerifyOrQuit(sCallbackCount == 0, "TestGeneratePskcAsync reported synchronously");
+    VerifyOrQuit(otDatasetGeneratePskcAsync(instance, passphrase, networkName, &xpanid, HandlePskcGenerated,
+                                            &sCallbackCount) == OT_ERROR_BUSY,
+                 "TestGeneratePskcAsync accepted a second request");
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sCallbackCount == 1, "TestGeneratePskcAsync did not report");
+    SuccessOrQuit(sCallbackError, "TestGeneratePskcAsync failed to generate PSKc");
+    VerifyOrQuit(memcmp(sCallbackPskc.m8, expectedPskc, sizeof(sCallbackPskc)) == 0,
+                 "TestGeneratePskcAsync got wrong pskc");
+
+    // A repeated request is served from the cache.
+    memset(&sCallbackPskc, 0, sizeof(sCallbackPskc));
+    SuccessOrQuit(otDatasetGeneratePskcAsync(instance, passphrase, networkName, &xpanid, HandlePskcGenerated,
+                                             &sCallbackCount),
+                  "TestGeneratePskcAsync failed to start cached request");
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sCallbackCount == 2, "TestGeneratePskcAsync did not report cached pskc");
+    VerifyOrQuit(memcmp(sCallbackPskc.m8, expectedPskc, sizeof(sCallbackPskc)) == 0,
+                 "TestGeneratePskcAsync got wrong cached pskc");
+
+    // A canceled request is never reported.
+    SuccessOrQuit(otDatasetGeneratePskcAsync(instance, passphrase, networkName, &xpanid, HandlePskcGenerated,
+                                             &sCallbackCount),
+                  "TestGeneratePskcAsync failed to start canceled request");
+    otDatasetCancelGeneratePskc(instance);
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sCallbackCount == 2, "TestGeneratePskcAsync reported a canceled request");
+
+    VerifyOrQuit(otDatasetGeneratePskcAsync(instance, "12345", networkName, &xpanid, HandlePskcGenerated,
+                                            &sCallbackCount) == OT_ERROR_INVALID_ARGS,
+                 "TestGeneratePskcAsync accepted a short passphrase");
+
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMinimumPassphrase();
     TestMaximumPassphrase();
     TestExampleInSpec();
+    TestGeneratePskcAsync();
     printf("All tests passed\n");
     return 0;
 }
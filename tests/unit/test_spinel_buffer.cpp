@@ -171,6 +171,31 @@ void ReadAndVerifyContent(Spinel::Buffer &aNcpBuffer, const uint8_t *aContentBuf
     }
 }
 
+// Reads the current out frame in chunks of at most `aMaxChunkLength` bytes, and verifies that it matches with the
+// given content buffer.
+void ReadChunksAndVerifyContent(Spinel::Buffer &aNcpBuffer,
+                                const uint8_t * aContentBuffer,
+                                uint16_t        aBufferLength,
+                                uint16_t        aMaxChunkLength)
+{
+    while (aBufferLength > 0)
+    {
+        uint16_t       maxLength = (aBufferLength < aMaxChunkLength) ? aBufferLength : aMaxChunkLength;
+        uint16_t       length    = maxLength;
+        const uint8_t *chunk;
+
+        VerifyOrQuit(aNcpBuffer.OutFrameHasEnded() == false, "Out frame ended before end of expected content.");
+
+        chunk = aNcpBuffer.OutFrameReadChunk(length);
+        VerifyOrQuit(chunk != nullptr, "OutFrameReadChunk() failed.");
+        VerifyOrQuit((length > 0) && (length <= maxLength), "OutFrameReadChunk() returned invalid length");
+        VerifyOrQuit(memcmp(chunk, aContentBuffer, length) == 0, "Out frame chunk does not match expected content");
+
+        aContentBuffer += length;
+        aBufferLength -= length;
+    }
+}
+
 void WriteTestFrame1(Spinel::Buffer &aNcpBuffer, Spinel::Buffer::Priority aPriority)
 {
     Message *       message;
@@ -340,6 +365,9 @@ void TestBuffer(void)
     uint16_t                      readLen, readOffset;
     Spinel::Buffer::WritePosition pos1, pos2;
 
+    const uint16_t                 kMaxChunkLengths[] = {1, 7, 0xffff};
+    const Spinel::Buffer::Priority kPriorities[]      = {Spinel::Buffer::kPriorityLow, Spinel::Buffer::kPriorityHigh};
+
     sInstance    = testInitInstance();
     sMessagePool = &sInstance->Get<MessagePool>();
 
@@ -595,7 +623,7 @@ void TestBuffer(void)
     printf(" -- PASS\n");
 
     printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
-    printf("\nTest 7: OutFrameRead() in parts\n");
+    printf("\nTest 7: OutFrameRead() and OutFrameReadChunk() in parts\n");
 
     ncpBuffer.InFrameBegin(Spinel::Buffer::kPriorityLow);
     SuccessOrQuit(ncpBuffer.InFrameFeedData(sMottoText, sizeof(sMottoText)), "InFrameFeedData() failed.");
@@ -618,6 +646,25 @@ void TestBuffer(void)
 
     SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
 
+    for (uint16_t maxChunkLength : kMaxChunkLengths)
+    {
+        for (Spinel::Buffer::Priority priority : kPriorities)
+        {
+            uint16_t length = maxChunkLength;
+
+            WriteTestFrame1(ncpBuffer, priority);
+            SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+            ReadChunksAndVerifyContent(ncpBuffer, sMottoText, sizeof(sMottoText), maxChunkLength);
+            ReadChunksAndVerifyContent(ncpBuffer, sMysteryText, sizeof(sMysteryText), maxChunkLength);
+            ReadChunksAndVerifyContent(ncpBuffer, sMottoText, sizeof(sMottoText), maxChunkLength);
+            ReadChunksAndVerifyContent(ncpBuffer, sHelloText, sizeof(sHelloText), maxChunkLength);
+            VerifyOrQuit(ncpBuffer.OutFrameHasEnded() == true, "Frame longer than expected.");
+            VerifyOrQuit(ncpBuffer.OutFrameReadChunk(length) == nullptr, "ReadChunk() succeeded after end of frame.");
+            VerifyOrQuit(length == 0, "ReadChunk() returned non-zero length after end of frame.");
+            SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
+        }
+    }
+
     printf("\n -- PASS\n");
 
     printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
@@ -940,8 +987,16 @@ otError ReadRandomFrame(uint32_t aLength, Spinel::Buffer &aNcpBuffer, uint8_t pr
     SuccessOrQuit(aNcpBuffer.OutFrameBegin(), "OutFrameBegin failed");
     VerifyOrQuit(aNcpBuffer.OutFrameGetLength() == aLength, "OutFrameGetLength() does not match");
 
-    // Read and verify that the content is same as sFrameBuffer values...
-    ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    // Read and verify that the content is same as sFrameBuffer values (alternating between reading bytes and chunks)...
+    if ((aLength % 2) == 0)
+    {
+        ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    }
+    else
+    {
+        ReadChunksAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength),
+                                   static_cast<uint16_t>(1 + (aLength % 37)));
+    }
     sExpectedRemovedTag = aNcpBuffer.OutFrameGetTag();
 
     SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "OutFrameRemove failed");
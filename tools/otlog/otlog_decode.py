@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Decodes binary log records written by OpenThread with OPENTHREAD_CONFIG_LOG_BINARY_ENABLE.
+
+The format strings are not part of the log. They are resolved from the (unstripped) image which produced it:
+each record carries the offset of its format string from the `otLogBinaryFormatAnchor` symbol.
+
+Usage:
+
+    otlog_decode.py <elf-image> <log-file>
+
+where <log-file> is either a file written by the POSIX platform (starting with the 'OTBL' header) or a raw
+concatenation of the buffers returned by `otLoggingReadBinary()`.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+try:
+    from elftools.elf.elffile import ELFFile
+except ImportError:
+    sys.exit('otlog_decode.py requires pyelftools: pip3 install pyelftools')
+
+FILE_MAGIC = b'OTBL'
+FILE_VERSION = 1
+HEADER_FORMAT = '<BBBIi'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+ANCHOR_SYMBOL = 'otLogBinaryFormatAnchor'
+
+LEVELS = ['NONE', 'CRIT', 'WARN', 'NOTE', 'INFO', 'DEBG']
+
+REGIONS = [
+    '', 'API', 'MLE', 'ARP', 'N-DATA', 'ICMP', 'IP6', 'MAC', 'MEM', 'NCP', 'MESH-CP', 'DIAG', 'PLAT', 'COAP', 'CLI',
+    'CORE', 'UTIL', 'BBR', 'MLR', 'DUA', 'BR', 'SRP', 'DNS'
+]
+
+# Same grammar as `BinaryLog::EncodeArgs()` in src/core/common/binary_log.cpp.
+SPEC_RE = re.compile(r'%(?P<flags>[-+ #0]*)(?P<width>\*|\d*)(?:\.(?P<precision>\*|\d*))?'
+                     r'(?P<length>hh|h|ll|l|j|q|z|t|L)?(?P<conv>[%diuxXocpeEfFgGaAs])')
+
+
+class Image(object):
+    """Resolves format strings from an ELF image."""
+
+    def __init__(self, path):
+        self._elf = ELFFile(open(path, 'rb'))
+        self._anchor = self._find_anchor()
+        self._cache = {}
+
+    def _find_anchor(self):
+        symtab = self._elf.get_section_by_name('.symtab')
+
+        if symtab is None:
+            sys.exit('image has no symbol table, a non-stripped image is required')
+
+        symbols = symtab.get_symbol_by_name(ANCHOR_SYMBOL)
+
+        if not symbols:
+            sys.exit('image was not built with OPENTHREAD_CONFIG_LOG_BINARY_ENABLE')
+
+        return symbols[0]['st_value']
+
+    def format_string(self, format_id):
+        if format_id not in self._cache:
+            self._cache[format_id] = self._read_string(self._anchor + format_id)
+
+        return self._cache[format_id]
+
+    def _read_string(self, address):
+        for section in self._elf.iter_sections():
+            start = section['sh_addr']
+
+            if section['sh_type'] == 'SHT_NOBITS' or not start <= address < start + section['sh_size']:
+                continue
+
+            data = section.data()
+            offset = address - start
+            return data[offset:data.index(b'\0', offset)].decode('utf-8', 'replace')
+
+        return '<unknown format 0x%x>' % address
+
+
+def decode_args(fmt, args):
+    """Converts a C format string to a Python one and decodes its arguments."""
+
+    values = []
+    offset = 0
+    pieces = []
+    last = 0
+
+    def take(fmt_char, size):
+        nonlocal offset
+        value = struct.unpack_from('<' + fmt_char, args, offset)[0]
+        offset += size
+        return value
+
+    for match in SPEC_RE.finditer(fmt):
+        pieces.append(fmt[last:match.start()].replace('%', '%%'))
+        last = match.end()
+        conv = match.group('conv')
+
+        if conv == '%':
+            pieces.append('%%')
+            continue
+
+        spec = '%' + match.group('flags')
+
+        for field, prefix in (('width', ''), ('precision', '.')):
+            value = match.group(field)
+
+            if value is None:
+                continue
+
+            if value == '*':
+                value = str(take('i', 4))
+
+            spec += prefix + value
+
+        wide = match.group('length') in ('l', 'll', 'j', 'q', 'z', 't')
+
+        if conv in 'di':
+            values.append(take('q', 8) if wide else take('i', 4))
+            spec += 'd'
+        elif conv in 'uxXo':
+            values.append(take('Q', 8) if wide else take('I', 4))
+            spec += 'd' if conv == 'u' else conv
+        elif conv == 'c':
+            values.append(chr(take('I', 4) & 0xff))
+            spec += 'c'
+        elif conv == 'p':
+            values.append(take('Q', 8))
+            spec = '0x%x'
+        elif conv in 'eEfFgGaA':
+            values.append(take('d', 8))
+            spec += 'f' if conv in 'aA' else conv
+        else:
+            length = args[offset]
+            values.append(args[offset + 1:offset + 1 + length].decode('utf-8', 'replace'))
+            offset += 1 + length
+            spec += 's'
+
+        pieces.append(spec)
+
+    pieces.append(fmt[last:].replace('%', '%%'))
+
+    return ''.join(pieces) % tuple(values)
+
+
+def decode(image, data):
+    if data.startswith(FILE_MAGIC):
+        if data[len(FILE_MAGIC)] != FILE_VERSION:
+            sys.exit('unsupported binary log version %d' % data[len(FILE_MAGIC)])
+
+        data = data[len(FILE_MAGIC) + 1:]
+
+    offset = 0
+
+    while offset + HEADER_SIZE <= len(data):
+        args_length, level, region, timestamp, format_id = struct.unpack_from(HEADER_FORMAT, data, offset)
+        offset += HEADER_SIZE
+        args = data[offset:offset + args_length]
+        offset += args_length
+
+        if len(args) < args_length:
+            break
+
+        fmt = image.format_string(format_id)
+
+        try:
+            line = decode_args(fmt, args)
+        except (struct.error, IndexError, TypeError, ValueError):
+            line = '%s <undecodable args %s>' % (fmt, args.hex())
+
+        yield '%10u.%03u [%s]-%-8s-: %s' % (timestamp // 1000, timestamp % 1000, LEVELS[level] if
+                                            level < len(LEVELS) else level, REGIONS[region] if region < len(REGIONS)
+                                            else region, line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode OpenThread binary logs.')
+    parser.add_argument('image', help='the unstripped ELF image which produced the log')
+    parser.add_argument('log', help='the binary log file')
+    args = parser.parse_args()
+
+    image = Image(args.image)
+
+    with open(args.log, 'rb') as f:
+        for line in decode(image, f.read()):
+            print(line)
+
+
+if __name__ == '__main__':
+    main()